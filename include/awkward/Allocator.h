@@ -0,0 +1,343 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_ALLOCATOR_H_
+#define AWKWARD_ALLOCATOR_H_
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "awkward/cpu-kernels/util.h"
+
+namespace awkward {
+  // Alignment of every array buffer (one cache line, enough for AVX-512).
+  const size_t kAllocatorAlignment = 64;
+
+  // All Index, Identities, NumpyArray, RawArray, and GrowableBuffer data are
+  // allocated through an Allocator: the current one is the innermost
+  // AllocatorScope on this thread, if any, or else the global allocator. A
+  // buffer remembers the allocator that made it, so it can outlive a scope.
+  class EXPORT_SYMBOL Allocator {
+  public:
+    virtual ~Allocator();
+
+    virtual const std::string
+      name() const = 0;
+
+    // Returns at least bytes bytes (bytes may be zero) aligned to alignment,
+    // or throws std::bad_alloc.
+    virtual void*
+      allocate(size_t bytes, size_t alignment) = 0;
+
+    // Gets the same bytes and alignment that were given to allocate.
+    virtual void
+      deallocate(void* ptr, size_t bytes, size_t alignment) = 0;
+
+    // Resizes an allocation, keeping the first min(oldbytes, newbytes)
+    // bytes. The default allocates, copies, and deallocates.
+    virtual void*
+      reallocate(void* ptr,
+                 size_t oldbytes,
+                 size_t newbytes,
+                 size_t alignment);
+
+    // Grows an allocation to newbytes without moving it, if possible, and
+    // returns whether it did. Unlike reallocate, this is safe while other
+    // arrays share the allocation. The default cannot.
+    virtual bool
+      grow(void* ptr, size_t oldbytes, size_t newbytes, size_t alignment);
+  };
+
+  using AllocatorPtr = std::shared_ptr<Allocator>;
+
+  // The default: aligned heap memory (posix_memalign or _aligned_malloc).
+  class EXPORT_SYMBOL AlignedAllocator: public Allocator {
+  public:
+    const std::string
+      name() const override;
+    void*
+      allocate(size_t bytes, size_t alignment) override;
+    void
+      deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    void*
+      reallocate(void* ptr,
+                 size_t oldbytes,
+                 size_t newbytes,
+                 size_t alignment) override;
+  };
+
+  // Allocations of at least threshold bytes are anonymous mmaps, rounded up
+  // to whole huge pages and backed by them (MAP_HUGETLB if the system has
+  // reserved huge pages, else transparent huge pages through madvise).
+  // Smaller allocations, and all allocations on Windows, are aligned heap
+  // memory.
+  class EXPORT_SYMBOL HugePageAllocator: public Allocator {
+  public:
+    HugePageAllocator(size_t threshold);
+    size_t
+      threshold() const;
+    const std::string
+      name() const override;
+    void*
+      allocate(size_t bytes, size_t alignment) override;
+    void
+      deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    void*
+      reallocate(void* ptr,
+                 size_t oldbytes,
+                 size_t newbytes,
+                 size_t alignment) override;
+    bool
+      grow(void* ptr,
+           size_t oldbytes,
+           size_t newbytes,
+           size_t alignment) override;
+  private:
+    const size_t threshold_;
+    AlignedAllocator small_;
+  };
+
+  // Maps at least reservation bytes of address space for every allocation
+  // (pages only take memory once they are written), so that allocations can
+  // grow in place up to that size. A GrowableBuffer then keeps sharing its
+  // buffer with a builder's snapshots as it grows, instead of copying it.
+  // On Windows, allocations are aligned heap memory and cannot grow.
+  class EXPORT_SYMBOL ReservingAllocator: public Allocator {
+  public:
+    ReservingAllocator(size_t reservation);
+    size_t
+      reservation() const;
+    const std::string
+      name() const override;
+    void*
+      allocate(size_t bytes, size_t alignment) override;
+    void
+      deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    void*
+      reallocate(void* ptr,
+                 size_t oldbytes,
+                 size_t newbytes,
+                 size_t alignment) override;
+    bool
+      grow(void* ptr,
+           size_t oldbytes,
+           size_t newbytes,
+           size_t alignment) override;
+  private:
+    size_t
+      mapped(size_t bytes) const;
+
+    const size_t reservation_;
+    AlignedAllocator small_;
+  };
+
+  // Passes everything to another allocator and counts it (thread-safe).
+  class EXPORT_SYMBOL CountingAllocator: public Allocator {
+  public:
+    CountingAllocator(const AllocatorPtr& inner);
+    const AllocatorPtr
+      inner() const;
+    int64_t
+      allocations() const;
+    int64_t
+      deallocations() const;
+    int64_t
+      reallocations() const;
+    int64_t
+      bytes_allocated() const;
+    int64_t
+      bytes_in_use() const;
+    int64_t
+      peak_bytes_in_use() const;
+    void
+      reset();
+    const std::string
+      name() const override;
+    void*
+      allocate(size_t bytes, size_t alignment) override;
+    void
+      deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    void*
+      reallocate(void* ptr,
+                 size_t oldbytes,
+                 size_t newbytes,
+                 size_t alignment) override;
+    bool
+      grow(void* ptr,
+           size_t oldbytes,
+           size_t newbytes,
+           size_t alignment) override;
+  private:
+    const AllocatorPtr inner_;
+    std::atomic<int64_t> allocations_;
+    std::atomic<int64_t> deallocations_;
+    std::atomic<int64_t> reallocations_;
+    std::atomic<int64_t> bytes_allocated_;
+    std::atomic<int64_t> bytes_in_use_;
+    std::atomic<int64_t> peak_bytes_in_use_;
+  };
+
+  EXPORT_SYMBOL const AllocatorPtr
+    global_allocator();
+
+  // A nullptr restores the default AlignedAllocator.
+  EXPORT_SYMBOL void
+    set_global_allocator(const AllocatorPtr& allocator);
+
+  EXPORT_SYMBOL const AllocatorPtr
+    current_allocator();
+
+  // Makes allocator the current one on this thread until destruction.
+  // Scopes nest and must be destroyed in reverse order (as on the stack).
+  class EXPORT_SYMBOL AllocatorScope {
+  public:
+    AllocatorScope(const AllocatorPtr& allocator);
+    ~AllocatorScope();
+    AllocatorScope(const AllocatorScope&) = delete;
+    AllocatorScope&
+      operator=(const AllocatorScope&) = delete;
+  private:
+    AllocatorPtr previous_;
+  };
+
+  template <typename T>
+  class EXPORT_SYMBOL allocator_deleter {
+  public:
+    allocator_deleter(const AllocatorPtr& allocator,
+                      const T* ptr,
+                      size_t bytes)
+        : allocator_(allocator)
+        , ptr_(ptr)
+        , bytes_(bytes) { }
+    const AllocatorPtr
+      allocator() const {
+      return allocator_;
+    }
+    const T*
+      ptr() const {
+      return ptr_;
+    }
+    size_t
+      bytes() const {
+      return bytes_;
+    }
+    // After release, the shared_ptr no longer owns the memory.
+    void
+      release() {
+      ptr_ = nullptr;
+    }
+    // After the allocator grew the memory in place.
+    void
+      set_bytes(size_t bytes) {
+      bytes_ = bytes;
+    }
+    void operator()(T const *p) {
+      if (ptr_ != nullptr) {
+        allocator_.get()->deallocate((void*)p, bytes_, kAllocatorAlignment);
+      }
+    }
+  private:
+    AllocatorPtr allocator_;
+    const T* ptr_;
+    size_t bytes_;
+  };
+
+  // Uninitialized (like new T[length]) array of plain data from the current
+  // allocator; never nullptr, even if length is zero.
+  template <typename T>
+  std::shared_ptr<T>
+    allocate_array(int64_t length) {
+    AllocatorPtr allocator = current_allocator();
+    size_t bytes = (size_t)length * sizeof(T);
+    T* ptr = reinterpret_cast<T*>(
+      allocator.get()->allocate(bytes, kAllocatorAlignment));
+    return std::shared_ptr<T>(ptr,
+                              allocator_deleter<T>(allocator, ptr, bytes));
+  }
+
+  // If ptr is the only reference to an array from allocate_array, resizes
+  // it with the allocator that made it (so it may move) and replaces ptr;
+  // otherwise, returns false and leaves ptr unchanged.
+  template <typename T>
+  bool
+    reallocate_array(std::shared_ptr<T>& ptr, int64_t length) {
+    allocator_deleter<T>* deleter =
+      std::get_deleter<allocator_deleter<T>>(ptr);
+    if (deleter == nullptr  ||
+        deleter->ptr() != ptr.get()  ||
+        ptr.use_count() != 1) {
+      return false;
+    }
+    AllocatorPtr allocator = deleter->allocator();
+    size_t bytes = (size_t)length * sizeof(T);
+    T* out = reinterpret_cast<T*>(
+      allocator.get()->reallocate(ptr.get(),
+                                  deleter->bytes(),
+                                  bytes,
+                                  kAllocatorAlignment));
+    deleter->release();
+    ptr = std::shared_ptr<T>(out, allocator_deleter<T>(allocator, out, bytes));
+    return true;
+  }
+
+  // If ptr is an array from allocate_array whose allocator can grow it in
+  // place, grows it and returns true. Since it does not move, other arrays
+  // (snapshots) may share it.
+  template <typename T>
+  bool
+    grow_array(const std::shared_ptr<T>& ptr, int64_t length) {
+    allocator_deleter<T>* deleter =
+      std::get_deleter<allocator_deleter<T>>(ptr);
+    if (deleter == nullptr  ||  deleter->ptr() != ptr.get()) {
+      return false;
+    }
+    size_t bytes = (size_t)length * sizeof(T);
+    if (!deleter->allocator().get()->grow((void*)ptr.get(),
+                                          deleter->bytes(),
+                                          bytes,
+                                          kAllocatorAlignment)) {
+      return false;
+    }
+    deleter->set_bytes(bytes);
+    return true;
+  }
+
+  // While a ScratchScope exists on this thread, scratch_array takes
+  // temporaries from a thread-local bump arena: no allocator call and no
+  // control block per array (each shares the arena chunk's reference count).
+  // The outermost scope's end resets the arena, reusing its chunk if none of
+  // its arrays are still alive; one that escaped into a result keeps its
+  // chunk alive, and the arena starts a new one.
+  class EXPORT_SYMBOL ScratchScope {
+  public:
+    ScratchScope();
+    ~ScratchScope();
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope&
+      operator=(const ScratchScope&) = delete;
+  };
+
+  // Returns nullptr if there is no ScratchScope or bytes is too large for
+  // the arena.
+  EXPORT_SYMBOL std::shared_ptr<void>
+    scratch_allocate(size_t bytes);
+
+  // Whether ptr is in a scratch chunk of this thread's current scope (the
+  // current chunk or one the scope outgrew): arrays that are kept in a result
+  // should be copied out, rather than keep a chunk (up to 16 MB) alive.
+  EXPORT_SYMBOL bool
+    is_scratch(const void* ptr);
+
+  // Like allocate_array, but from the scratch arena if possible.
+  template <typename T>
+  std::shared_ptr<T>
+    scratch_array(int64_t length) {
+    std::shared_ptr<void> ptr = scratch_allocate((size_t)length * sizeof(T));
+    if (ptr.get() == nullptr) {
+      return allocate_array<T>(length);
+    }
+    return std::static_pointer_cast<T>(ptr);
+  }
+}
+
+#endif // AWKWARD_ALLOCATOR_H_
@@ -3,8 +3,10 @@
 #ifndef AWKWARD_CONTENT_H_
 #define AWKWARD_CONTENT_H_
 
+#include <atomic>
 #include <cstdio>
 #include <map>
+#include <memory>
 
 #include "awkward/cpu-kernels/util.h"
 #include "awkward/Identities.h"
@@ -19,6 +21,17 @@ namespace awkward {
   using ContentPtr    = std::shared_ptr<Content>;
   using ContentPtrVec = std::vector<std::shared_ptr<Content>>;
 
+  // Thread safety: once a Content is shared (reachable from another thread
+  // or from another layout), it is never modified. So the const methods
+  // (getitem*, carry, reduce, num, offsets_and_flattened, tojson, ...) may
+  // be called from any number of threads on the same ContentPtr.
+  //
+  // setidentities, setparameters, and setparameter modify this node in
+  // place and are only for nodes that are not yet shared, such as one that
+  // was just constructed. setidentities never modifies the node's
+  // descendants; it replaces them with copies. Shared nodes are modified by
+  // copy-on-write with withidentities, withparameters, and withparameter,
+  // which return modified shallow copies that share the array buffers.
   class EXPORT_SYMBOL Content {
   public:
     Content(const IdentitiesPtr& identities,
@@ -41,8 +54,26 @@ namespace awkward {
     virtual void
       setidentities(const IdentitiesPtr& identities) = 0;
 
+    // Like setidentities(), but with VirtualIdentities, which cost nothing
+    // per element until an identity is actually asked for.
+    void
+      setvirtualidentities();
+
+    // Like setidentities(), but with CompressedIdentities.
+    void
+      setcompressedidentities();
+
+    const ContentPtr
+      withidentities(const IdentitiesPtr& identities) const;
+
+    // Computed by type_part on the first call (per typestrs) and interned,
+    // so equal structures give the same TypePtr. Later calls only check that
+    // no node below has had setparameter(s) since, without allocating.
+    const TypePtr
+      type(const util::TypeStrs& typestrs) const;
+
     virtual const TypePtr
-      type(const util::TypeStrs& typestrs) const = 0;
+      type_part(const util::TypeStrs& typestrs) const = 0;
 
     virtual const std::string
       tostring_part(const std::string& indent,
@@ -177,6 +208,19 @@ namespace awkward {
                   bool mask,
                   bool keepdims) const = 0;
 
+    // Applies reducers[i] to contents[i], where contents[0] is this array and
+    // the others have the same length; list types that all have the same
+    // offsets prepare their indexes once for all of the contents.
+    virtual const ContentPtrVec
+      reduce_next_multi(const ContentPtrVec& contents,
+                        const ReducerPtrVec& reducers,
+                        int64_t negaxis,
+                        const Index64& starts,
+                        const Index64& parents,
+                        int64_t outlength,
+                        bool mask,
+                        bool keepdims) const;
+
     virtual const ContentPtr
       localindex(int64_t axis, int64_t depth) const = 0;
 
@@ -209,18 +253,33 @@ namespace awkward {
              bool mask,
              bool keepdims) const;
 
+    // Reduces each of contents (which must all have the same length) with
+    // the corresponding reducer in a single traversal.
+    static const ContentPtrVec
+      reduce_multi(const ContentPtrVec& contents,
+                   const ReducerPtrVec& reducers,
+                   int64_t axis,
+                   bool mask,
+                   bool keepdims);
+
     const util::Parameters
       parameters() const;
 
     void
       setparameters(const util::Parameters& parameters);
 
+    const ContentPtr
+      withparameters(const util::Parameters& parameters) const;
+
     const std::string
       parameter(const std::string& key) const;
 
     void
       setparameter(const std::string& key, const std::string& value);
 
+    const ContentPtr
+      withparameter(const std::string& key, const std::string& value) const;
+
     bool
       parameter_equals(const std::string& key, const std::string& value) const;
 
@@ -321,6 +380,21 @@ namespace awkward {
   protected:
     IdentitiesPtr identities_;
     util::Parameters parameters_;
+
+  private:
+    struct TypeMemo;
+
+    // The memos of the nodes that the current type_part has asked for.
+    static std::vector<std::shared_ptr<const TypeMemo>>*&
+      typememo_children();
+
+    void
+      settypestale();
+
+    // Read and replaced with std::atomic_load/store: shared nodes memoize
+    // too. typestale_ is set when this node's parameters change.
+    mutable std::shared_ptr<const TypeMemo> typememo_;
+    mutable std::shared_ptr<std::atomic<bool>> typestale_;
   };
 }
 
@@ -3,6 +3,7 @@
 #ifndef AWKWARD_IDENTITIES_H_
 #define AWKWARD_IDENTITIES_H_
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <map>
@@ -162,6 +163,326 @@ namespace awkward {
 
   using Identities32 = IdentitiesOf<int32_t>;
   using Identities64 = IdentitiesOf<int64_t>;
+
+  // Identities other than a dense table of width x length integers. They
+  // derive their contents' identities themselves: these are what each
+  // Content::setidentities passes down, the counterparts of the
+  // awkward_identities*_from_* kernels. Where a kernel would find that
+  // the contents are not unique, the result may be none.
+  //
+  // Unlike IdentitiesOf<T>, offset is in rows, not in items.
+  class EXPORT_SYMBOL EncodedIdentities: public Identities {
+  public:
+    EncodedIdentities(const Ref ref,
+                      const FieldLoc& fieldloc,
+                      int64_t offset,
+                      int64_t width,
+                      int64_t length);
+
+    const std::string
+      identity_at(int64_t at) const override;
+
+    virtual const IdentitiesPtr
+      from_listarray(const Index64& starts,
+                     const Index64& stops,
+                     int64_t tolength) const = 0;
+
+    virtual const IdentitiesPtr
+      from_regulararray(int64_t size, int64_t tolength) const = 0;
+
+    virtual const IdentitiesPtr
+      from_indexedarray(const Index64& index, int64_t tolength) const = 0;
+
+    virtual const IdentitiesPtr
+      from_unionarray(const Index8& tags,
+                      const Index64& index,
+                      int64_t which,
+                      int64_t tolength) const = 0;
+
+    virtual const IdentitiesPtr
+      extend(int64_t tolength) const = 0;
+  };
+
+  // Identities that are not filled in: each node records how its rows
+  // derive from its parent's (a list's starts and stops, a carry, etc.),
+  // sharing those indexes with the layout, and identity_at/value walk the
+  // chain for one row when it is needed for an error message. Ranges and
+  // carries are O(1), so nothing is paid per element on the hot path.
+  // to64 materializes an ordinary Identities64 through the same kernels as
+  // setidentities; rows that are not unique in their parent are only
+  // detected then (to64 returns none), and identity_at reports the first.
+  class EXPORT_SYMBOL VirtualIdentities: public EncodedIdentities {
+  public:
+    enum class Kind {
+      root,
+      carry,
+      listarray,
+      regulararray,
+      indexedarray,
+      unionarray,
+      extend
+    };
+
+    VirtualIdentities(const Ref ref,
+                      const FieldLoc& fieldloc,
+                      int64_t length);
+
+    VirtualIdentities(const Ref ref,
+                      const FieldLoc& fieldloc,
+                      int64_t offset,
+                      int64_t width,
+                      int64_t length,
+                      Kind kind,
+                      int64_t baselength,
+                      const IdentitiesPtr& parent,
+                      const Index64& index,
+                      const Index64& stops,
+                      const Index8& tags,
+                      int64_t size);
+
+    Kind
+      kind() const;
+
+    const IdentitiesPtr
+      parent() const;
+
+    const std::string
+      classname() const override;
+
+    const IdentitiesPtr
+      to64() const override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+    const IdentitiesPtr
+      getitem_range_nowrap(int64_t start, int64_t stop) const override;
+
+    void
+      nbytes_part(std::map<size_t, int64_t>& largest) const override;
+
+    const IdentitiesPtr
+      shallow_copy() const override;
+
+    const IdentitiesPtr
+      deep_copy() const override;
+
+    const IdentitiesPtr
+      getitem_carry_64(const Index64& carry) const override;
+
+    const IdentitiesPtr
+      withfieldloc(const FieldLoc& fieldloc) const override;
+
+    int64_t
+      value(int64_t row, int64_t col) const override;
+
+    const IdentitiesPtr
+      from_listarray(const Index64& starts,
+                     const Index64& stops,
+                     int64_t tolength) const override;
+
+    const IdentitiesPtr
+      from_regulararray(int64_t size, int64_t tolength) const override;
+
+    const IdentitiesPtr
+      from_indexedarray(const Index64& index,
+                        int64_t tolength) const override;
+
+    const IdentitiesPtr
+      from_unionarray(const Index8& tags,
+                      const Index64& index,
+                      int64_t which,
+                      int64_t tolength) const override;
+
+    const IdentitiesPtr
+      extend(int64_t tolength) const override;
+
+  private:
+    const IdentitiesPtr
+      child(Kind kind,
+            int64_t width,
+            int64_t tolength,
+            const Index64& index,
+            const Index64& stops,
+            const Index8& tags,
+            int64_t size) const;
+
+    int64_t
+      parentrow(int64_t baserow, int64_t& local) const;
+
+    const IdentitiesPtr
+      materialize() const;
+
+    const Kind kind_;
+    const int64_t baselength_;
+    const IdentitiesPtr parent_;
+    const Index64 index_;
+    const Index64 stops_;
+    const Index8 tags_;
+    const int64_t size_;
+  };
+
+  // One column of CompressedIdentities, in whichever of three encodings is
+  // smallest for it:
+  //
+  //   runlength:        a value and the row where it stops, for each run;
+  //                     good for outer indexes, which repeat.
+  //   delta:            each row's difference from the one before, in 1, 2,
+  //                     4, or 8 bytes, with a full value every kBlockSize
+  //                     rows; good for monotone columns.
+  //   frameofreference: each row's difference from its block's minimum,
+  //                     unsigned in 1, 2, 4, or 8 bytes; good for columns
+  //                     that are local but not monotone, such as carried
+  //                     ones.
+  class EXPORT_SYMBOL IdentitiesColumn {
+  public:
+    enum class Encoding {
+      runlength,
+      delta,
+      frameofreference
+    };
+
+    static const int64_t kBlockSize = 64;
+
+    // Two passes over getvalue(0) ... getvalue(length - 1), in order: one to
+    // choose the encoding and one to fill it. Nothing of length x 8 bytes is
+    // allocated unless that is what the encoding needs.
+    static const IdentitiesColumn
+      encode(int64_t length,
+             const std::function<int64_t(int64_t)>& getvalue);
+
+    IdentitiesColumn(Encoding encoding,
+                     int64_t length,
+                     int64_t itemsize,
+                     const Index64& values,
+                     const Index64& runstops,
+                     const std::shared_ptr<uint8_t>& packed);
+
+    Encoding
+      encoding() const;
+
+    int64_t
+      length() const;
+
+    int64_t
+      value(int64_t row) const;
+
+    // Fills toptr[0], toptr[stride], ... with rows start to start + length,
+    // without a search or block sum per row.
+    void
+      decode(int64_t start,
+             int64_t length,
+             int64_t* toptr,
+             int64_t stride) const;
+
+    int64_t
+      nbytes() const;
+
+    void
+      nbytes_part(std::map<size_t, int64_t>& largest) const;
+
+  private:
+    int64_t
+      packed_at(int64_t at) const;
+
+    Encoding encoding_;
+    int64_t length_;
+    // bytes per item in packed_ (delta and frameofreference)
+    int64_t itemsize_;
+    // runlength: the value of each run; otherwise the base of each block
+    Index64 values_;
+    // runlength: the row at which each run stops
+    Index64 runstops_;
+    std::shared_ptr<uint8_t> packed_;
+  };
+
+  // Identities stored as one IdentitiesColumn per column. Ranges only move
+  // the offset; carries, and the identities derived for a layout's contents,
+  // are encoded directly from the compressed columns, so a dense table is
+  // never built (to64 builds one on request).
+  class EXPORT_SYMBOL CompressedIdentities: public EncodedIdentities {
+  public:
+    // Reads identities row by row, so it can compress VirtualIdentities
+    // without materializing them first.
+    static const IdentitiesPtr
+      compress(const Identities& identities);
+
+    CompressedIdentities(const Ref ref,
+                         const FieldLoc& fieldloc,
+                         int64_t offset,
+                         int64_t width,
+                         int64_t length,
+                         const std::vector<IdentitiesColumn>& columns);
+
+    const std::vector<IdentitiesColumn>
+      columns() const;
+
+    const std::string
+      classname() const override;
+
+    const IdentitiesPtr
+      to64() const override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+    const IdentitiesPtr
+      getitem_range_nowrap(int64_t start, int64_t stop) const override;
+
+    void
+      nbytes_part(std::map<size_t, int64_t>& largest) const override;
+
+    const IdentitiesPtr
+      shallow_copy() const override;
+
+    const IdentitiesPtr
+      deep_copy() const override;
+
+    const IdentitiesPtr
+      getitem_carry_64(const Index64& carry) const override;
+
+    const IdentitiesPtr
+      withfieldloc(const FieldLoc& fieldloc) const override;
+
+    int64_t
+      value(int64_t row, int64_t col) const override;
+
+    const IdentitiesPtr
+      from_listarray(const Index64& starts,
+                     const Index64& stops,
+                     int64_t tolength) const override;
+
+    const IdentitiesPtr
+      from_regulararray(int64_t size, int64_t tolength) const override;
+
+    const IdentitiesPtr
+      from_indexedarray(const Index64& index,
+                        int64_t tolength) const override;
+
+    const IdentitiesPtr
+      from_unionarray(const Index8& tags,
+                      const Index64& index,
+                      int64_t which,
+                      int64_t tolength) const override;
+
+    const IdentitiesPtr
+      extend(int64_t tolength) const override;
+
+  private:
+    // A child with a new ref; parents[j] is the row of this that row j
+    // comes from (or -1) and locals[j] its position there, if width grows.
+    const IdentitiesPtr
+      child(int64_t width,
+            int64_t tolength,
+            const std::function<int64_t(int64_t)>& parent,
+            const std::function<int64_t(int64_t)>& local) const;
+
+    const std::vector<IdentitiesColumn> columns_;
+  };
 }
 
 #endif // AWKWARD_IDENTITIES_H_
@@ -28,6 +28,10 @@ namespace awkward {
 
     IndexOf<T>(const std::shared_ptr<T>& ptr, int64_t offset, int64_t length);
 
+    // For temporaries within an operation (see ScratchScope).
+    static IndexOf<T>
+      scratch(int64_t length);
+
     const std::shared_ptr<T>
       ptr() const;
 
@@ -4,10 +4,15 @@
 #define AWKWARD_REDUCER_H_
 
 #include <memory>
+#include <vector>
 
 #include "awkward/Index.h"
 
 namespace awkward {
+  class Reducer;
+  using ReducerPtr    = std::shared_ptr<const Reducer>;
+  using ReducerPtrVec = std::vector<ReducerPtr>;
+
   class EXPORT_SYMBOL Reducer {
   public:
     virtual const std::string
@@ -101,6 +106,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const = 0;
+
+    virtual const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const = 0;
   };
 
   class EXPORT_SYMBOL ReducerCount: public Reducer {
@@ -196,6 +267,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerCountNonzero: public Reducer {
@@ -291,6 +428,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerSum: public Reducer {
@@ -386,6 +589,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerProd: public Reducer {
@@ -481,6 +750,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerAny: public Reducer {
@@ -576,6 +911,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerAll: public Reducer {
@@ -671,6 +1072,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerMin: public Reducer {
@@ -760,6 +1227,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerMax: public Reducer {
@@ -849,6 +1382,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerArgmin: public Reducer {
@@ -944,6 +1543,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
   class EXPORT_SYMBOL ReducerArgmax: public Reducer {
@@ -1039,6 +1704,72 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_bool_segments(const bool* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8_segments(const int8_t* data,
+                          int64_t offset,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8_segments(const uint8_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16_segments(const int16_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16_segments(const uint16_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32_segments(const int32_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32_segments(const uint32_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64_segments(const int64_t* data,
+                           int64_t offset,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64_segments(const uint64_t* data,
+                            int64_t offset,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32_segments(const float* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64_segments(const double* data,
+                             int64_t offset,
+                             const Index64& offsets,
+                             int64_t outlength) const override;
   };
 
 }
@@ -65,7 +65,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -247,7 +247,7 @@ namespace awkward {
 
   private:
     const IndexU8 mask_;
-    const ContentPtr content_;
+    ContentPtr content_;
     const bool validwhen_;
     const int64_t length_;
     const bool lsb_order_;
@@ -55,7 +55,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -248,7 +248,7 @@ namespace awkward {
 
   private:
     const Index8 mask_;
-    const ContentPtr content_;
+    ContentPtr content_;
     const bool validwhen_;
   };
 
@@ -31,7 +31,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
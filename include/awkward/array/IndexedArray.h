@@ -55,7 +55,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -248,7 +248,7 @@ namespace awkward {
 
   private:
     const IndexOf<T> index_;
-    const ContentPtr content_;
+    ContentPtr content_;
   };
 
   using IndexedArray32       = IndexedArrayOf<int32_t, false>;
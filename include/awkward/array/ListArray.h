@@ -51,7 +51,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -174,6 +174,16 @@ namespace awkward {
                   bool mask,
                   bool keepdims) const override;
 
+    const ContentPtrVec
+      reduce_next_multi(const ContentPtrVec& contents,
+                        const ReducerPtrVec& reducers,
+                        int64_t negaxis,
+                        const Index64& starts,
+                        const Index64& parents,
+                        int64_t outlength,
+                        bool mask,
+                        bool keepdims) const override;
+
     const ContentPtr
       localindex(int64_t axis, int64_t depth) const override;
 
@@ -226,7 +236,7 @@ namespace awkward {
   private:
     const IndexOf<T> starts_;
     const IndexOf<T> stops_;
-    const ContentPtr content_;
+    ContentPtr content_;
   };
 
   using ListArray32  = ListArrayOf<int32_t>;
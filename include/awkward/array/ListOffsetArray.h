@@ -53,7 +53,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -182,6 +182,16 @@ namespace awkward {
                   bool mask,
                   bool keepdims) const override;
 
+    const ContentPtrVec
+      reduce_next_multi(const ContentPtrVec& contents,
+                        const ReducerPtrVec& reducers,
+                        int64_t negaxis,
+                        const Index64& starts,
+                        const Index64& parents,
+                        int64_t outlength,
+                        bool mask,
+                        bool keepdims) const override;
+
     const ContentPtr
       localindex(int64_t axis, int64_t depth) const override;
 
@@ -233,7 +243,7 @@ namespace awkward {
 
   private:
     const IndexOf<T> offsets_;
-    const ContentPtr content_;
+    ContentPtr content_;
   };
 
   using ListOffsetArray32  = ListOffsetArrayOf<int32_t>;
@@ -123,7 +123,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -133,6 +133,14 @@ namespace awkward {
     void
       tojson_part(ToJson& builder) const override;
 
+    // Writes the lists that a ListOffsetArray with these offsets would have
+    // (offsets must already be valid), passing each list to the ToJson bulk
+    // methods. Returns false (and writes nothing) if this array is not a
+    // one-dimensional array of numbers or booleans.
+    template <typename T>
+    bool
+      tojson_lists(ToJson& builder, const T* offsets, int64_t length) const;
+
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
@@ -271,6 +279,15 @@ namespace awkward {
     const NumpyArray
       contiguous() const;
 
+    // Reduces each offsets[i]:offsets[i + 1] range of this array, which must
+    // be one-dimensional and contiguous. The offsets index this array
+    // directly, so the reduction needs no parents (see ListOffsetArray).
+    const ContentPtr
+      reduce_segments(const Reducer& reducer,
+                      const Index64& offsets,
+                      bool mask,
+                      bool keepdims) const;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -12,6 +12,7 @@
 #include <stdexcept>
 #include <typeinfo>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/util.h"
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
@@ -84,8 +85,7 @@ namespace awkward {
                   const util::Parameters& parameters,
                   const int64_t length)
         : Content(identities, parameters)
-        , ptr_(std::shared_ptr<T>(new T[(size_t)length],
-                                  util::array_deleter<T>()))
+        , ptr_(allocate_array<T>(length))
         , offset_(0)
         , length_(length)
         , itemsize_(sizeof(T)) { }
@@ -176,7 +176,7 @@ namespace awkward {
     }
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override {
+      type_part(const util::TypeStrs& typestrs) const override {
       if (std::is_same<T, double>::value) {
         return std::make_shared<PrimitiveType>(parameters_,
           util::gettypestr(parameters_, typestrs), PrimitiveType::float64);
@@ -367,8 +367,7 @@ namespace awkward {
       std::shared_ptr<T> ptr = ptr_;
       int64_t offset = offset_;
       if (copyarrays) {
-        ptr = std::shared_ptr<T>(new T[(size_t)length_],
-                                 util::array_deleter<T>());
+        ptr = allocate_array<T>(length_);
         memcpy(ptr.get(), &ptr_.get()[(size_t)offset_],
                sizeof(T)*((size_t)length_));
         offset = 0;
@@ -477,8 +476,7 @@ namespace awkward {
     }
 
     const ContentPtr carry(const Index64& carry) const override {
-      std::shared_ptr<T> ptr(new T[(size_t)carry.length()],
-                             util::array_deleter<T>());
+      std::shared_ptr<T> ptr(allocate_array<T>(carry.length()));
       struct Error err = awkward_numpyarray_getitem_next_null_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -683,8 +681,7 @@ namespace awkward {
       if (RawArrayOf<T>* rawother =
           dynamic_cast<RawArrayOf<T>*>(other.get())) {
         std::shared_ptr<T> ptr =
-          std::shared_ptr<T>(new T[(size_t)(length_ + rawother->length())],
-                             util::array_deleter<T>());
+          allocate_array<T>(length_ + rawother->length());
         memcpy(ptr.get(),
                &ptr_.get()[(size_t)offset_],
                sizeof(T)*((size_t)length_));
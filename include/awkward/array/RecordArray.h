@@ -4,6 +4,7 @@
 #define AWKWARD_RECORDARRAY_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -30,6 +31,11 @@ namespace awkward {
     const ContentPtrVec
       contents() const;
 
+    // True if this array was carried lazily and some of its fields have not
+    // been carried yet.
+    bool
+      islazy() const;
+
     const util::RecordLookupPtr
       recordlookup() const;
 
@@ -57,7 +63,7 @@ namespace awkward {
                     const std::string& post) const override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     void
       tojson_part(ToJson& builder) const override;
@@ -263,9 +269,28 @@ namespace awkward {
                                   const Slice& tail) const;
 
   private:
-    const ContentPtrVec contents_;
+    // A carry that has not been applied to every field yet: each field is
+    // carried the first time it is needed, and the result is shared by all
+    // shallow copies.
+    struct LazyCarry {
+      LazyCarry(const Index64& carry, size_t numfields);
+
+      const Index64 carry;
+      std::mutex mutex;
+      ContentPtrVec carried;
+    };
+
+    RecordArray(const IdentitiesPtr& identities,
+                const util::Parameters& parameters,
+                const ContentPtrVec& contents,
+                const util::RecordLookupPtr& recordlookup,
+                const std::shared_ptr<LazyCarry>& lazy);
+
+    // If lazy_ is not nullptr, contents_ are the fields before lazy_->carry.
+    ContentPtrVec contents_;
     const util::RecordLookupPtr recordlookup_;
     int64_t length_;
+    std::shared_ptr<LazyCarry> lazy_;
   };
 }
 
@@ -47,7 +47,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -220,7 +220,7 @@ namespace awkward {
                           const Slice& tail) const override;
 
   private:
-    const ContentPtr content_;
+    ContentPtr content_;
     int64_t size_;
   };
 }
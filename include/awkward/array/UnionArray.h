@@ -56,7 +56,7 @@ namespace awkward {
       setidentities(const IdentitiesPtr& identities) override;
 
     const TypePtr
-      type(const util::TypeStrs& typestrs) const override;
+      type_part(const util::TypeStrs& typestrs) const override;
 
     const std::string
       tostring_part(const std::string& indent,
@@ -247,7 +247,7 @@ namespace awkward {
   private:
     const IndexOf<T> tags_;
     const IndexOf<I> index_;
-    const ContentPtrVec contents_;
+    ContentPtrVec contents_;
   };
 
   using UnionArray8_32  = UnionArrayOf<int8_t, int32_t>;
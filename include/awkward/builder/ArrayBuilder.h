@@ -27,9 +27,22 @@ namespace awkward {
     const TypePtr
       type(const util::TypeStrs& typestrs) const;
 
+    // The snapshot shares the builder's buffers, so it is O(1); later
+    // appends go past its length. A buffer that has to grow while it is
+    // shared grows in place if its allocator can (see ReservingAllocator),
+    // and is otherwise copied (copy on write), never modified under the
+    // snapshot.
     const ContentPtr
       snapshot() const;
 
+    // Returns the array and clears the builder, handing over the buffers
+    // without copying: the result is their only owner. Lists, options, tuples
+    // and unions keep their structure; records drop their fields. If shrink,
+    // buffers that no earlier snapshot shares are first resized to their
+    // lengths (reallocated in place if the allocator can).
+    const ContentPtr
+      finish(bool shrink);
+
     const ContentPtr
       getitem_at(int64_t at) const;
 
@@ -13,15 +13,24 @@ namespace awkward {
   public:
     ArrayBuilderOptions(int64_t initial, double resize);
 
+    // If reallocate, buffers grow by resizing their allocation in place
+    // (realloc, or mremap for huge pages) rather than allocating a new one
+    // and copying, whenever no snapshot shares the buffer.
+    ArrayBuilderOptions(int64_t initial, double resize, bool reallocate);
+
     int64_t
       initial() const;
 
     double
       resize() const;
 
+    bool
+      reallocate() const;
+
   private:
     int64_t initial_;
     double resize_;
+    bool reallocate_;
   };
 }
 
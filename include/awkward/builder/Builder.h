@@ -3,6 +3,7 @@
 #ifndef AWKWARD_FILLABLE_H_
 #define AWKWARD_FILLABLE_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,7 +15,11 @@ namespace awkward {
   class Builder;
   using BuilderPtr = std::shared_ptr<Builder>;
 
-  class EXPORT_SYMBOL Builder {
+  // Each method that takes data returns nullptr if this builder took it,
+  // or else a new builder that took it and replaces this one in its parent
+  // (for instance, an OptionBuilder wrapping this one after a null). The
+  // common, unchanged case therefore makes no reference-count updates.
+  class EXPORT_SYMBOL Builder: public std::enable_shared_from_this<Builder> {
   public:
     virtual ~Builder();
 
@@ -27,6 +32,10 @@ namespace awkward {
     virtual void
       clear() = 0;
 
+    // Releases reserved but unused space in buffers that no snapshot shares.
+    virtual void
+      shrink_to_fit() = 0;
+
     virtual const ContentPtr
       snapshot() const = 0;
 
@@ -74,12 +83,6 @@ namespace awkward {
 
     virtual const BuilderPtr
       append(const ContentPtr& array, int64_t at) = 0;
-
-    void
-      setthat(const BuilderPtr& that);
-
-  protected:
-    BuilderPtr that_;
   };
 }
 
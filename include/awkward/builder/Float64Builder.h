@@ -30,6 +30,9 @@ namespace awkward {
     void
       clear() override;
 
+    void
+      shrink_to_fit() override;
+
     const ContentPtr
       snapshot() const override;
 
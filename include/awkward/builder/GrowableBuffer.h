@@ -3,6 +3,7 @@
 #ifndef AWKWARD_GROWABLEBUFFER_H_
 #define AWKWARD_GROWABLEBUFFER_H_
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 
@@ -51,13 +52,37 @@ namespace awkward {
     void
       clear();
 
+    // Resizes the buffer to its length (reallocating in place, if possible)
+    // unless a snapshot shares it.
     void
-      append(T datum);
+      shrink_to_fit();
+
+    // Defined here so that it can be inlined into builders.
+    void
+      append(T datum) {
+      if (length_ == reserved_) {
+        set_reserved(next_reserved());
+      }
+      ptr_.get()[length_] = datum;
+      length_++;
+    }
+
+    // Appends length values at once (one resize, one memcpy).
+    void
+      extend(const T* data, int64_t length);
 
     T
       getitem_at_nowrap(int64_t at) const;
 
   private:
+    // By the resize factor, but always by at least one, even if the factor
+    // is 1 or less.
+    int64_t
+      next_reserved() const {
+      return std::max((int64_t)ceil(reserved_ * options_.resize()),
+                      reserved_ + 1);
+    }
+
     const ArrayBuilderOptions options_;
     std::shared_ptr<T> ptr_;
     int64_t length_;
@@ -29,6 +29,9 @@ namespace awkward {
     void
       clear() override;
 
+    void
+      shrink_to_fit() override;
+
     bool
       active() const override;
 
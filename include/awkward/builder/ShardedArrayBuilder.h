@@ -0,0 +1,58 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_SHARDEDARRAYBUILDER_H_
+#define AWKWARD_SHARDEDARRAYBUILDER_H_
+
+#include <memory>
+#include <vector>
+
+#include "awkward/cpu-kernels/util.h"
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/ArrayBuilder.h"
+
+namespace awkward {
+  // An ArrayBuilder per producer: each thread fills only its own shard(i),
+  // with no locking, and the result is the shards' arrays concatenated in
+  // shard order. The shards' types are unified the way concatenate does
+  // (merge if mergeable, merge_as_union if not); lists are merged by
+  // shifting their offsets, not by appending their items again.
+  //
+  // Only the shards are thread-safe (one thread each); snapshot, finish,
+  // and clear must not run while any shard is being filled.
+  class EXPORT_SYMBOL ShardedArrayBuilder {
+  public:
+    ShardedArrayBuilder(const ArrayBuilderOptions& options,
+                        int64_t numshards);
+
+    int64_t
+      numshards() const;
+
+    ArrayBuilder&
+      shard(int64_t i);
+
+    // Total length of all shards.
+    int64_t
+      length() const;
+
+    void
+      clear();
+
+    const ContentPtr
+      snapshot() const;
+
+    // Finishes each shard (handing over its buffers) and merges them.
+    const ContentPtr
+      finish();
+
+    // Concatenates arrays in order, merging pairs in a balanced tree so that
+    // each item is copied O(log(arrays.size())) times, not O(arrays.size()).
+    static const ContentPtr
+      merge(const ContentPtrVec& arrays);
+
+  private:
+    std::vector<std::unique_ptr<ArrayBuilder>> shards_;
+  };
+}
+
+#endif // AWKWARD_SHARDEDARRAYBUILDER_H_
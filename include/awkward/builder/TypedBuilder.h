@@ -0,0 +1,711 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_TYPEDBUILDER_H_
+#define AWKWARD_TYPEDBUILDER_H_
+
+#include <string>
+#include <tuple>
+#include <vector>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/util.h"
+#include "awkward/util.h"
+#include "awkward/Index.h"
+#include "awkward/Identities.h"
+#include "awkward/Content.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/type/Type.h"
+#include "awkward/type/PrimitiveType.h"
+#include "awkward/type/ListType.h"
+#include "awkward/type/RegularType.h"
+#include "awkward/type/OptionType.h"
+#include "awkward/type/RecordType.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/GrowableBuffer.h"
+
+// Builders for a layout that is known at compile time, such as
+//
+//     TypedListBuilder<TypedRecordBuilder<TypedNumpyBuilder<int64_t>,
+//                                         TypedStringBuilder>>
+//
+// Unlike ArrayBuilder, no node ever changes type, so every append is a
+// non-virtual, inlineable write into that node's GrowableBuffer, and
+// finish() wraps the buffers in the same layouts ArrayBuilder would make
+// (without simplifying, because there is nothing to simplify).
+//
+// Each node can be constructed from options alone or from options and a
+// Type with the same structure, which supplies parameters and record
+// field names; a Type of a different structure is an error.
+
+namespace awkward {
+  // The dtype of each C++ type; its format is PrimitiveType::format(dtype).
+  template <typename T>
+  struct TypedFormat { };
+
+  template <>
+  struct TypedFormat<bool> {
+    static const PrimitiveType::DType dtype = PrimitiveType::boolean;
+  };
+  template <>
+  struct TypedFormat<int8_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::int8;
+  };
+  template <>
+  struct TypedFormat<uint8_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::uint8;
+  };
+  template <>
+  struct TypedFormat<int16_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::int16;
+  };
+  template <>
+  struct TypedFormat<uint16_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::uint16;
+  };
+  template <>
+  struct TypedFormat<int32_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::int32;
+  };
+  template <>
+  struct TypedFormat<uint32_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::uint32;
+  };
+  template <>
+  struct TypedFormat<int64_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::int64;
+  };
+  template <>
+  struct TypedFormat<uint64_t> {
+    static const PrimitiveType::DType dtype = PrimitiveType::uint64;
+  };
+  template <>
+  struct TypedFormat<float> {
+    static const PrimitiveType::DType dtype = PrimitiveType::float32;
+  };
+  template <>
+  struct TypedFormat<double> {
+    static const PrimitiveType::DType dtype = PrimitiveType::float64;
+  };
+
+  template <typename TYPE>
+  TYPE*
+    typed_node(const TypePtr& type, const char* builder) {
+    TYPE* raw = dynamic_cast<TYPE*>(type.get());
+    if (raw == nullptr) {
+      throw std::invalid_argument(
+        std::string("cannot build type ") + type.get()->tostring()
+        + std::string(" with a ") + std::string(builder));
+    }
+    return raw;
+  }
+
+  ////////// TypedNumpyBuilder
+
+  template <typename T>
+  class EXPORT_SYMBOL TypedNumpyBuilder {
+  public:
+    TypedNumpyBuilder(const ArrayBuilderOptions& options)
+        : parameters_()
+        , buffer_(GrowableBuffer<T>::empty(options)) { }
+
+    TypedNumpyBuilder(const ArrayBuilderOptions& options,
+                      const TypePtr& type)
+        : parameters_(type.get()->parameters())
+        , buffer_(GrowableBuffer<T>::empty(options)) {
+      PrimitiveType* raw =
+        typed_node<PrimitiveType>(type, "TypedNumpyBuilder");
+      if (raw->dtype() != TypedFormat<T>::dtype) {
+        throw std::invalid_argument(
+          std::string("cannot build type ") + type.get()->tostring()
+          + std::string(" with a TypedNumpyBuilder of format ")
+          + PrimitiveType::format(TypedFormat<T>::dtype));
+      }
+    }
+
+    int64_t
+      length() const {
+      return buffer_.length();
+    }
+
+    void
+      append(T x) {
+      buffer_.append(x);
+    }
+
+    void
+      extend(const T* x, int64_t length) {
+      buffer_.extend(x, length);
+    }
+
+    void
+      clear() {
+      buffer_.clear();
+    }
+
+    void
+      shrink_to_fit() {
+      buffer_.shrink_to_fit();
+    }
+
+    const ContentPtr
+      snapshot() const {
+      std::vector<ssize_t> shape = { (ssize_t)buffer_.length() };
+      std::vector<ssize_t> strides = { (ssize_t)sizeof(T) };
+      return std::make_shared<NumpyArray>(Identities::none(),
+                                          parameters_,
+                                          buffer_.ptr(),
+                                          shape,
+                                          strides,
+                                          0,
+                                          sizeof(T),
+                                          PrimitiveType::format(
+                                            TypedFormat<T>::dtype));
+    }
+
+    // Like ArrayBuilder::finish: the array takes the buffers, trimmed to
+    // size, and the builder starts over.
+    const ContentPtr
+      finish() {
+      shrink_to_fit();
+      ContentPtr out = snapshot();
+      clear();
+      return out;
+    }
+
+  private:
+    const util::Parameters parameters_;
+    GrowableBuffer<T> buffer_;
+  };
+
+  ////////// TypedStringBuilder
+
+  class EXPORT_SYMBOL TypedStringBuilder {
+  public:
+    // UTF-8 strings.
+    TypedStringBuilder(const ArrayBuilderOptions& options)
+        : TypedStringBuilder(options, true) { }
+
+    TypedStringBuilder(const ArrayBuilderOptions& options, bool utf8)
+        : parameters_()
+        , offsets_(GrowableBuffer<int64_t>::full(options, 0, 1))
+        , content_(GrowableBuffer<uint8_t>::empty(options)) {
+      parameters_["__array__"] = utf8 ? std::string("\"string\"")
+                                      : std::string("\"bytestring\"");
+    }
+
+    TypedStringBuilder(const ArrayBuilderOptions& options,
+                       const TypePtr& type)
+        : parameters_(type.get()->parameters())
+        , offsets_(GrowableBuffer<int64_t>::full(options, 0, 1))
+        , content_(GrowableBuffer<uint8_t>::empty(options)) {
+      // A list of uint8, as "string" of "char" or "bytestring" of "byte".
+      TypePtr content =
+        typed_node<ListType>(type, "TypedStringBuilder")->type();
+      PrimitiveType* raw = dynamic_cast<PrimitiveType*>(content.get());
+      bool utf8 = type.get()->parameter_equals("__array__", "\"string\"");
+      if (raw == nullptr  ||
+          raw->dtype() != PrimitiveType::uint8  ||
+          !(utf8  ||
+            type.get()->parameter_equals("__array__", "\"bytestring\""))  ||
+          !content.get()->parameter_equals(
+            "__array__", utf8 ? "\"char\"" : "\"byte\"")) {
+        throw std::invalid_argument(
+          std::string("cannot build type ") + type.get()->tostring()
+          + std::string(" with a TypedStringBuilder"));
+      }
+    }
+
+    int64_t
+      length() const {
+      return offsets_.length() - 1;
+    }
+
+    void
+      append(const char* x, int64_t length) {
+      content_.extend(reinterpret_cast<const uint8_t*>(x), length);
+      offsets_.append(content_.length());
+    }
+
+    void
+      append(const std::string& x) {
+      append(x.c_str(), (int64_t)x.length());
+    }
+
+    void
+      clear() {
+      offsets_.clear();
+      offsets_.append(0);
+      content_.clear();
+    }
+
+    void
+      shrink_to_fit() {
+      offsets_.shrink_to_fit();
+      content_.shrink_to_fit();
+    }
+
+    const ContentPtr
+      snapshot() const {
+      util::Parameters char_parameters;
+      if (parameters_.at("__array__") == std::string("\"string\"")) {
+        char_parameters["__array__"] = std::string("\"char\"");
+      }
+      else {
+        char_parameters["__array__"] = std::string("\"byte\"");
+      }
+      Index64 offsets(offsets_.ptr(), 0, offsets_.length());
+      std::vector<ssize_t> shape = { (ssize_t)content_.length() };
+      std::vector<ssize_t> strides = { (ssize_t)sizeof(uint8_t) };
+      ContentPtr content = std::make_shared<NumpyArray>(Identities::none(),
+                                                        char_parameters,
+                                                        content_.ptr(),
+                                                        shape,
+                                                        strides,
+                                                        0,
+                                                        sizeof(uint8_t),
+                                                        "B");
+      return std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                 parameters_,
+                                                 offsets,
+                                                 content);
+    }
+
+    const ContentPtr
+      finish() {
+      shrink_to_fit();
+      ContentPtr out = snapshot();
+      clear();
+      return out;
+    }
+
+  private:
+    util::Parameters parameters_;
+    GrowableBuffer<int64_t> offsets_;
+    GrowableBuffer<uint8_t> content_;
+  };
+
+  ////////// TypedListBuilder
+
+  // Variable-length lists: fill content() (or the reference that
+  // begin_list returns) with one list's items, then end_list.
+  template <typename CONTENT>
+  class EXPORT_SYMBOL TypedListBuilder {
+  public:
+    TypedListBuilder(const ArrayBuilderOptions& options)
+        : parameters_()
+        , offsets_(GrowableBuffer<int64_t>::full(options, 0, 1))
+        , content_(options) { }
+
+    TypedListBuilder(const ArrayBuilderOptions& options, const TypePtr& type)
+        : parameters_(type.get()->parameters())
+        , offsets_(GrowableBuffer<int64_t>::full(options, 0, 1))
+        , content_(options,
+                   typed_node<ListType>(type, "TypedListBuilder")->type()) { }
+
+    int64_t
+      length() const {
+      return offsets_.length() - 1;
+    }
+
+    CONTENT&
+      content() {
+      return content_;
+    }
+
+    CONTENT&
+      begin_list() {
+      return content_;
+    }
+
+    void
+      end_list() {
+      offsets_.append(content_.length());
+    }
+
+    void
+      clear() {
+      offsets_.clear();
+      offsets_.append(0);
+      content_.clear();
+    }
+
+    void
+      shrink_to_fit() {
+      offsets_.shrink_to_fit();
+      content_.shrink_to_fit();
+    }
+
+    const ContentPtr
+      snapshot() const {
+      Index64 offsets(offsets_.ptr(), 0, offsets_.length());
+      return std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                 parameters_,
+                                                 offsets,
+                                                 content_.snapshot());
+    }
+
+    const ContentPtr
+      finish() {
+      shrink_to_fit();
+      ContentPtr out = snapshot();
+      clear();
+      return out;
+    }
+
+  private:
+    const util::Parameters parameters_;
+    GrowableBuffer<int64_t> offsets_;
+    CONTENT content_;
+  };
+
+  ////////// TypedRegularBuilder
+
+  // Lists of exactly size items each; end_list checks the count. Without
+  // a size (as a record field, say), the first list sets it.
+  template <typename CONTENT>
+  class EXPORT_SYMBOL TypedRegularBuilder {
+  public:
+    TypedRegularBuilder(const ArrayBuilderOptions& options)
+        : TypedRegularBuilder(options, -1) { }
+
+    TypedRegularBuilder(const ArrayBuilderOptions& options, int64_t size)
+        : parameters_()
+        , size_(size)
+        , length_(0)
+        , content_(options) { }
+
+    TypedRegularBuilder(const ArrayBuilderOptions& options,
+                        const TypePtr& type)
+        : parameters_(type.get()->parameters())
+        , size_(typed_node<RegularType>(type, "TypedRegularBuilder")->size())
+        , length_(0)
+        , content_(options,
+                   dynamic_cast<RegularType*>(type.get())->type()) { }
+
+    int64_t
+      length() const {
+      return length_;
+    }
+
+    int64_t
+      size() const {
+      return size_;
+    }
+
+    CONTENT&
+      content() {
+      return content_;
+    }
+
+    CONTENT&
+      begin_list() {
+      return content_;
+    }
+
+    void
+      end_list() {
+      int64_t size = (size_ < 0 ? content_.length() : size_);
+      if (content_.length() != (length_ + 1)*size) {
+        throw std::invalid_argument(
+          std::string("TypedRegularBuilder list ") + std::to_string(length_)
+          + std::string(" does not have ") + std::to_string(size)
+          + std::string(" items"));
+      }
+      size_ = size;
+      length_++;
+    }
+
+    void
+      clear() {
+      length_ = 0;
+      content_.clear();
+    }
+
+    void
+      shrink_to_fit() {
+      content_.shrink_to_fit();
+    }
+
+    const ContentPtr
+      snapshot() const {
+      return std::make_shared<RegularArray>(Identities::none(),
+                                            parameters_,
+                                            content_.snapshot(),
+                                            size_ < 0 ? 0 : size_);
+    }
+
+    const ContentPtr
+      finish() {
+      shrink_to_fit();
+      ContentPtr out = snapshot();
+      clear();
+      return out;
+    }
+
+  private:
+    const util::Parameters parameters_;
+    int64_t size_;
+    int64_t length_;
+    CONTENT content_;
+  };
+
+  ////////// TypedOptionBuilder
+
+  // Each item is either null() or valid(), which returns the content
+  // builder to fill with exactly one item.
+  template <typename CONTENT>
+  class EXPORT_SYMBOL TypedOptionBuilder {
+  public:
+    TypedOptionBuilder(const ArrayBuilderOptions& options)
+        : parameters_()
+        , index_(GrowableBuffer<int64_t>::empty(options))
+        , content_(options) { }
+
+    TypedOptionBuilder(const ArrayBuilderOptions& options,
+                       const TypePtr& type)
+        : parameters_(type.get()->parameters())
+        , index_(GrowableBuffer<int64_t>::empty(options))
+        , content_(options,
+                   typed_node<OptionType>(type,
+                                          "TypedOptionBuilder")->type()) { }
+
+    int64_t
+      length() const {
+      return index_.length();
+    }
+
+    void
+      null() {
+      index_.append(-1);
+    }
+
+    CONTENT&
+      valid() {
+      index_.append(content_.length());
+      return content_;
+    }
+
+    void
+      clear() {
+      index_.clear();
+      content_.clear();
+    }
+
+    void
+      shrink_to_fit() {
+      index_.shrink_to_fit();
+      content_.shrink_to_fit();
+    }
+
+    const ContentPtr
+      snapshot() const {
+      Index64 index(index_.ptr(), 0, index_.length());
+      return std::make_shared<IndexedOptionArray64>(Identities::none(),
+                                                    parameters_,
+                                                    index,
+                                                    content_.snapshot());
+    }
+
+    const ContentPtr
+      finish() {
+      shrink_to_fit();
+      ContentPtr out = snapshot();
+      clear();
+      return out;
+    }
+
+  private:
+    const util::Parameters parameters_;
+    GrowableBuffer<int64_t> index_;
+    CONTENT content_;
+  };
+
+  ////////// TypedRecordBuilder
+
+  template <int64_t... INDEXES>
+  struct typed_indexes { };
+
+  template <int64_t N, int64_t... INDEXES>
+  struct make_typed_indexes: make_typed_indexes<N - 1, N - 1, INDEXES...> { };
+
+  template <int64_t... INDEXES>
+  struct make_typed_indexes<0, INDEXES...> {
+    using type = typed_indexes<INDEXES...>;
+  };
+
+  // Applies an operation to each field of a TypedRecordBuilder.
+  template <int64_t I, int64_t N>
+  struct typed_fields {
+    template <typename TUPLE>
+    static void
+      clear(TUPLE& contents) {
+      std::get<I>(contents).clear();
+      typed_fields<I + 1, N>::clear(contents);
+    }
+    template <typename TUPLE>
+    static void
+      shrink_to_fit(TUPLE& contents) {
+      std::get<I>(contents).shrink_to_fit();
+      typed_fields<I + 1, N>::shrink_to_fit(contents);
+    }
+    template <typename TUPLE>
+    static void
+      snapshot(const TUPLE& contents, ContentPtrVec& out) {
+      out.push_back(std::get<I>(contents).snapshot());
+      typed_fields<I + 1, N>::snapshot(contents, out);
+    }
+    // The first field that does not have this length, or -1 if none.
+    template <typename TUPLE>
+    static int64_t
+      mislength(const TUPLE& contents, int64_t length) {
+      if (std::get<I>(contents).length() != length) {
+        return I;
+      }
+      return typed_fields<I + 1, N>::mislength(contents, length);
+    }
+  };
+
+  template <int64_t N>
+  struct typed_fields<N, N> {
+    template <typename TUPLE>
+    static void
+      clear(TUPLE&) { }
+    template <typename TUPLE>
+    static void
+      shrink_to_fit(TUPLE&) { }
+    template <typename TUPLE>
+    static void
+      snapshot(const TUPLE&, ContentPtrVec&) { }
+    template <typename TUPLE>
+    static int64_t
+      mislength(const TUPLE&, int64_t) {
+      return -1;
+    }
+  };
+
+  // Records (or tuples, if there are no keys): fill each field<i>() with
+  // exactly one item, then end_record.
+  template <typename... CONTENTS>
+  class EXPORT_SYMBOL TypedRecordBuilder {
+  public:
+    using Contents = std::tuple<CONTENTS...>;
+    static const int64_t numfields = (int64_t)sizeof...(CONTENTS);
+
+    TypedRecordBuilder(const ArrayBuilderOptions& options)
+        : TypedRecordBuilder(options, std::vector<std::string>()) { }
+
+    TypedRecordBuilder(const ArrayBuilderOptions& options,
+                       const std::vector<std::string>& keys)
+        : parameters_()
+        , recordlookup_(nullptr)
+        , length_(0)
+        , contents_(CONTENTS(options)...) {
+      if (!keys.empty()) {
+        if ((int64_t)keys.size() != numfields) {
+          throw std::invalid_argument(
+            std::string("TypedRecordBuilder has ") + std::to_string(numfields)
+            + std::string(" fields, but ") + std::to_string(keys.size())
+            + std::string(" keys were given"));
+        }
+        recordlookup_ = std::make_shared<util::RecordLookup>(keys);
+      }
+    }
+
+    TypedRecordBuilder(const ArrayBuilderOptions& options,
+                       const TypePtr& type)
+        : TypedRecordBuilder(
+            options,
+            type,
+            fieldtypes(type),
+            typename make_typed_indexes<sizeof...(CONTENTS)>::type()) { }
+
+    int64_t
+      length() const {
+      return length_;
+    }
+
+    template <int64_t I>
+    typename std::tuple_element<I, Contents>::type&
+      field() {
+      return std::get<I>(contents_);
+    }
+
+    void
+      end_record() {
+      int64_t field = typed_fields<0, numfields>::mislength(contents_,
+                                                            length_ + 1);
+      if (field != -1) {
+        throw std::invalid_argument(
+          std::string("TypedRecordBuilder record ") + std::to_string(length_)
+          + std::string(" does not have exactly one item in field ")
+          + std::to_string(field));
+      }
+      length_++;
+    }
+
+    void
+      clear() {
+      length_ = 0;
+      typed_fields<0, numfields>::clear(contents_);
+    }
+
+    void
+      shrink_to_fit() {
+      typed_fields<0, numfields>::shrink_to_fit(contents_);
+    }
+
+    const ContentPtr
+      snapshot() const {
+      ContentPtrVec contents;
+      typed_fields<0, numfields>::snapshot(contents_, contents);
+      return std::make_shared<RecordArray>(Identities::none(),
+                                           parameters_,
+                                           contents,
+                                           recordlookup_,
+                                           length_);
+    }
+
+    const ContentPtr
+      finish() {
+      shrink_to_fit();
+      ContentPtr out = snapshot();
+      clear();
+      return out;
+    }
+
+  private:
+    static const std::vector<TypePtr>
+      fieldtypes(const TypePtr& type) {
+      RecordType* raw = typed_node<RecordType>(type, "TypedRecordBuilder");
+      if (raw->numfields() != numfields) {
+        throw std::invalid_argument(
+          std::string("cannot build type ") + type.get()->tostring()
+          + std::string(" with a TypedRecordBuilder of ")
+          + std::to_string(numfields) + std::string(" fields"));
+      }
+      return raw->types();
+    }
+
+    template <int64_t... INDEXES>
+    TypedRecordBuilder(const ArrayBuilderOptions& options,
+                       const TypePtr& type,
+                       const std::vector<TypePtr>& types,
+                       typed_indexes<INDEXES...>)
+        : parameters_(type.get()->parameters())
+        , recordlookup_(
+            dynamic_cast<RecordType*>(type.get())->recordlookup())
+        , length_(0)
+        , contents_(CONTENTS(options, types[INDEXES])...) { }
+
+    const util::Parameters parameters_;
+    util::RecordLookupPtr recordlookup_;
+    int64_t length_;
+    Contents contents_;
+  };
+}
+
+#endif // AWKWARD_TYPEDBUILDER_H_
@@ -140,6 +140,12 @@ extern "C" {
       int64_t* toptr,
       int64_t length);
 
+  EXPORT_SYMBOL struct Error
+    awkward_carry_check_64(
+      const int64_t* carry,
+      int64_t lencarry,
+      int64_t length);
+
   EXPORT_SYMBOL struct Error
     awkward_identities32_getitem_carry_64(
       int32_t* newidentitiesptr,
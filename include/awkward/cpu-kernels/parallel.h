@@ -0,0 +1,139 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARDCPU_PARALLEL_H_
+#define AWKWARDCPU_PARALLEL_H_
+
+#include <functional>
+#include <vector>
+
+#include "awkward/cpu-kernels/util.h"
+
+extern "C" {
+  // numthreads includes the calling thread; 1 (the default) is serial and
+  // 0 means std::thread::hardware_concurrency().
+  EXPORT_SYMBOL void
+    awkward_parallel_set_numthreads(int64_t numthreads);
+  EXPORT_SYMBOL int64_t
+    awkward_parallel_numthreads();
+
+  // Minimum number of items per chunk; shorter inputs run serially.
+  EXPORT_SYMBOL void
+    awkward_parallel_set_threshold(int64_t threshold);
+  EXPORT_SYMBOL int64_t
+    awkward_parallel_threshold();
+}
+
+EXPORT_SYMBOL int64_t
+  awkward_parallel_numchunks(int64_t length);
+
+EXPORT_SYMBOL void
+  awkward_parallel_run(int64_t numchunks,
+                       const std::function<void(int64_t)>& task);
+
+// Calls body(start, stop) on ordered, contiguous chunks of [0, length). If
+// more than one chunk fails, the earliest failure is returned, which is the
+// same Error that the serial loop would have returned.
+template <typename F>
+struct Error
+  awkward_parallel_for(int64_t length, const F& body) {
+  int64_t numchunks = awkward_parallel_numchunks(length);
+  if (numchunks <= 1) {
+    return body(0, length);
+  }
+  std::vector<struct Error> errors((size_t)numchunks, success());
+  awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+    int64_t start = (length * chunk) / numchunks;
+    int64_t stop = (length * (chunk + 1)) / numchunks;
+    errors[(size_t)chunk] = body(start, stop);
+  });
+  for (auto err : errors) {
+    if (err.str != nullptr) {
+      return err;
+    }
+  }
+  return success();
+}
+
+// Sums count(i) over [0, length) in chunks; T must be an integer type, so
+// the result does not depend on the chunking.
+template <typename T, typename F>
+T
+  awkward_parallel_sum(int64_t length, const F& count) {
+  int64_t numchunks = awkward_parallel_numchunks(length);
+  std::vector<T> totals((size_t)numchunks, 0);
+  awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+    int64_t start = (length * chunk) / numchunks;
+    int64_t stop = (length * (chunk + 1)) / numchunks;
+    T total = 0;
+    for (int64_t i = start;  i < stop;  i++) {
+      total += count(i);
+    }
+    totals[(size_t)chunk] = total;
+  });
+  T out = 0;
+  for (auto total : totals) {
+    out += total;
+  }
+  return out;
+}
+
+// Fills tooffsets[0] = 0 and tooffsets[i + 1] = tooffsets[i] + count(i).
+// Large inputs take two passes: per-chunk totals, then per-chunk running
+// sums starting from the total of all earlier chunks. If negative is not
+// nullptr, a negative count(i) is an error with that message (for the
+// earliest such i).
+template <typename T, typename F>
+struct Error
+  awkward_parallel_scan(T* tooffsets,
+                        int64_t length,
+                        const F& count,
+                        const char* negative) {
+  tooffsets[0] = 0;
+  int64_t numchunks = awkward_parallel_numchunks(length);
+  if (numchunks <= 1) {
+    for (int64_t i = 0;  i < length;  i++) {
+      T x = count(i);
+      if (negative != nullptr  &&  x < 0) {
+        return failure(negative, i, kSliceNone);
+      }
+      tooffsets[i + 1] = tooffsets[i] + x;
+    }
+    return success();
+  }
+  std::vector<T> totals((size_t)numchunks + 1, 0);
+  std::vector<int64_t> failures((size_t)numchunks, -1);
+  awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+    int64_t start = (length * chunk) / numchunks;
+    int64_t stop = (length * (chunk + 1)) / numchunks;
+    T total = 0;
+    for (int64_t i = start;  i < stop;  i++) {
+      T x = count(i);
+      if (negative != nullptr  &&  x < 0) {
+        failures[(size_t)chunk] = i;
+        return;
+      }
+      total += x;
+    }
+    totals[(size_t)chunk + 1] = total;
+  });
+  for (auto i : failures) {
+    if (i >= 0) {
+      return failure(negative, i, kSliceNone);
+    }
+  }
+  for (int64_t chunk = 0;  chunk < numchunks;  chunk++) {
+    totals[(size_t)chunk + 1] += totals[(size_t)chunk];
+  }
+  awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+    int64_t start = (length * chunk) / numchunks;
+    int64_t stop = (length * (chunk + 1)) / numchunks;
+    T running = totals[(size_t)chunk];
+    for (int64_t i = start;  i < stop;  i++) {
+      running += count(i);
+      tooffsets[i + 1] = running;
+    }
+  });
+  return success();
+}
+
+#endif // AWKWARDCPU_PARALLEL_H_
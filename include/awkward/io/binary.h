@@ -0,0 +1,31 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_IO_BINARY_H_
+#define AWKWARD_IO_BINARY_H_
+
+#include <string>
+
+#include "awkward/cpu-kernels/util.h"
+#include "awkward/util.h"
+#include "awkward/Content.h"
+
+namespace awkward {
+  // The binary format is a header that describes the layout nodes and their
+  // parameters, followed by the raw Index and NumpyArray buffers, each one
+  // aligned to kBinaryAlignment bytes. Identities are not written. Buffers
+  // are in native byte order; reading a file written with the other byte
+  // order is an error.
+  const int64_t kBinaryAlignment = 64;
+
+  EXPORT_SYMBOL void
+    ToBinaryFile(const ContentPtr& layout, const std::string& path);
+
+  // With mmap, the file is memory-mapped (copy-on-write) and every buffer of
+  // the returned layout points into the mapping, which is unmapped when the
+  // last of them is deleted; pages are only read when they are accessed.
+  // Without mmap, or on platforms without mmap, the file is read into memory.
+  EXPORT_SYMBOL const ContentPtr
+    FromBinaryFile(const std::string& path, bool mmap);
+}
+
+#endif // AWKWARD_IO_BINARY_H_
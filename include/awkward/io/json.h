@@ -9,6 +9,7 @@
 #include "awkward/builder/ArrayBuilderOptions.h"
 #include "awkward/cpu-kernels/util.h"
 #include "awkward/util.h"
+#include "awkward/type/Type.h"
 
 namespace awkward {
   class Content;
@@ -20,6 +21,63 @@ namespace awkward {
                  const ArrayBuilderOptions& options,
                  int64_t buffersize);
 
+  // Reads JSON as a known type (usually an ArrayType, whose length is used
+  // to preallocate) instead of discovering the type: each node of the type
+  // has its own typed buffers, filled as values are parsed. Union types are
+  // not supported. A missing record field (or tuple item) of option type is
+  // None; any other missing field, unknown field, extra tuple item, or value
+  // that does not match the type is an error. With nullfill, unknown fields
+  // and extra tuple items are skipped and a mismatched value at an
+  // option-type node becomes None (mismatches at other nodes and missing
+  // fields of other types are still errors).
+  EXPORT_SYMBOL const ContentPtr
+    FromJsonString(const char* source,
+                   const TypePtr& type,
+                   const ArrayBuilderOptions& options,
+                   bool nullfill);
+  EXPORT_SYMBOL const ContentPtr
+    FromJsonFile(FILE* source,
+                 const TypePtr& type,
+                 const ArrayBuilderOptions& options,
+                 int64_t buffersize,
+                 bool nullfill);
+
+  // Alternative parse path with simdjson (requires configuring with
+  // -DAWKWARD_SIMDJSON=ON; otherwise, these raise an error). The whole
+  // document is parsed at once and the parsed tape drives the ArrayBuilder
+  // directly, so FromJsonFileSimd reads the whole file into memory.
+  EXPORT_SYMBOL bool
+    SimdJsonAvailable();
+  EXPORT_SYMBOL const ContentPtr
+    FromJsonStringSimd(const char* source, const ArrayBuilderOptions& options);
+  EXPORT_SYMBOL const ContentPtr
+    FromJsonFileSimd(FILE* source,
+                     const ArrayBuilderOptions& options,
+                     int64_t buffersize);
+
+  // Reads newline-delimited JSON (one value per line) in chunks. Each call
+  // to next returns the values since the previous call, stopping after
+  // maxrecords values or maxbytes bytes (zero or negative means no limit),
+  // and returns nullptr at the end of the file. The read buffer is reused
+  // for the whole file, so memory is bounded by the chunk size.
+  class EXPORT_SYMBOL FromJsonLinesFile {
+  public:
+    FromJsonLinesFile(FILE* source,
+                      const ArrayBuilderOptions& options,
+                      int64_t buffersize,
+                      int64_t maxrecords,
+                      int64_t maxbytes);
+    FromJsonLinesFile(const FromJsonLinesFile&) = delete;
+    FromJsonLinesFile&
+      operator=(const FromJsonLinesFile&) = delete;
+    ~FromJsonLinesFile();
+    const ContentPtr
+      next();
+  private:
+    class Impl;
+    Impl* impl_;
+  };
+
   class EXPORT_SYMBOL ToJson {
   public:
     virtual void
@@ -42,6 +100,33 @@ namespace awkward {
       field(const char* x) = 0;
     virtual void
       endrecord() = 0;
+
+    // Bulk versions of boolean, integer, and real: each writes a whole list
+    // of length values that are stride bytes apart. These defaults call the
+    // scalar methods; ToJsonString and ToJsonFile write the numbers directly
+    // into their output buffers.
+    virtual void
+      boolean_array(const bool* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const int8_t* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const uint8_t* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const int16_t* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const uint16_t* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const int32_t* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const uint32_t* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const int64_t* x, int64_t length, int64_t stride);
+    virtual void
+      integer_array(const uint64_t* x, int64_t length, int64_t stride);
+    virtual void
+      real_array(const float* x, int64_t length, int64_t stride);
+    virtual void
+      real_array(const double* x, int64_t length, int64_t stride);
   };
 
   class EXPORT_SYMBOL ToJsonString: public ToJson {
@@ -68,6 +153,28 @@ namespace awkward {
       field(const char* x) override;
     void
       endrecord() override;
+    void
+      boolean_array(const bool* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int8_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint8_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int16_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint16_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int32_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint32_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int64_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint64_t* x, int64_t length, int64_t stride) override;
+    void
+      real_array(const float* x, int64_t length, int64_t stride) override;
+    void
+      real_array(const double* x, int64_t length, int64_t stride) override;
     const std::string
       tostring();
   private:
@@ -130,6 +237,28 @@ namespace awkward {
       field(const char* x) override;
     void
       endrecord() override;
+    void
+      boolean_array(const bool* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int8_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint8_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int16_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint16_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int32_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint32_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const int64_t* x, int64_t length, int64_t stride) override;
+    void
+      integer_array(const uint64_t* x, int64_t length, int64_t stride) override;
+    void
+      real_array(const float* x, int64_t length, int64_t stride) override;
+    void
+      real_array(const double* x, int64_t length, int64_t stride) override;
   private:
     class Impl;
     Impl* impl_;
@@ -14,6 +14,13 @@
 #include "awkward/array/NumpyArray.h"
 
 namespace awkward {
+  // Reads ROOT's serialization of std::vector<...std::vector<T>...> (depth
+  // levels of std::vector) into nested ListOffsetArray64s. Entries are read
+  // in two passes, the first to size every buffer exactly and the second
+  // to fill it, and both passes are split across the cpu-kernels thread
+  // pool (see awkward_parallel_set_numthreads). A big- or little-endian
+  // format ('>', '!', '<') is converted to native byte order and returned
+  // without its prefix. The options are unused, since nothing is grown.
   EXPORT_SYMBOL const ContentPtr
     FromROOT_nestedvector(const Index64& byteoffsets,
                           const NumpyArray& rawdata,
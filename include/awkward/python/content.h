@@ -29,6 +29,13 @@ namespace ak = awkward;
 ak::Slice
   toslice(py::object obj);
 
+py::list
+  reduce_multi(const py::iterable& arrays,
+               const std::vector<std::string>& reducers,
+               int64_t axis,
+               bool mask,
+               bool keepdims);
+
 py::class_<ak::ArrayBuilder>
   make_ArrayBuilder(const py::handle& m, const std::string& name);
 
@@ -25,7 +25,10 @@ public:
   pyobject_deleter(PyObject *pyobj): pyobj_(pyobj) {
     Py_INCREF(pyobj_);
   }
+  // The last reference to an array may be dropped while the GIL is
+  // released (or in another thread), so take it before touching Python.
   void operator()(T const *p) {
+    py::gil_scoped_acquire acquire;
     Py_DECREF(pyobj_);
   }
 private:
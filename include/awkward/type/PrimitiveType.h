@@ -26,6 +26,13 @@ namespace awkward {
     PrimitiveType(const util::Parameters& parameters,
                   const std::string& typestr, DType dtype);
 
+    // The struct module format of a NumpyArray of this dtype.
+    static const std::string
+      format(DType dtype);
+
+    static int64_t
+      itemsize(DType dtype);
+
     std::string
       tostring_part(const std::string& indent,
                     const std::string& pre,
@@ -37,6 +44,12 @@ namespace awkward {
     bool
       equal(const TypePtr& other, bool check_parameters) const override;
 
+    bool
+      identical(const TypePtr& other) const override;
+
+    size_t
+      hash_part() const override;
+
     int64_t
       numfields() const override;
 
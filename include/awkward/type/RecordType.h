@@ -43,6 +43,12 @@ namespace awkward {
     bool
       equal(const TypePtr& other, bool check_parameters) const override;
 
+    bool
+      identical(const TypePtr& other) const override;
+
+    size_t
+      hash_part() const override;
+
     int64_t
       numfields() const override;
 
@@ -16,12 +16,25 @@ namespace awkward {
   class Type;
   using TypePtr = std::shared_ptr<Type>;
 
+  // Types from Content::type are interned (see intern) and shared between
+  // layouts, so they must not be modified in place: setparameters and
+  // setparameter raise an error for them. Modify a shallow_copy (or any
+  // other copy) instead.
   class EXPORT_SYMBOL Type {
   public:
     static TypePtr none();
 
+    // Returns the one live instance of each identical type, so that two
+    // interned types are identical if and only if they are the same
+    // pointer.
+    static const TypePtr
+      intern(const TypePtr& type);
+
     Type(const util::Parameters& parameters, const std::string& typestr);
 
+    // A copy is never interned, even if the original was.
+    Type(const Type& other);
+
     virtual ~Type();
 
     virtual std::string
@@ -35,6 +48,19 @@ namespace awkward {
     virtual bool
       equal(const TypePtr& other, bool check_parameters) const = 0;
 
+    // Like equal(other, true), but fields must also be in the same order
+    // and typestrs the same all the way down: the same type when printed.
+    virtual bool
+      identical(const TypePtr& other) const = 0;
+
+    // Structural: identical types have the same hash. Stored when the type
+    // is interned, so a parent's hash does not rehash its interned children.
+    size_t
+      hash() const;
+
+    virtual size_t
+      hash_part() const = 0;
+
     virtual int64_t
       numfields() const = 0;
 
@@ -87,8 +113,22 @@ namespace awkward {
     const std::string
       string_parameters() const;
 
+    // The part of hash() and identical() that every Type has.
+    size_t
+      hash_parameters(size_t seed) const;
+
+    bool
+      identical_parameters(const Type& other) const;
+
+    static size_t
+      hash_combine(size_t seed, size_t value);
+
     util::Parameters parameters_;
     const std::string typestr_;
+
+  private:
+    bool interned_;
+    size_t hash_;
   };
 }
 
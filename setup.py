@@ -48,6 +48,10 @@ class CMakeBuild(setuptools.command.build_ext.build_ext):
                       "-DCMAKE_OSX_DEPLOYMENT_TARGET=10.9",
                       "-DPYBUILD=ON",
                       "-DBUILD_TESTING=OFF"]
+        if os.environ.get("AWKWARD_SIMDJSON", "0") not in ("", "0", "OFF", "off"):
+            cmake_args.append("-DAWKWARD_SIMDJSON=ON")
+        if "SIMDJSON_DIR" in os.environ:
+            cmake_args.append("-DSIMDJSON_DIR={0}".format(os.environ["SIMDJSON_DIR"]))
         try:
            compiler_path = self.compiler.compiler_cxx[0]
            cmake_args.append("-DCMAKE_CXX_COMPILER={0}".format(compiler_path))
@@ -19,3 +19,23 @@ else:
 libpath = pkg_resources.resource_filename("awkward1", name)
 
 lib = ctypes.cdll.LoadLibrary(libpath)
+
+# void awkward_parallel_set_numthreads(int64_t numthreads);
+parallel_set_numthreads = lib.awkward_parallel_set_numthreads
+parallel_set_numthreads.argtypes = [ctypes.c_int64]
+parallel_set_numthreads.restype  = None
+
+# int64_t awkward_parallel_numthreads();
+parallel_numthreads = lib.awkward_parallel_numthreads
+parallel_numthreads.argtypes = []
+parallel_numthreads.restype  = ctypes.c_int64
+
+# void awkward_parallel_set_threshold(int64_t threshold);
+parallel_set_threshold = lib.awkward_parallel_set_threshold
+parallel_set_threshold.argtypes = [ctypes.c_int64]
+parallel_set_threshold.restype  = None
+
+# int64_t awkward_parallel_threshold();
+parallel_threshold = lib.awkward_parallel_threshold
+parallel_threshold.argtypes = []
+parallel_threshold.restype  = ctypes.c_int64
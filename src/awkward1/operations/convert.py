@@ -72,7 +72,7 @@ def fromiter(iterable,
     out = awkward1.layout.ArrayBuilder(initial=initial, resize=resize)
     for x in iterable:
         out.fromiter(x)
-    layout = out.snapshot()
+    layout = out.finish()
     if highlevel:
         return awkward1._util.wrap(layout, behavior)
     else:
@@ -83,16 +83,50 @@ def fromjson(source,
              behavior=None,
              initial=1024,
              resize=2.0,
-             buffersize=65536):
+             buffersize=65536,
+             simdjson=False,
+             type=None,
+             nullfill=False):
+    # With simdjson=True, parse with simdjson instead of rapidjson (only if
+    # awkward1 was compiled with AWKWARD_SIMDJSON; see simdjson_available).
+    # With a type (e.g. awkward1.typeof of a similar array), the JSON is read
+    # directly into that layout; mismatches are errors, unless nullfill, in
+    # which case they become None where the type is an option type.
     layout = awkward1._io.fromjson(source,
                                    initial=initial,
                                    resize=resize,
-                                   buffersize=buffersize)
+                                   buffersize=buffersize,
+                                   simdjson=simdjson,
+                                   type=type,
+                                   nullfill=nullfill)
     if highlevel:
         return awkward1._util.wrap(layout, behavior)
     else:
         return layout
 
+def fromjsonlines(source,
+                  chunksize=65536,
+                  chunkbytes=None,
+                  highlevel=True,
+                  behavior=None,
+                  initial=1024,
+                  resize=2.0,
+                  buffersize=65536):
+    # Generator over newline-delimited JSON: yields an array for every
+    # chunksize records or chunkbytes bytes, whichever comes first.
+    reader = awkward1._io.fromjsonlines(
+               source,
+               maxrecords=(0 if chunksize is None else chunksize),
+               maxbytes=(0 if chunkbytes is None else chunkbytes),
+               initial=initial,
+               resize=resize,
+               buffersize=buffersize)
+    for layout in reader:
+        if highlevel:
+            yield awkward1._util.wrap(layout, behavior)
+        else:
+            yield layout
+
 def tonumpy(array):
     import awkward1.highlevel
 
@@ -313,6 +347,29 @@ def tojson(array,
                           maxdecimals=maxdecimals,
                           buffersize=buffersize)
 
+def tobinary(array, destination):
+    import awkward1.highlevel
+
+    if isinstance(array, awkward1.highlevel.Array):
+        layout = array.layout
+    elif isinstance(array, awkward1.highlevel.ArrayBuilder):
+        layout = array.snapshot().layout
+    elif isinstance(array, awkward1.layout.ArrayBuilder):
+        layout = array.snapshot()
+    elif isinstance(array, awkward1.layout.Content):
+        layout = array
+    else:
+        raise TypeError("unrecognized array type: {0}".format(repr(array)))
+
+    awkward1._io.tobinary(layout, destination)
+
+def frombinary(source, mmap=True, highlevel=True, behavior=None):
+    layout = awkward1._io.frombinary(source, mmap=mmap)
+    if highlevel:
+        return awkward1._util.wrap(layout, behavior)
+    else:
+        return layout
+
 def tolayout(array,
              allowrecord=True,
              allowother=False,
@@ -207,37 +207,70 @@ def argmax(array, axis=None, keepdims=False, maskidentity=True):
 # The following are not strictly reducers, but are defined in terms of
 # reducers and ufuncs.
 
+# Applies each (reducer name, array) pair; arrays with the same list
+# structure are reduced in a single traversal.
+def _reduce_multi(pairs, axis, keepdims):
+    if axis is None:
+        reducers = {"count": count, "sum": sum}
+        return [reducers[name](array, axis=None) for name, array in pairs]
+    else:
+        layouts = [awkward1.operations.convert.tolayout(array,
+                                                        allowrecord=False,
+                                                        allowother=False)
+                     for name, array in pairs]
+        behavior = awkward1._util.behaviorof(*[array for name, array in pairs])
+        out = awkward1.layout.reduce_multi(layouts,
+                                           [name for name, array in pairs],
+                                           axis=axis,
+                                           mask=False,
+                                           keepdims=keepdims)
+        return [awkward1._util.wrap(x, behavior) for x in out]
+
+def _sumw(x, weight):
+    if weight is None:
+        return ("count", x)
+    else:
+        return ("sum", x*0 + weight)
+
 def moment(x, n, weight=None, axis=None, keepdims=False):
     with numpy.errstate(invalid="ignore"):
         if weight is None:
-            sumw   = count(x, axis=axis, keepdims=keepdims)
-            sumwxn = sum(x**n, axis=axis, keepdims=keepdims)
+            sumwxn = ("sum", x**n)
         else:
-            sumw   = sum(x*0 + weight, axis=axis, keepdims=keepdims)
-            sumwxn = sum((x*weight)**n, axis=axis, keepdims=keepdims)
+            sumwxn = ("sum", (x*weight)**n)
+        sumw, sumwxn = _reduce_multi([_sumw(x, weight), sumwxn],
+                                     axis,
+                                     keepdims)
         return numpy.true_divide(sumwxn, sumw)
 
 @awkward1._connect._numpy.implements(numpy.mean)
 def mean(x, weight=None, axis=None, keepdims=False):
     with numpy.errstate(invalid="ignore"):
         if weight is None:
-            sumw  = count(x, axis=axis, keepdims=keepdims)
-            sumwx = sum(x, axis=axis, keepdims=keepdims)
+            sumwx = ("sum", x)
         else:
-            sumw  = sum(x*0 + weight, axis=axis, keepdims=keepdims)
-            sumwx = sum(x*weight, axis=axis, keepdims=keepdims)
+            sumwx = ("sum", x*weight)
+        sumw, sumwx = _reduce_multi([_sumw(x, weight), sumwx],
+                                    axis,
+                                    keepdims)
         return numpy.true_divide(sumwx, sumw)
 
 @awkward1._connect._numpy.implements(numpy.var)
 def var(x, weight=None, ddof=0, axis=None, keepdims=False):
     with numpy.errstate(invalid="ignore"):
-        xmean = mean(x, weight=weight, axis=axis, keepdims=keepdims)
         if weight is None:
-            sumw   = count(x, axis=axis, keepdims=keepdims)
-            sumwxx = sum((x - xmean)**2, axis=axis, keepdims=keepdims)
+            sumwx = ("sum", x)
         else:
-            sumw   = sum(x*0 + weight, axis=axis, keepdims=keepdims)
-            sumwxx = sum((x - xmean)**2 * weight, axis=axis, keepdims=keepdims)
+            sumwx = ("sum", x*weight)
+        sumw, sumwx = _reduce_multi([_sumw(x, weight), sumwx],
+                                    axis,
+                                    keepdims)
+        xmean = numpy.true_divide(sumwx, sumw)
+        if weight is None:
+            sumwxx = ("sum", (x - xmean)**2)
+        else:
+            sumwxx = ("sum", (x - xmean)**2 * weight)
+        sumwxx, = _reduce_multi([sumwxx], axis, keepdims)
         if ddof != 0:
             return (numpy.true_divide(sumwxx, sumw) *
                     numpy.true_divide(sumw, sumw - ddof))
@@ -253,50 +286,60 @@ def std(x, weight=None, ddof=0, axis=None, keepdims=False):
                               axis=axis,
                               keepdims=keepdims))
 
+def _means(x, y, weight, axis, keepdims):
+    if weight is None:
+        sumwx = ("sum", x)
+        sumwy = ("sum", y)
+    else:
+        sumwx = ("sum", x*weight)
+        sumwy = ("sum", y*weight)
+    sumw, sumwx, sumwy = _reduce_multi([_sumw(x, weight), sumwx, sumwy],
+                                       axis,
+                                       keepdims)
+    return (sumw,
+            numpy.true_divide(sumwx, sumw),
+            numpy.true_divide(sumwy, sumw))
+
 def covar(x, y, weight=None, axis=None, keepdims=False):
     with numpy.errstate(invalid="ignore"):
-        xmean = mean(x, weight=weight, axis=axis, keepdims=keepdims)
-        ymean = mean(y, weight=weight, axis=axis, keepdims=keepdims)
+        sumw, xmean, ymean = _means(x, y, weight, axis, keepdims)
         if weight is None:
-            sumw = count(x, axis=axis, keepdims=keepdims)
-            sumwxy = sum((x - xmean)*(y - ymean), axis=axis, keepdims=keepdims)
+            sumwxy = ("sum", (x - xmean)*(y - ymean))
         else:
-            sumw = sum(x*0 + weight, axis=axis, keepdims=keepdims)
-            sumwxy = sum((x - xmean)*(y - ymean)*weight,
-                         axis=axis,
-                         keepdims=keepdims)
+            sumwxy = ("sum", (x - xmean)*(y - ymean)*weight)
+        sumwxy, = _reduce_multi([sumwxy], axis, keepdims)
         return numpy.true_divide(sumwxy, sumw)
 
 def corr(x, y, weight=None, axis=None, keepdims=False):
     with numpy.errstate(invalid="ignore"):
-        xmean = mean(x, weight=weight, axis=axis, keepdims=keepdims)
-        ymean = mean(y, weight=weight, axis=axis, keepdims=keepdims)
+        sumw, xmean, ymean = _means(x, y, weight, axis, keepdims)
         xdiff = x - xmean
         ydiff = y - ymean
         if weight is None:
-            sumwxx = sum(xdiff**2, axis=axis, keepdims=keepdims)
-            sumwyy = sum(ydiff**2, axis=axis, keepdims=keepdims)
-            sumwxy = sum(xdiff*ydiff, axis=axis, keepdims=keepdims)
+            pairs = [("sum", xdiff**2),
+                     ("sum", ydiff**2),
+                     ("sum", xdiff*ydiff)]
         else:
-            sumwxx = sum((xdiff**2)*weight, axis=axis, keepdims=keepdims)
-            sumwyy = sum((ydiff**2)*weight, axis=axis, keepdims=keepdims)
-            sumwxy = sum((xdiff*ydiff)*weight, axis=axis, keepdims=keepdims)
+            pairs = [("sum", (xdiff**2)*weight),
+                     ("sum", (ydiff**2)*weight),
+                     ("sum", (xdiff*ydiff)*weight)]
+        sumwxx, sumwyy, sumwxy = _reduce_multi(pairs, axis, keepdims)
         return numpy.true_divide(sumwxy, numpy.sqrt(sumwxx * sumwyy))
 
 def linearfit(x, y, weight=None, axis=None, keepdims=False):
     with numpy.errstate(invalid="ignore"):
         if weight is None:
-            sumw = count(x, axis=axis, keepdims=keepdims)
-            sumwx  = sum(x, axis=axis, keepdims=keepdims)
-            sumwy  = sum(y, axis=axis, keepdims=keepdims)
-            sumwxx = sum(x**2, axis=axis, keepdims=keepdims)
-            sumwxy = sum(x*y, axis=axis, keepdims=keepdims)
+            pairs = [("sum", x),
+                     ("sum", y),
+                     ("sum", x**2),
+                     ("sum", x*y)]
         else:
-            sumw = sum(x*0 + weight, axis=axis, keepdims=keepdims)
-            sumwx  = sum(x*weight, axis=axis, keepdims=keepdims)
-            sumwy  = sum(y*weight, axis=axis, keepdims=keepdims)
-            sumwxx = sum((x**2)*weight, axis=axis, keepdims=keepdims)
-            sumwxy = sum(x*y*weight, axis=axis, keepdims=keepdims)
+            pairs = [("sum", x*weight),
+                     ("sum", y*weight),
+                     ("sum", (x**2)*weight),
+                     ("sum", x*y*weight)]
+        sumw, sumwx, sumwy, sumwxx, sumwxy = _reduce_multi(
+            [_sumw(x, weight)] + pairs, axis, keepdims)
         delta           = (sumw*sumwxx) - (sumwx*sumwx)
         intercept       = numpy.true_divide(((sumwxx*sumwy) - (sumwx*sumwxy)),
                                             delta)
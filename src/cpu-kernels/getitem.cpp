@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/parallel.h"
 
 void awkward_regularize_rangeslice(
   int64_t* start,
@@ -110,14 +111,17 @@ ERROR awkward_index_carry(
   int64_t fromindexoffset,
   int64_t lenfromindex,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    T j = carry[i];
-    if (j > lenfromindex) {
-      return failure("index out of range", kSliceNone, j);
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      T j = carry[i];
+      if (j > lenfromindex) {
+        return failure("index out of range", kSliceNone, j);
+      }
+      toindex[i] = fromindex[(size_t)(fromindexoffset + j)];
     }
-    toindex[i] = fromindex[(size_t)(fromindexoffset + j)];
-  }
-  return success();
+    return success();
+  };
+  return awkward_parallel_for(length, body);
 }
 ERROR awkward_index8_carry_64(
   int8_t* toindex,
@@ -202,10 +206,13 @@ ERROR awkward_index_carry_nocheck(
   const T* carry,
   int64_t fromindexoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toindex[i] = fromindex[(size_t)(fromindexoffset + carry[i])];
-  }
-  return success();
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toindex[i] = fromindex[(size_t)(fromindexoffset + carry[i])];
+    }
+    return success();
+  };
+  return awkward_parallel_for(length, body);
 }
 ERROR awkward_index8_carry_nocheck_64(
   int8_t* toindex,
@@ -350,6 +357,31 @@ ERROR awkward_carry_arange_64(
     length);
 }
 
+template <typename T>
+ERROR awkward_carry_check(
+  const T* carry,
+  int64_t lencarry,
+  int64_t length) {
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      if (carry[i] < 0  ||  carry[i] >= length) {
+        return failure("index out of range", kSliceNone, carry[i]);
+      }
+    }
+    return success();
+  };
+  return awkward_parallel_for(lencarry, body);
+}
+ERROR awkward_carry_check_64(
+  const int64_t* carry,
+  int64_t lencarry,
+  int64_t length) {
+  return awkward_carry_check<int64_t>(
+    carry,
+    lencarry,
+    length);
+}
+
 template <typename ID, typename T>
 ERROR awkward_identities_getitem_carry(
   ID* newidentitiesptr,
@@ -433,12 +465,15 @@ ERROR awkward_numpyarray_contiguous_copy(
   int64_t stride,
   int64_t offset,
   const T* pos) {
-  for (int64_t i = 0;  i < len;  i++) {
-    memcpy(&toptr[i*stride],
-           &fromptr[offset + (int64_t)pos[i]],
-           (size_t)stride);
-  }
-  return success();
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      memcpy(&toptr[i*stride],
+             &fromptr[offset + (int64_t)pos[i]],
+             (size_t)stride);
+    }
+    return success();
+  };
+  return awkward_parallel_for(len, body);
 }
 ERROR awkward_numpyarray_contiguous_copy_64(
   uint8_t* toptr,
@@ -492,12 +527,15 @@ ERROR awkward_numpyarray_getitem_next_null(
   int64_t stride,
   int64_t offset,
   const T* pos) {
-  for (int64_t i = 0;  i < len;  i++) {
-    std::memcpy(&toptr[i*stride],
-                &fromptr[offset + pos[i]*stride],
-                (size_t)stride);
-  }
-  return success();
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      std::memcpy(&toptr[i*stride],
+                  &fromptr[offset + pos[i]*stride],
+                  (size_t)stride);
+    }
+    return success();
+  };
+  return awkward_parallel_for(len, body);
 }
 ERROR awkward_numpyarray_getitem_next_null_64(
   uint8_t* toptr,
@@ -1,8 +1,10 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
 #include <cstring>
+#include <vector>
 
 #include "awkward/cpu-kernels/operations.h"
+#include "awkward/cpu-kernels/parallel.h"
 
 template <typename T, typename C>
 ERROR awkward_listarray_num(
@@ -94,11 +96,14 @@ ERROR awkward_listoffsetarray_flatten_offsets(
   const T* inneroffsets, 
   int64_t inneroffsetsoffset, 
   int64_t inneroffsetslen) {
-  for (int64_t i = 0;  i < outeroffsetslen;  i++) {
-    tooffsets[i] =
-      inneroffsets[inneroffsetsoffset + outeroffsets[outeroffsetsoffset + i]];
-  }
-  return success();
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      tooffsets[i] =
+        inneroffsets[inneroffsetsoffset + outeroffsets[outeroffsetsoffset + i]];
+    }
+    return success();
+  };
+  return awkward_parallel_for(outeroffsetslen, body);
 }
 ERROR awkward_listoffsetarray32_flatten_offsets_64(
   int64_t* tooffsets, 
@@ -837,16 +842,15 @@ ERROR awkward_listarray_compact_offsets(
   int64_t startsoffset,
   int64_t stopsoffset,
   int64_t length) {
-  tooffsets[0] = 0;
-  for (int64_t i = 0;  i < length;  i++) {
+  auto count = [&](int64_t i) -> T {
     C start = fromstarts[startsoffset + i];
     C stop = fromstops[stopsoffset + i];
-    if (stop < start) {
-      return failure("stops[i] < starts[i]", i, kSliceNone);
-    }
-    tooffsets[i + 1] = tooffsets[i] + (stop - start);
-  }
-  return success();
+    return (stop < start ? -1 : (T)(stop - start));
+  };
+  return awkward_parallel_scan(tooffsets,
+                               length,
+                               count,
+                               "stops[i] < starts[i]");
 }
 ERROR awkward_listarray32_compact_offsets64(
   int64_t* tooffsets,
@@ -952,28 +956,49 @@ ERROR awkward_listarray_broadcast_tooffsets(
   const C* fromstops,
   int64_t stopsoffset,
   int64_t lencontent) {
-  int64_t k = 0;
-  for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-    int64_t start = (int64_t)fromstarts[startsoffset + i];
-    int64_t stop = (int64_t)fromstops[stopsoffset + i];
-    if (start != stop  &&  stop > lencontent) {
-      return failure("stops[i] > len(content)", i, stop);
-    }
-    int64_t count = (int64_t)(fromoffsets[offsetsoffset + i + 1] -
-                              fromoffsets[offsetsoffset + i]);
-    if (count < 0) {
-      return failure(
-        "broadcast's offsets must be monotonically increasing", i, kSliceNone);
-    }
-    if (stop - start != count) {
-      return failure("cannot broadcast nested list", i, kSliceNone);
+  // Every list has exactly as many items as the offsets say (or it's an
+  // error), so list i starts at offsets[i] - offsets[0] in tocarry. All
+  // lists are checked before any are filled: with non-monotonic offsets,
+  // a later list could otherwise be written past the end of tocarry.
+  auto check = [&](int64_t first, int64_t last) -> Error {
+    for (int64_t i = first;  i < last;  i++) {
+      int64_t start = (int64_t)fromstarts[startsoffset + i];
+      int64_t stop = (int64_t)fromstops[stopsoffset + i];
+      if (start != stop  &&  stop > lencontent) {
+        return failure("stops[i] > len(content)", i, stop);
+      }
+      int64_t count = (int64_t)(fromoffsets[offsetsoffset + i + 1] -
+                                fromoffsets[offsetsoffset + i]);
+      if (count < 0) {
+        return failure(
+          "broadcast's offsets must be monotonically increasing",
+          i,
+          kSliceNone);
+      }
+      if (stop - start != count) {
+        return failure("cannot broadcast nested list", i, kSliceNone);
+      }
     }
-    for (int64_t j = start;  j < stop;  j++) {
-      tocarry[k] = (T)j;
-      k++;
+    return success();
+  };
+  struct Error err = awkward_parallel_for(offsetslength - 1, check);
+  if (err.str != nullptr) {
+    return err;
+  }
+  auto fill = [&](int64_t first, int64_t last) -> Error {
+    for (int64_t i = first;  i < last;  i++) {
+      int64_t start = (int64_t)fromstarts[startsoffset + i];
+      int64_t stop = (int64_t)fromstops[stopsoffset + i];
+      int64_t k = (int64_t)(fromoffsets[offsetsoffset + i] -
+                            fromoffsets[offsetsoffset]);
+      for (int64_t j = start;  j < stop;  j++) {
+        tocarry[k] = (T)j;
+        k++;
+      }
     }
-  }
-  return success();
+    return success();
+  };
+  return awkward_parallel_for(offsetslength - 1, fill);
 }
 ERROR awkward_listarray32_broadcast_tooffsets64(
   int64_t* tocarry,
@@ -1174,10 +1199,13 @@ ERROR awkward_numpyarray_fill(
   const FROM* fromptr,
   int64_t fromoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[tooffset + i] = (TO)fromptr[fromoffset + i];
-  }
-  return success();
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[tooffset + i] = (TO)fromptr[fromoffset + i];
+    }
+    return success();
+  };
+  return awkward_parallel_for(length, body);
 }
 template <typename TO>
 ERROR awkward_numpyarray_fill_frombool(
@@ -1186,10 +1214,13 @@ ERROR awkward_numpyarray_fill_frombool(
   const bool* fromptr,
   int64_t fromoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[tooffset + i] = (TO)(fromptr[fromoffset + i] != 0);
-  }
-  return success();
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[tooffset + i] = (TO)(fromptr[fromoffset + i] != 0);
+    }
+    return success();
+  };
+  return awkward_parallel_for(length, body);
 }
 ERROR awkward_numpyarray_fill_todouble_fromdouble(
   double* toptr,
@@ -1366,13 +1397,18 @@ ERROR awkward_numpyarray_fill_to64_fromU64(
   const uint64_t* fromptr,
   int64_t fromoffset,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    if (fromptr[fromoffset + i] > kMaxInt64) {
-      return failure("uint64 value too large for int64 output", i, kSliceNone);
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      if (fromptr[fromoffset + i] > kMaxInt64) {
+        return failure("uint64 value too large for int64 output",
+                       i,
+                       kSliceNone);
+      }
+      toptr[tooffset + i] = fromptr[fromoffset + i];
     }
-    toptr[tooffset + i] = fromptr[fromoffset + i];
-  }
-  return success();
+    return success();
+  };
+  return awkward_parallel_for(length, body);
 }
 ERROR awkward_numpyarray_fill_to64_from32(
   int64_t* toptr,
@@ -2702,12 +2738,11 @@ ERROR awkward_ListArray_rpad_and_clip_length_axis1(
   int64_t lenstarts,
   int64_t startsoffset,
   int64_t stopsoffset) {
-  int64_t length = 0;
-  for (int64_t i = 0;  i < lenstarts;  i++) {
+  auto count = [&](int64_t i) -> int64_t {
     int64_t range = fromstops[startsoffset + i] - fromstarts[stopsoffset + i];
-    length += (target > range) ? target : range;
-  }
-  *tolength = length;
+    return (target > range) ? target : range;
+  };
+  *tolength = awkward_parallel_sum<int64_t>(lenstarts, count);
   return success();
 }
 ERROR awkward_ListArray32_rpad_and_clip_length_axis1(
@@ -2920,18 +2955,17 @@ ERROR awkward_ListOffsetArray_rpad_length_axis1(
   int64_t fromlength,
   int64_t target,
   int64_t* tolength) {
-  int64_t length = 0;
-  tooffsets[0] = 0;
-  for (int64_t i = 0; i < fromlength; i++) {
+  auto count = [&](int64_t i) -> C {
     int64_t range =
       fromoffsets[offsetsoffset + i + 1] - fromoffsets[offsetsoffset + i];
-    int64_t longer = (target < range) ? range : target;
-    length = length + longer;
-    tooffsets[i + 1] = tooffsets[i] + longer;
-  }
-  *tolength = length;
-
-  return success();
+    return (C)((target < range) ? range : target);
+  };
+  struct Error err = awkward_parallel_scan(tooffsets,
+                                           fromlength,
+                                           count,
+                                           nullptr);
+  *tolength = (int64_t)tooffsets[fromlength];
+  return err;
 }
 ERROR awkward_ListOffsetArray32_rpad_length_axis1(
   int32_t* tooffsets,
@@ -3158,9 +3192,7 @@ ERROR awkward_listarray_choose_length(
   const C* stops,
   int64_t stopsoffset,
   int64_t length) {
-  *totallen = 0;
-  tooffsets[0] = 0;
-  for (int64_t i = 0;  i < length;  i++) {
+  auto count = [&](int64_t i) -> T {
     int64_t size = (int64_t)(stops[stopsoffset + i] -
                              starts[startsoffset + i]);
     if (diagonal) {
@@ -3184,10 +3216,24 @@ ERROR awkward_listarray_choose_length(
         chooselen /= j;
       }
     }
-    *totallen = *totallen + chooselen;
-    tooffsets[i + 1] = tooffsets[i] + chooselen;
-  }
-  return success();
+    return (T)chooselen;
+  };
+  // The scan would call count(i) twice (for its totals, then for its running
+  // sums), so each count is computed once into tooffsets[i + 1], which the
+  // scan reads just before it overwrites it.
+  awkward_parallel_for(length, [&](int64_t first, int64_t last) -> Error {
+    for (int64_t i = first;  i < last;  i++) {
+      tooffsets[i + 1] = count(i);
+    }
+    return success();
+  });
+  struct Error err = awkward_parallel_scan(
+    tooffsets,
+    length,
+    [&](int64_t i) -> T { return tooffsets[i + 1]; },
+    nullptr);
+  *totallen = (int64_t)tooffsets[length];
+  return err;
 }
 ERROR awkward_listarray32_choose_length_64(
   int64_t* totallen,
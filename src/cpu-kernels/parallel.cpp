@@ -0,0 +1,181 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "awkward/cpu-kernels/parallel.h"
+
+namespace {
+  struct Batch {
+    Batch(int64_t numchunks, const std::function<void(int64_t)>* task)
+        : numchunks(numchunks)
+        , task(task)
+        , next(0)
+        , remaining(numchunks) { }
+
+    // Claims and runs chunks until none are left. Both the caller and the
+    // helpers do this, so a batch finishes even if no helper ever wakes up.
+    void work() {
+      int64_t chunk;
+      while ((chunk = next.fetch_add(1)) < numchunks) {
+        (*task)(chunk);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--remaining == 0) {
+          done.notify_all();
+        }
+      }
+    }
+
+    const int64_t numchunks;
+    const std::function<void(int64_t)>* task;
+    std::atomic<int64_t> next;
+    int64_t remaining;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+
+  thread_local bool inside_pool = false;
+
+  class ThreadPool {
+  public:
+    ThreadPool(): numthreads_(1), threshold_(65536), stopping_(false) { }
+
+    int64_t numthreads() const {
+      return numthreads_.load();
+    }
+
+    void setnumthreads(int64_t numthreads) {
+      if (numthreads <= 0) {
+        numthreads = (int64_t)std::thread::hardware_concurrency();
+        if (numthreads <= 0) {
+          numthreads = 1;
+        }
+      }
+      std::lock_guard<std::mutex> resize(resize_);
+      stop();
+      numthreads_.store(numthreads);
+      for (int64_t i = 1;  i < numthreads;  i++) {
+        workers_.emplace_back([this]() -> void { loop(); });
+      }
+    }
+
+    int64_t threshold() const {
+      return threshold_.load();
+    }
+
+    void setthreshold(int64_t threshold) {
+      threshold_.store(threshold < 1 ? 1 : threshold);
+    }
+
+    void run(int64_t numchunks, const std::function<void(int64_t)>& task) {
+      std::shared_ptr<Batch> batch = std::make_shared<Batch>(numchunks, &task);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int64_t i = 1;  i < numchunks;  i++) {
+          queue_.push_back(batch);
+        }
+      }
+      wakeup_.notify_all();
+      batch.get()->work();
+      std::unique_lock<std::mutex> lock(batch.get()->mutex);
+      batch.get()->done.wait(lock, [&batch]() -> bool {
+        return batch.get()->remaining == 0;
+      });
+    }
+
+  private:
+    void loop() {
+      inside_pool = true;
+      while (true) {
+        std::shared_ptr<Batch> batch;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          wakeup_.wait(lock, [this]() -> bool {
+            return stopping_  ||  !queue_.empty();
+          });
+          if (stopping_) {
+            return;
+          }
+          batch = queue_.front();
+          queue_.pop_front();
+        }
+        batch.get()->work();
+      }
+    }
+
+    // Queued helpers that never run are harmless: their callers finish the
+    // remaining chunks themselves.
+    void stop() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+      }
+      wakeup_.notify_all();
+      for (auto& worker : workers_) {
+        worker.join();
+      }
+      workers_.clear();
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.clear();
+      stopping_ = false;
+    }
+
+    std::atomic<int64_t> numthreads_;
+    std::atomic<int64_t> threshold_;
+    std::mutex resize_;
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    std::deque<std::shared_ptr<Batch>> queue_;
+    std::vector<std::thread> workers_;
+    bool stopping_;
+  };
+
+  // Never destroyed: joining threads during static destruction (or while a
+  // shared library is being unloaded) can deadlock.
+  ThreadPool& pool() {
+    static ThreadPool* out = new ThreadPool();
+    return *out;
+  }
+}
+
+void awkward_parallel_set_numthreads(int64_t numthreads) {
+  pool().setnumthreads(numthreads);
+}
+
+int64_t awkward_parallel_numthreads() {
+  return pool().numthreads();
+}
+
+void awkward_parallel_set_threshold(int64_t threshold) {
+  pool().setthreshold(threshold);
+}
+
+int64_t awkward_parallel_threshold() {
+  return pool().threshold();
+}
+
+int64_t awkward_parallel_numchunks(int64_t length) {
+  if (inside_pool) {
+    return 1;
+  }
+  int64_t numthreads = pool().numthreads();
+  int64_t bythreshold = length / pool().threshold();
+  int64_t out = (numthreads < bythreshold ? numthreads : bythreshold);
+  return (out < 1 ? 1 : out);
+}
+
+void awkward_parallel_run(int64_t numchunks,
+                          const std::function<void(int64_t)>& task) {
+  if (numchunks <= 1  ||  inside_pool) {
+    for (int64_t chunk = 0;  chunk < numchunks;  chunk++) {
+      task(chunk);
+    }
+  }
+  else {
+    pool().run(numchunks, task);
+  }
+}
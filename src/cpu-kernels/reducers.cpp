@@ -1,10 +1,219 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
 #include <cstring>
+#include <type_traits>
 #include <vector>
 
+#include "awkward/cpu-kernels/parallel.h"
 #include "awkward/cpu-kernels/reducers.h"
 
+// The reducers below walk runs of equal parents as contiguous segments:
+// parents from ListOffsetArray::reduce_next are non-decreasing, so each list
+// is one run and its accumulator stays in a register instead of scattering
+// through toptr[parents[i]]. Unsorted parents are still correct (just with
+// shorter runs).
+//
+// Long runs of integers (and counts of nonzero values, which are integers)
+// are reduced in kLanes independent accumulators, which the compiler turns
+// into SIMD; the AVX2 and SSE4.2 versions are selected at runtime. Integer
+// arithmetic is associative, so the result is identical to the serial loop.
+// Floating-point sums, products, minima, and maxima are NOT reordered: each
+// segment is accumulated strictly left to right, starting from the identity,
+// exactly as in the serial loop, so results are deterministic and
+// bit-identical on every machine.
+
+namespace {
+  const int64_t kLanes = 8;
+  const int64_t kMinLanedRun = 32;
+
+  struct OpSum {
+    template <typename OUT, typename IN>
+    static OUT apply(OUT acc, IN x) { return acc + (OUT)x; }
+    template <typename OUT>
+    static OUT combine(OUT acc, OUT lane) { return acc + lane; }
+  };
+  struct OpProd {
+    template <typename OUT, typename IN>
+    static OUT apply(OUT acc, IN x) { return acc * (OUT)x; }
+    template <typename OUT>
+    static OUT combine(OUT acc, OUT lane) { return acc * lane; }
+  };
+  struct OpMin {
+    template <typename OUT, typename IN>
+    static OUT apply(OUT acc, IN x) { return (x < acc ? x : acc); }
+    template <typename OUT>
+    static OUT combine(OUT acc, OUT lane) { return (lane < acc ? lane : acc); }
+  };
+  struct OpMax {
+    template <typename OUT, typename IN>
+    static OUT apply(OUT acc, IN x) { return (x > acc ? x : acc); }
+    template <typename OUT>
+    static OUT combine(OUT acc, OUT lane) { return (lane > acc ? lane : acc); }
+  };
+  struct OpCountNonzero {
+    template <typename OUT, typename IN>
+    static OUT apply(OUT acc, IN x) { return acc + (x != 0); }
+    template <typename OUT>
+    static OUT combine(OUT acc, OUT lane) { return acc + lane; }
+  };
+  struct OpAny {
+    template <typename OUT, typename IN>
+    static OUT apply(OUT acc, IN x) { return acc | (x != 0); }
+    template <typename OUT>
+    static OUT combine(OUT acc, OUT lane) { return acc | lane; }
+  };
+  struct OpAll {
+    template <typename OUT, typename IN>
+    static OUT apply(OUT acc, IN x) { return acc & (x != 0); }
+    template <typename OUT>
+    static OUT combine(OUT acc, OUT lane) { return acc & lane; }
+  };
+
+#if defined(__GNUC__)
+  #define AWKWARD_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+  #define AWKWARD_ALWAYS_INLINE inline
+#endif
+
+  template <typename OP, typename OUT, typename IN>
+  AWKWARD_ALWAYS_INLINE OUT
+  reduce_laned(OUT acc, const IN* fromptr, int64_t length, OUT identity) {
+    OUT lanes[kLanes];
+    for (int64_t k = 0;  k < kLanes;  k++) {
+      lanes[k] = identity;
+    }
+    int64_t i = 0;
+    for (;  i + kLanes <= length;  i += kLanes) {
+      for (int64_t k = 0;  k < kLanes;  k++) {
+        lanes[k] = OP::template apply<OUT, IN>(lanes[k], fromptr[i + k]);
+      }
+    }
+    for (int64_t k = 0;  k < kLanes;  k++) {
+      acc = OP::template combine<OUT>(acc, lanes[k]);
+    }
+    for (;  i < length;  i++) {
+      acc = OP::template apply<OUT, IN>(acc, fromptr[i]);
+    }
+    return acc;
+  }
+
+#if defined(__GNUC__)  &&  (defined(__x86_64__)  ||  defined(__i386__))
+  #define AWKWARD_SIMD_DISPATCH
+
+  template <typename OP, typename OUT, typename IN>
+  __attribute__((target("avx2"))) OUT
+  reduce_laned_avx2(OUT acc, const IN* fromptr, int64_t length, OUT identity) {
+    return reduce_laned<OP, OUT, IN>(acc, fromptr, length, identity);
+  }
+
+  template <typename OP, typename OUT, typename IN>
+  __attribute__((target("sse4.2"))) OUT
+  reduce_laned_sse42(OUT acc, const IN* fromptr, int64_t length, OUT identity) {
+    return reduce_laned<OP, OUT, IN>(acc, fromptr, length, identity);
+  }
+
+  int simd_level() {
+    static const int level = []() -> int {
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2")) {
+        return 2;
+      }
+      else if (__builtin_cpu_supports("sse4.2")) {
+        return 1;
+      }
+      return 0;
+    }();
+    return level;
+  }
+#endif
+
+  template <typename OP, typename OUT, typename IN>
+  OUT
+  reduce_run(OUT acc, const IN* fromptr, int64_t length, OUT identity) {
+    if (!std::is_integral<OUT>::value  ||  length < kMinLanedRun) {
+      for (int64_t i = 0;  i < length;  i++) {
+        acc = OP::template apply<OUT, IN>(acc, fromptr[i]);
+      }
+      return acc;
+    }
+#ifdef AWKWARD_SIMD_DISPATCH
+    switch (simd_level()) {
+      case 2:
+        return reduce_laned_avx2<OP, OUT, IN>(acc, fromptr, length, identity);
+      case 1:
+        return reduce_laned_sse42<OP, OUT, IN>(acc, fromptr, length, identity);
+    }
+#endif
+    return reduce_laned<OP, OUT, IN>(acc, fromptr, length, identity);
+  }
+
+  // Finds the end of the run of equal parents that begins at start, comparing
+  // a block of kLanes at a time (no early exit within a block).
+  int64_t
+  run_end(const int64_t* parents, int64_t lenparents, int64_t start) {
+    int64_t parent = parents[start];
+    int64_t stop = start + 1;
+    while (stop + kLanes <= lenparents) {
+      int64_t same = 0;
+      for (int64_t k = 0;  k < kLanes;  k++) {
+        same += (parents[stop + k] == parent);
+      }
+      if (same != kLanes) {
+        break;
+      }
+      stop += kLanes;
+    }
+    while (stop < lenparents  &&  parents[stop] == parent) {
+      stop++;
+    }
+    return stop;
+  }
+
+  template <typename OP, typename OUT, typename IN>
+  void
+  reduce_segments(OUT* toptr,
+                  const IN* fromptr,
+                  const int64_t* parents,
+                  int64_t lenparents,
+                  int64_t outlength,
+                  typename std::common_type<OUT>::type identity) {
+    for (int64_t i = 0;  i < outlength;  i++) {
+      toptr[i] = identity;
+    }
+    int64_t i = 0;
+    while (i < lenparents) {
+      int64_t parent = parents[i];
+      int64_t j = run_end(parents, lenparents, i);
+      toptr[parent] = reduce_run<OP, OUT, IN>(
+        toptr[parent], &fromptr[i], j - i, identity);
+      i = j;
+    }
+  }
+
+  // The same reduction when the segments are given directly as offsets (the
+  // innermost axis of a ListOffsetArray over a flat NumpyArray), so there is
+  // no parents array to read or to build. Each output is independent, so the
+  // outputs are divided among threads.
+  template <typename OP, typename OUT, typename IN>
+  void
+  reduce_offsets(OUT* toptr,
+                 const IN* fromptr,
+                 const int64_t* offsets,
+                 int64_t outlength,
+                 typename std::common_type<OUT>::type identity) {
+    auto body = [&](int64_t start, int64_t stop) -> Error {
+      for (int64_t i = start;  i < stop;  i++) {
+        toptr[i] = reduce_run<OP, OUT, IN>(identity,
+                                           &fromptr[offsets[i]],
+                                           offsets[i + 1] - offsets[i],
+                                           identity);
+      }
+      return success();
+    };
+    awkward_parallel_for(outlength, body);
+  }
+}
+
 ERROR awkward_reduce_count_64(
   int64_t* toptr,
   const int64_t* parents,
@@ -14,8 +223,15 @@ ERROR awkward_reduce_count_64(
   for (int64_t i = 0;  i < outlength;  i++) {
     toptr[i] = 0;
   }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]]++;
+  int64_t i = 0;
+  while (i < lenparents) {
+    int64_t parent = parents[parentsoffset + i];
+    int64_t j = i + 1;
+    while (j < lenparents  &&  parents[parentsoffset + j] == parent) {
+      j++;
+    }
+    toptr[parent] += (j - i);
+    i = j;
   }
   return success();
 }
@@ -29,12 +245,12 @@ ERROR awkward_reduce_countnonzero(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = 0;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] += (fromptr[fromptroffset + i] != 0);
-  }
+  reduce_segments<OpCountNonzero>(toptr,
+                                  &fromptr[fromptroffset],
+                                  &parents[parentsoffset],
+                                  lenparents,
+                                  outlength,
+                                  0);
   return success();
 }
 ERROR awkward_reduce_countnonzero_bool_64(
@@ -234,12 +450,12 @@ ERROR awkward_reduce_sum(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = (OUT)0;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] += (OUT)fromptr[fromptroffset + i];
-  }
+  reduce_segments<OpSum>(toptr,
+                         &fromptr[fromptroffset],
+                         &parents[parentsoffset],
+                         lenparents,
+                         outlength,
+                         (OUT)0);
   return success();
 }
 ERROR awkward_reduce_sum_int64_bool_64(
@@ -250,12 +466,12 @@ ERROR awkward_reduce_sum_int64_bool_64(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = 0;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] += (fromptr[fromptroffset + i] != 0);
-  }
+  reduce_segments<OpCountNonzero>(toptr,
+                                  &fromptr[fromptroffset],
+                                  &parents[parentsoffset],
+                                  lenparents,
+                                  outlength,
+                                  0);
   return success();
 }
 ERROR awkward_reduce_sum_int64_int8_64(
@@ -436,12 +652,12 @@ ERROR awkward_reduce_sum_int32_bool_64(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = 0;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] += (fromptr[fromptroffset + i] != 0);
-  }
+  reduce_segments<OpCountNonzero>(toptr,
+                                  &fromptr[fromptroffset],
+                                  &parents[parentsoffset],
+                                  lenparents,
+                                  outlength,
+                                  0);
   return success();
 }
 ERROR awkward_reduce_sum_int32_int8_64(
@@ -556,12 +772,12 @@ ERROR awkward_reduce_sum_bool(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = (bool)0;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] |= (fromptr[fromptroffset + i] != 0);
-  }
+  reduce_segments<OpAny>(toptr,
+                         &fromptr[fromptroffset],
+                         &parents[parentsoffset],
+                         lenparents,
+                         outlength,
+                         (bool)0);
   return success();
 }
 ERROR awkward_reduce_sum_bool_bool_64(
@@ -761,12 +977,12 @@ ERROR awkward_reduce_prod(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = (OUT)1;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] *= (OUT)fromptr[fromptroffset + i];
-  }
+  reduce_segments<OpProd>(toptr,
+                          &fromptr[fromptroffset],
+                          &parents[parentsoffset],
+                          lenparents,
+                          outlength,
+                          (OUT)1);
   return success();
 }
 ERROR awkward_reduce_prod_int64_bool_64(
@@ -777,12 +993,12 @@ ERROR awkward_reduce_prod_int64_bool_64(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = 1;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] *= (fromptr[fromptroffset + i] != 0);
-  }
+  reduce_segments<OpProd>(toptr,
+                          &fromptr[fromptroffset],
+                          &parents[parentsoffset],
+                          lenparents,
+                          outlength,
+                          1);
   return success();
 }
 ERROR awkward_reduce_prod_int64_int8_64(
@@ -963,12 +1179,12 @@ ERROR awkward_reduce_prod_int32_bool_64(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = 1;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] *= (fromptr[fromptroffset + i] != 0);
-  }
+  reduce_segments<OpProd>(toptr,
+                          &fromptr[fromptroffset],
+                          &parents[parentsoffset],
+                          lenparents,
+                          outlength,
+                          1);
   return success();
 }
 ERROR awkward_reduce_prod_int32_int8_64(
@@ -1083,12 +1299,12 @@ ERROR awkward_reduce_prod_bool(
   int64_t parentsoffset,
   int64_t lenparents,
   int64_t outlength) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = (bool)1;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    toptr[parents[parentsoffset + i]] &= (fromptr[fromptroffset + i] != 0);
-  }
+  reduce_segments<OpAll>(toptr,
+                         &fromptr[fromptroffset],
+                         &parents[parentsoffset],
+                         lenparents,
+                         outlength,
+                         (bool)1);
   return success();
 }
 ERROR awkward_reduce_prod_bool_bool_64(
@@ -1289,16 +1505,12 @@ ERROR awkward_reduce_min(
   int64_t lenparents,
   int64_t outlength,
   OUT identity) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = identity;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    IN x = fromptr[fromptroffset + i];
-    toptr[parents[parentsoffset + i]] =
-      (x < toptr[parents[parentsoffset + i]]
-           ? x
-           : toptr[parents[parentsoffset + i]]);
-  }
+  reduce_segments<OpMin>(toptr,
+                         &fromptr[fromptroffset],
+                         &parents[parentsoffset],
+                         lenparents,
+                         outlength,
+                         identity);
   return success();
 }
 ERROR awkward_reduce_min_int8_int8_64(
@@ -1502,16 +1714,12 @@ ERROR awkward_reduce_max(
   int64_t lenparents,
   int64_t outlength,
   OUT identity) {
-  for (int64_t i = 0;  i < outlength;  i++) {
-    toptr[i] = identity;
-  }
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    IN x = fromptr[fromptroffset + i];
-    toptr[parents[parentsoffset + i]] =
-      (x > toptr[parents[parentsoffset + i]]
-           ? x
-           : toptr[parents[parentsoffset + i]]);
-  }
+  reduce_segments<OpMax>(toptr,
+                         &fromptr[fromptroffset],
+                         &parents[parentsoffset],
+                         lenparents,
+                         outlength,
+                         identity);
   return success();
 }
 ERROR awkward_reduce_max_int8_int8_64(
@@ -2225,138 +2433,2073 @@ ERROR awkward_reduce_argmax_float64_64(
     outlength);
 }
 
-ERROR awkward_content_reduce_zeroparents_64(
-  int64_t* toparents,
-  int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toparents[i] = 0;
-  }
-  return success();
+ERROR awkward_reduce_count_segments_64(
+  int64_t* toptr,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      toptr[i] = offsets[offsetsoffset + i + 1] - offsets[offsetsoffset + i];
+    }
+    return success();
+  };
+  return awkward_parallel_for(outlength, body);
 }
 
-ERROR awkward_listoffsetarray_reduce_global_startstop_64(
-  int64_t* globalstart,
-  int64_t* globalstop,
+template <typename IN>
+ERROR awkward_reduce_countnonzero_segments(
+  int64_t* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
   const int64_t* offsets,
   int64_t offsetsoffset,
-  int64_t length) {
-  *globalstart = offsets[offsetsoffset + 0];
-  *globalstop = offsets[offsetsoffset + length];
+  int64_t outlength) {
+  reduce_offsets<OpCountNonzero>(toptr,
+                                 &fromptr[fromptroffset],
+                                 &offsets[offsetsoffset],
+                                 outlength,
+                                 0);
   return success();
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
-  int64_t* maxcount,
-  int64_t* offsetscopy,
+ERROR awkward_reduce_countnonzero_bool_segments_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
   const int64_t* offsets,
   int64_t offsetsoffset,
-  int64_t length) {
-  *maxcount = 0;
-  offsetscopy[0] = offsets[offsetsoffset + 0];
-  for (int64_t i = 0;  i < length;  i++) {
-    int64_t count = (offsets[offsetsoffset + i + 1] -
-                     offsets[offsetsoffset + i]);
-    if (*maxcount < count) {
-      *maxcount = count;
-    }
-    offsetscopy[i + 1] = offsets[offsetsoffset + i + 1];
-  }
-  return success();
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<bool>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
-  int64_t* nextcarry,
-  int64_t* nextparents,
-  int64_t nextlen,
-  int64_t* maxnextparents,
-  int64_t* distincts,
-  int64_t distinctslen,
-  int64_t* offsetscopy,
+ERROR awkward_reduce_countnonzero_int8_segments_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
   const int64_t* offsets,
   int64_t offsetsoffset,
-  int64_t length,
-  const int64_t* parents,
-  int64_t parentsoffset,
-  int64_t maxcount) {
-  *maxnextparents = 0;
-  for (int64_t i = 0;  i < distinctslen;  i++) {
-    distincts[i] = -1;
-  }
-
-  int64_t k = 0;
-  while (k < nextlen) {
-    int64_t j = 0;
-    for (int64_t i = 0;  i < length;  i++) {
-      if (offsetscopy[i] < offsets[offsetsoffset + i + 1]) {
-        int64_t count = (offsets[offsetsoffset + i + 1] -
-                         offsets[offsetsoffset + i]);
-        int64_t diff = offsetscopy[i] - offsets[offsetsoffset + i];
-        int64_t parent = parents[parentsoffset + i];
-
-        nextcarry[k] = offsetscopy[i];
-        nextparents[k] = parent*maxcount + diff;
-
-        if (*maxnextparents < nextparents[k]) {
-          *maxnextparents = nextparents[k];
-        }
-
-        if (distincts[nextparents[k]] == -1) {
-          distincts[nextparents[k]] = j;
-          j++;
-        }
-
-        k++;
-        offsetscopy[i]++;
-      }
-    }
-  }
-  return success();
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
-  int64_t* nextstarts,
-  const int64_t* nextparents,
-  int64_t nextlen) {
-  int64_t lastnextparent = -1;
-  for (int64_t k = 0;  k < nextlen;  k++) {
-    if (nextparents[k] != lastnextparent) {
-      nextstarts[nextparents[k]] = k;
-    }
-    lastnextparent = nextparents[k];
-  }
-  return success();
+ERROR awkward_reduce_countnonzero_uint8_segments_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_findgaps_64(
-  int64_t* gaps,
-  const int64_t* parents,
-  int64_t parentsoffset,
-  int64_t lenparents) {
-  int64_t k = 0;
-  int64_t last = -1;
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    int64_t parent = parents[parentsoffset + i];
-    if (last < parent) {
-      gaps[k] = parent - last;
-      k++;
-      last = parent;
-    }
-  }
-  return success();
+ERROR awkward_reduce_countnonzero_int16_segments_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_outstartsstops_64(
-  int64_t* outstarts,
-  int64_t* outstops,
-  const int64_t* distincts,
-  int64_t lendistincts,
-  const int64_t* gaps) {
-  int64_t j = 0;
-  int64_t k = 0;
-  int64_t maxdistinct = -1;
-  for (int64_t i = 0;  i < lendistincts;  i++) {
-    if (maxdistinct < distincts[i]) {
-      maxdistinct = distincts[i];
+ERROR awkward_reduce_countnonzero_uint16_segments_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int32_segments_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint32_segments_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_int64_segments_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_uint64_segments_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float32_segments_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_countnonzero_float64_segments_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_countnonzero_segments<double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_sum_segments(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpSum>(toptr,
+                        &fromptr[fromptroffset],
+                        &offsets[offsetsoffset],
+                        outlength,
+                        (OUT)0);
+  return success();
+}
+ERROR awkward_reduce_sum_int64_bool_segments_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpCountNonzero>(toptr,
+                                 &fromptr[fromptroffset],
+                                 &offsets[offsetsoffset],
+                                 outlength,
+                                 0);
+  return success();
+}
+ERROR awkward_reduce_sum_int64_int8_segments_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<int64_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint8_segments_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<uint64_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int16_segments_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<int64_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint16_segments_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<uint64_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int32_segments_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint32_segments_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int64_int64_segments_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint64_uint64_segments_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<uint64_t, uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float32_float32_segments_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<float, float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_float64_float64_segments_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<double, double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_bool_segments_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpCountNonzero>(toptr,
+                                 &fromptr[fromptroffset],
+                                 &offsets[offsetsoffset],
+                                 outlength,
+                                 0);
+  return success();
+}
+ERROR awkward_reduce_sum_int32_int8_segments_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<int32_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint8_segments_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<uint32_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int16_segments_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<int32_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint16_segments_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<uint32_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_int32_int32_segments_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_uint32_uint32_segments_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_segments<uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename IN>
+ERROR awkward_reduce_sum_bool_segments(
+  bool* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpAny>(toptr,
+                        &fromptr[fromptroffset],
+                        &offsets[offsetsoffset],
+                        outlength,
+                        (bool)0);
+  return success();
+}
+ERROR awkward_reduce_sum_bool_bool_segments_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<bool>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int8_segments_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint8_segments_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int16_segments_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint16_segments_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int32_segments_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint32_segments_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_int64_segments_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_uint64_segments_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float32_segments_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_sum_bool_float64_segments_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_sum_bool_segments<double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_prod_segments(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpProd>(toptr,
+                         &fromptr[fromptroffset],
+                         &offsets[offsetsoffset],
+                         outlength,
+                         (OUT)1);
+  return success();
+}
+ERROR awkward_reduce_prod_int64_bool_segments_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpProd>(toptr,
+                         &fromptr[fromptroffset],
+                         &offsets[offsetsoffset],
+                         outlength,
+                         1);
+  return success();
+}
+ERROR awkward_reduce_prod_int64_int8_segments_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<int64_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint8_segments_64(
+  uint64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<uint64_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int16_segments_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<int64_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint16_segments_64(
+  uint64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<uint64_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int32_segments_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint32_segments_64(
+  uint64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<uint64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int64_int64_segments_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint64_uint64_segments_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<uint64_t, uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float32_float32_segments_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<float, float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_float64_float64_segments_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<double, double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_bool_segments_64(
+  int32_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpProd>(toptr,
+                         &fromptr[fromptroffset],
+                         &offsets[offsetsoffset],
+                         outlength,
+                         1);
+  return success();
+}
+ERROR awkward_reduce_prod_int32_int8_segments_64(
+  int32_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<int32_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint8_segments_64(
+  uint32_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<uint32_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int16_segments_64(
+  int32_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<int32_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint16_segments_64(
+  uint32_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<uint32_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_int32_int32_segments_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_uint32_uint32_segments_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_segments<uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename IN>
+ERROR awkward_reduce_prod_bool_segments(
+  bool* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  reduce_offsets<OpAll>(toptr,
+                        &fromptr[fromptroffset],
+                        &offsets[offsetsoffset],
+                        outlength,
+                        (bool)1);
+  return success();
+}
+ERROR awkward_reduce_prod_bool_bool_segments_64(
+  bool* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<bool>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int8_segments_64(
+  bool* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint8_segments_64(
+  bool* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int16_segments_64(
+  bool* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint16_segments_64(
+  bool* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int32_segments_64(
+  bool* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint32_segments_64(
+  bool* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_int64_segments_64(
+  bool* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_uint64_segments_64(
+  bool* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float32_segments_64(
+  bool* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_prod_bool_float64_segments_64(
+  bool* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_prod_bool_segments<double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_min_segments(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  OUT identity) {
+  reduce_offsets<OpMin>(toptr,
+                        &fromptr[fromptroffset],
+                        &offsets[offsetsoffset],
+                        outlength,
+                        identity);
+  return success();
+}
+ERROR awkward_reduce_min_int8_int8_segments_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_min_segments<int8_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint8_uint8_segments_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_min_segments<uint8_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int16_int16_segments_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_min_segments<int16_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint16_uint16_segments_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_min_segments<uint16_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int32_int32_segments_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_min_segments<int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint32_uint32_segments_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_min_segments<uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_int64_int64_segments_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_min_segments<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_uint64_uint64_segments_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_min_segments<uint64_t, uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float32_float32_segments_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_min_segments<float, float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_min_float64_float64_segments_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_min_segments<double, double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_max_segments(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  OUT identity) {
+  reduce_offsets<OpMax>(toptr,
+                        &fromptr[fromptroffset],
+                        &offsets[offsetsoffset],
+                        outlength,
+                        identity);
+  return success();
+}
+ERROR awkward_reduce_max_int8_int8_segments_64(
+  int8_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int8_t identity) {
+  return awkward_reduce_max_segments<int8_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint8_uint8_segments_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint8_t identity) {
+  return awkward_reduce_max_segments<uint8_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int16_int16_segments_64(
+  int16_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int16_t identity) {
+  return awkward_reduce_max_segments<int16_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint16_uint16_segments_64(
+  uint16_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint16_t identity) {
+  return awkward_reduce_max_segments<uint16_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int32_int32_segments_64(
+  int32_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int32_t identity) {
+  return awkward_reduce_max_segments<int32_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint32_uint32_segments_64(
+  uint32_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint32_t identity) {
+  return awkward_reduce_max_segments<uint32_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_int64_int64_segments_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  int64_t identity) {
+  return awkward_reduce_max_segments<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_uint64_uint64_segments_64(
+  uint64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  uint64_t identity) {
+  return awkward_reduce_max_segments<uint64_t, uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float32_float32_segments_64(
+  float* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  float identity) {
+  return awkward_reduce_max_segments<float, float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+ERROR awkward_reduce_max_float64_float64_segments_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength,
+  double identity) {
+  return awkward_reduce_max_segments<double, double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength,
+    identity);
+}
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_argmin_segments(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t first = offsets[offsetsoffset + i];
+      int64_t last = offsets[offsetsoffset + i + 1];
+      int64_t best = -1;
+      for (int64_t j = first;  j < last;  j++) {
+        if (best == -1  ||
+            fromptr[fromptroffset + j] <
+              fromptr[fromptroffset + first + best]) {
+          best = j - first;
+        }
+      }
+      toptr[i] = best;
+    }
+    return success();
+  };
+  return awkward_parallel_for(outlength, body);
+}
+template <typename OUT>
+ERROR awkward_reduce_argmin_bool_segments(
+  OUT* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t first = offsets[offsetsoffset + i];
+      int64_t last = offsets[offsetsoffset + i + 1];
+      int64_t best = -1;
+      for (int64_t j = first;  j < last;  j++) {
+        if (best == -1  ||
+            (fromptr[fromptroffset + j] != 0) <
+              (fromptr[fromptroffset + first + best] != 0)) {
+          best = j - first;
+        }
+      }
+      toptr[i] = best;
+    }
+    return success();
+  };
+  return awkward_parallel_for(outlength, body);
+}
+ERROR awkward_reduce_argmin_bool_segments_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_bool_segments<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int8_segments_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint8_segments_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int16_segments_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint16_segments_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int32_segments_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint32_segments_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_int64_segments_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_uint64_segments_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float32_segments_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmin_float64_segments_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmin_segments<int64_t, double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_argmax_segments(
+  OUT* toptr,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t first = offsets[offsetsoffset + i];
+      int64_t last = offsets[offsetsoffset + i + 1];
+      int64_t best = -1;
+      for (int64_t j = first;  j < last;  j++) {
+        if (best == -1  ||
+            fromptr[fromptroffset + j] >
+              fromptr[fromptroffset + first + best]) {
+          best = j - first;
+        }
+      }
+      toptr[i] = best;
+    }
+    return success();
+  };
+  return awkward_parallel_for(outlength, body);
+}
+template <typename OUT>
+ERROR awkward_reduce_argmax_bool_segments(
+  OUT* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  auto body = [&](int64_t start, int64_t stop) -> Error {
+    for (int64_t i = start;  i < stop;  i++) {
+      int64_t first = offsets[offsetsoffset + i];
+      int64_t last = offsets[offsetsoffset + i + 1];
+      int64_t best = -1;
+      for (int64_t j = first;  j < last;  j++) {
+        if (best == -1  ||
+            (fromptr[fromptroffset + j] != 0) >
+              (fromptr[fromptroffset + first + best] != 0)) {
+          best = j - first;
+        }
+      }
+      toptr[i] = best;
+    }
+    return success();
+  };
+  return awkward_parallel_for(outlength, body);
+}
+ERROR awkward_reduce_argmax_bool_segments_64(
+  int64_t* toptr,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_bool_segments<int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int8_segments_64(
+  int64_t* toptr,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, int8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint8_segments_64(
+  int64_t* toptr,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, uint8_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int16_segments_64(
+  int64_t* toptr,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, int16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint16_segments_64(
+  int64_t* toptr,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, uint16_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int32_segments_64(
+  int64_t* toptr,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, int32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint32_segments_64(
+  int64_t* toptr,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, uint32_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_int64_segments_64(
+  int64_t* toptr,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, int64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_uint64_segments_64(
+  int64_t* toptr,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, uint64_t>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float32_segments_64(
+  int64_t* toptr,
+  const float* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, float>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+ERROR awkward_reduce_argmax_float64_segments_64(
+  int64_t* toptr,
+  const double* fromptr,
+  int64_t fromptroffset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  return awkward_reduce_argmax_segments<int64_t, double>(
+    toptr,
+    fromptr,
+    fromptroffset,
+    offsets,
+    offsetsoffset,
+    outlength);
+}
+
+ERROR awkward_content_reduce_zeroparents_64(
+  int64_t* toparents,
+  int64_t length) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toparents[i] = 0;
+  }
+  return success();
+}
+
+ERROR awkward_listoffsetarray_reduce_global_startstop_64(
+  int64_t* globalstart,
+  int64_t* globalstop,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  *globalstart = offsets[offsetsoffset + 0];
+  *globalstop = offsets[offsetsoffset + length];
+  return success();
+}
+
+ERROR awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
+  int64_t* maxcount,
+  int64_t* offsetscopy,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  *maxcount = 0;
+  offsetscopy[0] = offsets[offsetsoffset + 0];
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t count = (offsets[offsetsoffset + i + 1] -
+                     offsets[offsetsoffset + i]);
+    if (*maxcount < count) {
+      *maxcount = count;
+    }
+    offsetscopy[i + 1] = offsets[offsetsoffset + i + 1];
+  }
+  return success();
+}
+
+ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
+  int64_t* nextcarry,
+  int64_t* nextparents,
+  int64_t nextlen,
+  int64_t* maxnextparents,
+  int64_t* distincts,
+  int64_t distinctslen,
+  int64_t* offsetscopy,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t maxcount) {
+  *maxnextparents = 0;
+  for (int64_t i = 0;  i < distinctslen;  i++) {
+    distincts[i] = -1;
+  }
+
+  int64_t k = 0;
+  while (k < nextlen) {
+    int64_t j = 0;
+    for (int64_t i = 0;  i < length;  i++) {
+      if (offsetscopy[i] < offsets[offsetsoffset + i + 1]) {
+        int64_t count = (offsets[offsetsoffset + i + 1] -
+                         offsets[offsetsoffset + i]);
+        int64_t diff = offsetscopy[i] - offsets[offsetsoffset + i];
+        int64_t parent = parents[parentsoffset + i];
+
+        nextcarry[k] = offsetscopy[i];
+        nextparents[k] = parent*maxcount + diff;
+
+        if (*maxnextparents < nextparents[k]) {
+          *maxnextparents = nextparents[k];
+        }
+
+        if (distincts[nextparents[k]] == -1) {
+          distincts[nextparents[k]] = j;
+          j++;
+        }
+
+        k++;
+        offsetscopy[i]++;
+      }
+    }
+  }
+  return success();
+}
+
+ERROR awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
+  int64_t* nextstarts,
+  const int64_t* nextparents,
+  int64_t nextlen) {
+  int64_t lastnextparent = -1;
+  for (int64_t k = 0;  k < nextlen;  k++) {
+    if (nextparents[k] != lastnextparent) {
+      nextstarts[nextparents[k]] = k;
+    }
+    lastnextparent = nextparents[k];
+  }
+  return success();
+}
+
+ERROR awkward_listoffsetarray_reduce_nonlocal_findgaps_64(
+  int64_t* gaps,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t lenparents) {
+  int64_t k = 0;
+  int64_t last = -1;
+  for (int64_t i = 0;  i < lenparents;  i++) {
+    int64_t parent = parents[parentsoffset + i];
+    if (last < parent) {
+      gaps[k] = parent - last;
+      k++;
+      last = parent;
+    }
+  }
+  return success();
+}
+
+ERROR awkward_listoffsetarray_reduce_nonlocal_outstartsstops_64(
+  int64_t* outstarts,
+  int64_t* outstops,
+  const int64_t* distincts,
+  int64_t lendistincts,
+  const int64_t* gaps) {
+  int64_t j = 0;
+  int64_t k = 0;
+  int64_t maxdistinct = -1;
+  for (int64_t i = 0;  i < lendistincts;  i++) {
+    if (maxdistinct < distincts[i]) {
+      maxdistinct = distincts[i];
       for (int64_t gappy = 0;  gappy < gaps[j];  gappy++) {
         outstarts[k] = i;
         outstops[k] = i;
@@ -2393,15 +4536,39 @@ ERROR awkward_listoffsetarray_reduce_local_outoffsets_64(
   int64_t lenparents,
   int64_t outlength) {
   outoffsets[outlength] = lenparents;
-  int64_t k = 0;
-  int64_t last = -1;
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    while (last < parents[parentsoffset + i]) {
-      outoffsets[k] = i;
-      k++;
-      last++;
+  int64_t numchunks = awkward_parallel_numchunks(lenparents);
+  // "last" is the largest parent seen so far, so each chunk starts from the
+  // largest parent in all earlier chunks (a running-max scan).
+  std::vector<int64_t> lasts((size_t)numchunks + 1, -1);
+  if (numchunks > 1) {
+    awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+      int64_t start = (lenparents * chunk) / numchunks;
+      int64_t stop = (lenparents * (chunk + 1)) / numchunks;
+      int64_t last = -1;
+      for (int64_t i = start;  i < stop;  i++) {
+        if (last < parents[parentsoffset + i]) {
+          last = parents[parentsoffset + i];
+        }
+      }
+      lasts[(size_t)chunk + 1] = last;
+    });
+    for (int64_t chunk = 0;  chunk < numchunks;  chunk++) {
+      if (lasts[(size_t)chunk + 1] < lasts[(size_t)chunk]) {
+        lasts[(size_t)chunk + 1] = lasts[(size_t)chunk];
+      }
     }
   }
+  awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+    int64_t start = (lenparents * chunk) / numchunks;
+    int64_t stop = (lenparents * (chunk + 1)) / numchunks;
+    int64_t last = lasts[(size_t)chunk];
+    for (int64_t i = start;  i < stop;  i++) {
+      while (last < parents[parentsoffset + i]) {
+        last++;
+        outoffsets[last] = i;
+      }
+    }
+  });
   return success();
 }
 
@@ -2515,6 +4682,17 @@ ERROR awkward_numpyarray_reduce_mask_bytemaskedarray(
   return success();
 }
 
+ERROR awkward_numpyarray_reduce_mask_bytemaskedarray_segments_64(
+  int8_t* toptr,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t outlength) {
+  for (int64_t i = 0;  i < outlength;  i++) {
+    toptr[i] = (offsets[offsetsoffset + i] == offsets[offsetsoffset + i + 1]);
+  }
+  return success();
+}
+
 ERROR awkward_bytemaskedarray_reduce_next_64(
   int64_t* nextcarry,
   int64_t* nextparents,
@@ -0,0 +1,583 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+  #include <malloc.h>
+#else
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#include "awkward/Allocator.h"
+
+namespace awkward {
+  Allocator::~Allocator() { }
+
+  void*
+  Allocator::reallocate(void* ptr,
+                        size_t oldbytes,
+                        size_t newbytes,
+                        size_t alignment) {
+    void* out = allocate(newbytes, alignment);
+    memcpy(out, ptr, std::min(oldbytes, newbytes));
+    deallocate(ptr, oldbytes, alignment);
+    return out;
+  }
+
+  bool
+  Allocator::grow(void*, size_t, size_t, size_t) {
+    return false;
+  }
+
+  ////////// AlignedAllocator
+
+  const std::string
+  AlignedAllocator::name() const {
+    return "AlignedAllocator";
+  }
+
+  void*
+  AlignedAllocator::allocate(size_t bytes, size_t alignment) {
+    // Zero-length arrays still get a unique, non-null pointer.
+    if (bytes == 0) {
+      bytes = alignment;
+    }
+#ifdef _MSC_VER
+    void* out = _aligned_malloc(bytes, alignment);
+    if (out == nullptr) {
+      throw std::bad_alloc();
+    }
+#else
+    void* out;
+    if (posix_memalign(&out, alignment, bytes) != 0) {
+      throw std::bad_alloc();
+    }
+#endif
+    return out;
+  }
+
+  void
+  AlignedAllocator::deallocate(void* ptr, size_t, size_t) {
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+  }
+
+  void*
+  AlignedAllocator::reallocate(void* ptr,
+                               size_t oldbytes,
+                               size_t newbytes,
+                               size_t alignment) {
+    if (newbytes == 0) {
+      newbytes = alignment;
+    }
+#ifdef _MSC_VER
+    void* out = _aligned_realloc(ptr, newbytes, alignment);
+    if (out == nullptr) {
+      throw std::bad_alloc();
+    }
+    return out;
+#else
+    // realloc can extend in place (or remap large blocks), but it only
+    // promises malloc's alignment: if it moves the block off alignment,
+    // copy it once more.
+    void* out = realloc(ptr, newbytes);
+    if (out == nullptr) {
+      throw std::bad_alloc();
+    }
+    if (reinterpret_cast<uintptr_t>(out) % alignment != 0) {
+      void* aligned = allocate(newbytes, alignment);
+      memcpy(aligned, out, std::min(oldbytes, newbytes));
+      free(out);
+      out = aligned;
+    }
+    return out;
+#endif
+  }
+
+  ////////// HugePageAllocator
+
+  const size_t kHugePageSize = 2*1024*1024;
+
+  HugePageAllocator::HugePageAllocator(size_t threshold)
+      : threshold_(threshold) { }
+
+  size_t
+  HugePageAllocator::threshold() const {
+    return threshold_;
+  }
+
+  const std::string
+  HugePageAllocator::name() const {
+    return "HugePageAllocator";
+  }
+
+  void*
+  HugePageAllocator::allocate(size_t bytes, size_t alignment) {
+#ifdef _MSC_VER
+    return small_.allocate(bytes, alignment);
+#else
+    if (bytes < threshold_  ||  bytes == 0) {
+      return small_.allocate(bytes, alignment);
+    }
+    // mmap is page-aligned, which satisfies any array alignment.
+    size_t length = ((bytes + kHugePageSize - 1) / kHugePageSize)
+                    * kHugePageSize;
+    void* out = MAP_FAILED;
+  #ifdef MAP_HUGETLB
+    out = mmap(nullptr,
+               length,
+               PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+               -1,
+               0);
+  #endif
+    if (out == MAP_FAILED) {
+      out = mmap(nullptr,
+                 length,
+                 PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS,
+                 -1,
+                 0);
+      if (out == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+  #ifdef MADV_HUGEPAGE
+      madvise(out, length, MADV_HUGEPAGE);
+  #endif
+    }
+    return out;
+#endif
+  }
+
+  void
+  HugePageAllocator::deallocate(void* ptr, size_t bytes, size_t alignment) {
+#ifdef _MSC_VER
+    small_.deallocate(ptr, bytes, alignment);
+#else
+    if (bytes < threshold_  ||  bytes == 0) {
+      small_.deallocate(ptr, bytes, alignment);
+    }
+    else {
+      size_t length = ((bytes + kHugePageSize - 1) / kHugePageSize)
+                      * kHugePageSize;
+      munmap(ptr, length);
+    }
+#endif
+  }
+
+  void*
+  HugePageAllocator::reallocate(void* ptr,
+                                size_t oldbytes,
+                                size_t newbytes,
+                                size_t alignment) {
+#if defined __linux__ && defined MREMAP_MAYMOVE
+    if (oldbytes >= threshold_  &&  oldbytes != 0  &&
+        newbytes >= threshold_  &&  newbytes != 0) {
+      // Moves the pages without copying them.
+      size_t oldlength = ((oldbytes + kHugePageSize - 1) / kHugePageSize)
+                         * kHugePageSize;
+      size_t newlength = ((newbytes + kHugePageSize - 1) / kHugePageSize)
+                         * kHugePageSize;
+      void* out = mremap(ptr, oldlength, newlength, MREMAP_MAYMOVE);
+      if (out == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+      return out;
+    }
+#endif
+    if (oldbytes < threshold_  &&  newbytes < threshold_) {
+      return small_.reallocate(ptr, oldbytes, newbytes, alignment);
+    }
+    return Allocator::reallocate(ptr, oldbytes, newbytes, alignment);
+  }
+
+  bool
+  HugePageAllocator::grow(void*, size_t oldbytes, size_t newbytes, size_t) {
+#ifdef _MSC_VER
+    return false;
+#else
+    // Within the last huge page of the mapping.
+    size_t length = ((oldbytes + kHugePageSize - 1) / kHugePageSize)
+                    * kHugePageSize;
+    return (oldbytes >= threshold_  &&  oldbytes != 0  &&
+            newbytes >= oldbytes  &&  newbytes <= length);
+#endif
+  }
+
+  ////////// ReservingAllocator
+
+  ReservingAllocator::ReservingAllocator(size_t reservation)
+      : reservation_(reservation) { }
+
+  size_t
+  ReservingAllocator::reservation() const {
+    return reservation_;
+  }
+
+  const std::string
+  ReservingAllocator::name() const {
+    return "ReservingAllocator";
+  }
+
+  size_t
+  ReservingAllocator::mapped(size_t bytes) const {
+#ifdef _MSC_VER
+    return bytes;
+#else
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t length = std::max(bytes, reservation_);
+    if (length == 0) {
+      length = 1;
+    }
+    return ((length + page - 1) / page) * page;
+#endif
+  }
+
+  void*
+  ReservingAllocator::allocate(size_t bytes, size_t alignment) {
+#ifdef _MSC_VER
+    return small_.allocate(bytes, alignment);
+#else
+    // mmap is page-aligned, which satisfies any array alignment.
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+  #ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+  #endif
+    void* out = mmap(nullptr,
+                     mapped(bytes),
+                     PROT_READ | PROT_WRITE,
+                     flags,
+                     -1,
+                     0);
+    if (out == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    return out;
+#endif
+  }
+
+  void
+  ReservingAllocator::deallocate(void* ptr, size_t bytes, size_t alignment) {
+#ifdef _MSC_VER
+    small_.deallocate(ptr, bytes, alignment);
+#else
+    munmap(ptr, mapped(bytes));
+#endif
+  }
+
+  void*
+  ReservingAllocator::reallocate(void* ptr,
+                                 size_t oldbytes,
+                                 size_t newbytes,
+                                 size_t alignment) {
+#ifdef _MSC_VER
+    return small_.reallocate(ptr, oldbytes, newbytes, alignment);
+#else
+    size_t oldlength = mapped(oldbytes);
+    size_t newlength = mapped(newbytes);
+    if (newlength == oldlength) {
+      return ptr;
+    }
+    else if (newlength < oldlength) {
+      munmap(reinterpret_cast<uint8_t*>(ptr) + newlength,
+             oldlength - newlength);
+      return ptr;
+    }
+  #if defined __linux__ && defined MREMAP_MAYMOVE
+    void* out = mremap(ptr, oldlength, newlength, MREMAP_MAYMOVE);
+    if (out == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    return out;
+  #else
+    return Allocator::reallocate(ptr, oldbytes, newbytes, alignment);
+  #endif
+#endif
+  }
+
+  bool
+  ReservingAllocator::grow(void*, size_t oldbytes, size_t newbytes, size_t) {
+#ifdef _MSC_VER
+    return false;
+#else
+    return newbytes >= oldbytes  &&  mapped(newbytes) == mapped(oldbytes);
+#endif
+  }
+
+  ////////// CountingAllocator
+
+  CountingAllocator::CountingAllocator(const AllocatorPtr& inner)
+      : inner_(inner)
+      , allocations_(0)
+      , deallocations_(0)
+      , reallocations_(0)
+      , bytes_allocated_(0)
+      , bytes_in_use_(0)
+      , peak_bytes_in_use_(0) { }
+
+  const AllocatorPtr
+  CountingAllocator::inner() const {
+    return inner_;
+  }
+
+  int64_t
+  CountingAllocator::allocations() const {
+    return allocations_.load();
+  }
+
+  int64_t
+  CountingAllocator::deallocations() const {
+    return deallocations_.load();
+  }
+
+  int64_t
+  CountingAllocator::reallocations() const {
+    return reallocations_.load();
+  }
+
+  int64_t
+  CountingAllocator::bytes_allocated() const {
+    return bytes_allocated_.load();
+  }
+
+  int64_t
+  CountingAllocator::bytes_in_use() const {
+    return bytes_in_use_.load();
+  }
+
+  int64_t
+  CountingAllocator::peak_bytes_in_use() const {
+    return peak_bytes_in_use_.load();
+  }
+
+  void
+  CountingAllocator::reset() {
+    allocations_.store(0);
+    deallocations_.store(0);
+    reallocations_.store(0);
+    bytes_allocated_.store(0);
+    peak_bytes_in_use_.store(bytes_in_use_.load());
+  }
+
+  const std::string
+  CountingAllocator::name() const {
+    return std::string("CountingAllocator(") + inner_.get()->name()
+           + std::string(")");
+  }
+
+  void*
+  CountingAllocator::allocate(size_t bytes, size_t alignment) {
+    void* out = inner_.get()->allocate(bytes, alignment);
+    allocations_++;
+    bytes_allocated_ += (int64_t)bytes;
+    int64_t inuse = (bytes_in_use_ += (int64_t)bytes);
+    int64_t peak = peak_bytes_in_use_.load();
+    while (inuse > peak  &&
+           !peak_bytes_in_use_.compare_exchange_weak(peak, inuse)) { }
+    return out;
+  }
+
+  void
+  CountingAllocator::deallocate(void* ptr, size_t bytes, size_t alignment) {
+    inner_.get()->deallocate(ptr, bytes, alignment);
+    deallocations_++;
+    bytes_in_use_ -= (int64_t)bytes;
+  }
+
+  void*
+  CountingAllocator::reallocate(void* ptr,
+                                size_t oldbytes,
+                                size_t newbytes,
+                                size_t alignment) {
+    void* out = inner_.get()->reallocate(ptr, oldbytes, newbytes, alignment);
+    reallocations_++;
+    if (newbytes > oldbytes) {
+      bytes_allocated_ += (int64_t)(newbytes - oldbytes);
+    }
+    int64_t inuse = (bytes_in_use_ += (int64_t)newbytes - (int64_t)oldbytes);
+    int64_t peak = peak_bytes_in_use_.load();
+    while (inuse > peak  &&
+           !peak_bytes_in_use_.compare_exchange_weak(peak, inuse)) { }
+    return out;
+  }
+
+  bool
+  CountingAllocator::grow(void* ptr,
+                          size_t oldbytes,
+                          size_t newbytes,
+                          size_t alignment) {
+    if (!inner_.get()->grow(ptr, oldbytes, newbytes, alignment)) {
+      return false;
+    }
+    reallocations_++;
+    bytes_allocated_ += (int64_t)(newbytes - oldbytes);
+    int64_t inuse = (bytes_in_use_ += (int64_t)(newbytes - oldbytes));
+    int64_t peak = peak_bytes_in_use_.load();
+    while (inuse > peak  &&
+           !peak_bytes_in_use_.compare_exchange_weak(peak, inuse)) { }
+    return true;
+  }
+
+  ////////// global and scoped allocators
+
+  namespace {
+    // Function-local so that it is initialized before any static arrays.
+    AllocatorPtr&
+    global_allocator_storage() {
+      static AllocatorPtr out = std::make_shared<AlignedAllocator>();
+      return out;
+    }
+
+    thread_local AllocatorPtr scoped_allocator_;
+  }
+
+  const AllocatorPtr
+  global_allocator() {
+    return std::atomic_load(&global_allocator_storage());
+  }
+
+  void
+  set_global_allocator(const AllocatorPtr& allocator) {
+    if (allocator.get() == nullptr) {
+      std::atomic_store(&global_allocator_storage(),
+                        AllocatorPtr(std::make_shared<AlignedAllocator>()));
+    }
+    else {
+      std::atomic_store(&global_allocator_storage(), allocator);
+    }
+  }
+
+  const AllocatorPtr
+  current_allocator() {
+    if (scoped_allocator_.get() != nullptr) {
+      return scoped_allocator_;
+    }
+    return global_allocator();
+  }
+
+  AllocatorScope::AllocatorScope(const AllocatorPtr& allocator)
+      : previous_(scoped_allocator_) {
+    scoped_allocator_ = allocator;
+  }
+
+  AllocatorScope::~AllocatorScope() {
+    scoped_allocator_ = previous_;
+  }
+
+  ////////// scratch arena
+
+  namespace {
+    const size_t kScratchInitialBytes = 64*1024;
+    const size_t kScratchMaxBytes = 16*1024*1024;
+
+    class ScratchArena {
+    public:
+      ScratchArena()
+          : chunk_(nullptr)
+          , capacity_(kScratchInitialBytes)
+          , used_(0)
+          , depth_(0) { }
+
+      void
+        enter() {
+        depth_++;
+      }
+
+      void
+        exit() {
+        depth_--;
+        if (depth_ == 0) {
+          retired_.clear();
+        }
+        if (depth_ == 0  &&  chunk_.get() != nullptr) {
+          if (chunk_.use_count() == 1) {
+            used_ = 0;
+          }
+          else {
+            chunk_ = std::shared_ptr<uint8_t>(nullptr);
+          }
+        }
+      }
+
+      std::shared_ptr<void>
+        allocate(size_t bytes) {
+        if (depth_ == 0  ||  bytes > kScratchMaxBytes / 4) {
+          return std::shared_ptr<void>(nullptr);
+        }
+        bytes = ((bytes + kAllocatorAlignment - 1) / kAllocatorAlignment)
+                * kAllocatorAlignment;
+        if (bytes == 0) {
+          bytes = kAllocatorAlignment;
+        }
+        if (chunk_.get() == nullptr  ||  used_ + bytes > capacity_) {
+          if (chunk_.get() != nullptr) {
+            retired_.push_back(std::pair<const uint8_t*, size_t>(chunk_.get(),
+                                                                 capacity_));
+            capacity_ = std::min(2*capacity_, kScratchMaxBytes);
+          }
+          while (capacity_ < bytes) {
+            capacity_ *= 2;
+          }
+          chunk_ = allocate_array<uint8_t>((int64_t)capacity_);
+          used_ = 0;
+        }
+        std::shared_ptr<void> out(chunk_, chunk_.get() + used_);
+        used_ += bytes;
+        return out;
+      }
+
+      bool
+        contains(const void* ptr) const {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(ptr);
+        if (chunk_.get() != nullptr  &&
+            chunk_.get() <= p  &&  p < chunk_.get() + capacity_) {
+          return true;
+        }
+        for (auto chunk : retired_) {
+          if (chunk.first <= p  &&  p < chunk.first + chunk.second) {
+            return true;
+          }
+        }
+        return false;
+      }
+
+    private:
+      std::shared_ptr<uint8_t> chunk_;
+      // Chunks that this scope outgrew, which its arrays may still be in.
+      // (If one has been freed, a false positive only costs a copy.)
+      std::vector<std::pair<const uint8_t*, size_t>> retired_;
+      size_t capacity_;
+      size_t used_;
+      int64_t depth_;
+    };
+
+    thread_local ScratchArena scratch_arena_;
+  }
+
+  ScratchScope::ScratchScope() {
+    scratch_arena_.enter();
+  }
+
+  ScratchScope::~ScratchScope() {
+    scratch_arena_.exit();
+  }
+
+  std::shared_ptr<void>
+  scratch_allocate(size_t bytes) {
+    return scratch_arena_.allocate(bytes);
+  }
+
+  bool
+  is_scratch(const void* ptr) {
+    return scratch_arena_.contains(ptr);
+  }
+}
@@ -1,7 +1,9 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <atomic>
 #include <sstream>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/operations.h"
 #include "awkward/cpu-kernels/reducers.h"
 #include "awkward/array/RegularArray.h"
@@ -18,6 +20,36 @@
 #include "awkward/Content.h"
 
 namespace awkward {
+  // A node's type, and the memos of the nodes it was built from: it is
+  // stale if any of them has had its parameters changed since. (Nodes that
+  // are replaced, as by setidentities, keep their types.)
+  struct Content::TypeMemo {
+    util::TypeStrs typestrs;
+    std::shared_ptr<std::atomic<bool>> stale;
+    std::vector<std::shared_ptr<const TypeMemo>> children;
+    TypePtr type;
+
+    bool
+      valid() const {
+      if (stale.get()->load()) {
+        return false;
+      }
+      for (auto child : children) {
+        if (!child.get()->valid()) {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+  std::vector<std::shared_ptr<const Content::TypeMemo>>*&
+  Content::typememo_children() {
+    static thread_local std::vector<std::shared_ptr<const TypeMemo>>* out =
+      nullptr;
+    return out;
+  }
+
   Content::Content(const IdentitiesPtr& identities,
                    const util::Parameters& parameters)
       : identities_(identities)
@@ -35,6 +67,77 @@ namespace awkward {
     return identities_;
   }
 
+  void
+  Content::setvirtualidentities() {
+    setidentities(std::make_shared<VirtualIdentities>(Identities::newref(),
+                                                      Identities::FieldLoc(),
+                                                      length()));
+  }
+
+  void
+  Content::setcompressedidentities() {
+    VirtualIdentities root(Identities::newref(),
+                           Identities::FieldLoc(),
+                           length());
+    setidentities(CompressedIdentities::compress(root));
+  }
+
+  const TypePtr
+  Content::type(const util::TypeStrs& typestrs) const {
+    std::shared_ptr<const TypeMemo> memo = std::atomic_load(&typememo_);
+    if (memo.get() == nullptr  ||
+        memo.get()->typestrs != typestrs  ||
+        !memo.get()->valid()) {
+      // Taken before type_part, so that a change during it is not missed.
+      std::shared_ptr<std::atomic<bool>> stale =
+        std::atomic_load(&typestale_);
+      while (stale.get() == nullptr  ||  stale.get()->load()) {
+        std::shared_ptr<std::atomic<bool>> fresh =
+          std::make_shared<std::atomic<bool>>(false);
+        if (std::atomic_compare_exchange_strong(&typestale_, &stale, fresh)) {
+          stale = fresh;
+        }
+      }
+      std::vector<std::shared_ptr<const TypeMemo>> children;
+      std::vector<std::shared_ptr<const TypeMemo>>* outer =
+        typememo_children();
+      typememo_children() = &children;
+      TypePtr out;
+      try {
+        out = Type::intern(type_part(typestrs));
+      }
+      catch (...) {
+        typememo_children() = outer;
+        throw;
+      }
+      typememo_children() = outer;
+      memo = std::shared_ptr<const TypeMemo>(
+        new TypeMemo({ typestrs, stale, children, out }));
+      std::atomic_store(&typememo_, memo);
+    }
+    if (typememo_children() != nullptr) {
+      typememo_children()->push_back(memo);
+    }
+    return memo.get()->type;
+  }
+
+  void
+  Content::settypestale() {
+    std::shared_ptr<std::atomic<bool>> stale =
+      std::atomic_exchange(&typestale_,
+                           std::shared_ptr<std::atomic<bool>>(nullptr));
+    if (stale.get() != nullptr) {
+      stale.get()->store(true);
+    }
+  }
+
+  const ContentPtr
+  Content::withidentities(const IdentitiesPtr& identities) const {
+    ContentPtr out = shallow_copy();
+    out.get()->setidentities(identities);
+    return out;
+  }
+
   const std::string
   Content::tostring() const {
     return tostring_part("", "", "");
@@ -92,11 +195,51 @@ namespace awkward {
                   int64_t axis,
                   bool mask,
                   bool keepdims) const {
+    // The reducer is borrowed for the duration of the call, not owned.
+    ReducerPtr borrowed(&reducer, [](const Reducer*) -> void { });
+    return reduce_multi(ContentPtrVec({ shallow_copy() }),
+                        ReducerPtrVec({ borrowed }),
+                        axis,
+                        mask,
+                        keepdims)[0];
+  }
+
+  const ContentPtrVec
+  Content::reduce_multi(const ContentPtrVec& contents,
+                        const ReducerPtrVec& reducers,
+                        int64_t axis,
+                        bool mask,
+                        bool keepdims) {
+    if (contents.empty()  ||  contents.size() != reducers.size()) {
+      throw std::invalid_argument(
+        "reduce_multi needs exactly one reducer for each array");
+    }
+    const ContentPtr& first = contents[0];
+    for (auto content : contents) {
+      if (content.get()->length() != first.get()->length()) {
+        throw std::invalid_argument(
+          "arrays reduced together must have the same length");
+      }
+    }
+
     int64_t negaxis = -axis;
-    std::pair<bool, int64_t> branchdepth = branch_depth();
+    std::pair<bool, int64_t> branchdepth = first.get()->branch_depth();
     bool branch = branchdepth.first;
     int64_t depth = branchdepth.second;
 
+    for (auto content : contents) {
+      if (content.get()->branch_depth() != branchdepth) {
+        ContentPtrVec out;
+        for (size_t i = 0;  i < contents.size();  i++) {
+          out.push_back(contents[i].get()->reduce(*reducers[i].get(),
+                                                  axis,
+                                                  mask,
+                                                  keepdims));
+        }
+        return out;
+      }
+    }
+
     if (branch) {
       if (negaxis <= 0) {
         throw std::invalid_argument(
@@ -125,23 +268,55 @@ namespace awkward {
       }
     }
 
-    Index64 starts(1);
+    // Temporary indexes in the whole reduction come from the scratch arena.
+    ScratchScope scratch;
+
+    Index64 starts = Index64::scratch(1);
     starts.setitem_at_nowrap(0, 0);
 
-    Index64 parents(length());
+    Index64 parents = Index64::scratch(first.get()->length());
     struct Error err = awkward_content_reduce_zeroparents_64(
       parents.ptr().get(),
-      length());
-    util::handle_error(err, classname(), identities_.get());
+      first.get()->length());
+    util::handle_error(err,
+                       first.get()->classname(),
+                       first.get()->identities().get());
+
+    ContentPtrVec nexts = first.get()->reduce_next_multi(contents,
+                                                         reducers,
+                                                         negaxis,
+                                                         starts,
+                                                         parents,
+                                                         1,
+                                                         mask,
+                                                         keepdims);
+    ContentPtrVec out;
+    for (auto next : nexts) {
+      out.push_back(next.get()->getitem_at_nowrap(0));
+    }
+    return out;
+  }
 
-    ContentPtr next = reduce_next(reducer,
-                                  negaxis,
-                                  starts,
-                                  parents,
-                                  1,
-                                  mask,
-                                  keepdims);
-    return next.get()->getitem_at_nowrap(0);
+  const ContentPtrVec
+  Content::reduce_next_multi(const ContentPtrVec& contents,
+                             const ReducerPtrVec& reducers,
+                             int64_t negaxis,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength,
+                             bool mask,
+                             bool keepdims) const {
+    ContentPtrVec out;
+    for (size_t i = 0;  i < contents.size();  i++) {
+      out.push_back(contents[i].get()->reduce_next(*reducers[i].get(),
+                                                   negaxis,
+                                                   starts,
+                                                   parents,
+                                                   outlength,
+                                                   mask,
+                                                   keepdims));
+    }
+    return out;
   }
 
   const util::Parameters
@@ -152,6 +327,15 @@ namespace awkward {
   void
   Content::setparameters(const util::Parameters& parameters) {
     parameters_ = parameters;
+    settypestale();
+  }
+
+  const ContentPtr
+  Content::withparameters(const util::Parameters& parameters) const {
+    // a new node, so no memo can have seen it
+    ContentPtr out = shallow_copy();
+    out.get()->parameters_ = parameters;
+    return out;
   }
 
   const std::string
@@ -166,6 +350,15 @@ namespace awkward {
   void
   Content::setparameter(const std::string& key, const std::string& value) {
     parameters_[key] = value;
+    settypestale();
+  }
+
+  const ContentPtr
+  Content::withparameter(const std::string& key,
+                         const std::string& value) const {
+    ContentPtr out = shallow_copy();
+    out.get()->parameters_[key] = value;
+    return out;
   }
 
   bool
@@ -279,8 +472,7 @@ namespace awkward {
     std::vector<std::shared_ptr<int64_t>> tocarry;
     std::vector<int64_t*> tocarryraw;
     for (int64_t j = 0;  j < n;  j++) {
-      std::shared_ptr<int64_t> ptr(new int64_t[(size_t)chooselen],
-                                   util::array_deleter<int64_t>());
+      std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(chooselen));
       tocarry.push_back(ptr);
       tocarryraw.push_back(ptr.get());
     }
@@ -308,6 +500,7 @@ namespace awkward {
 
   const ContentPtr
   Content::getitem(const Slice& where) const {
+    ScratchScope scratch;
     ContentPtr next = std::make_shared<RegularArray>(Identities::none(),
                                                      util::Parameters(),
                                                      shallow_copy(),
@@ -1,11 +1,13 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <algorithm>
 #include <cstring>
 #include <atomic>
 #include <iomanip>
 #include <sstream>
 #include <type_traits>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
 #include "awkward/Slice.h"
@@ -68,8 +70,7 @@ namespace awkward {
                                 int64_t length)
       : Identities(ref, fieldloc, 0, width, length)
       , ptr_(std::shared_ptr<T>(
-          length*width == 0 ? nullptr : new T[(size_t)(length*width)],
-          util::array_deleter<T>())) { }
+          length*width == 0 ? nullptr : allocate_array<T>(length*width))) { }
 
   template <typename T>
   IdentitiesOf<T>::IdentitiesOf(const Ref ref,
@@ -212,8 +213,7 @@ namespace awkward {
   template <typename T>
   const IdentitiesPtr
   IdentitiesOf<T>::deep_copy() const {
-    std::shared_ptr<T> ptr(length_ == 0 ? nullptr : new T[(size_t)length_],
-                           util::array_deleter<T>());
+    std::shared_ptr<T> ptr(length_ == 0 ? nullptr : allocate_array<T>(length_));
     if (length_ != 0) {
       memcpy(ptr.get(),
              &ptr_.get()[(size_t)offset_],
@@ -329,4 +329,1151 @@ namespace awkward {
 
   template class IdentitiesOf<int32_t>;
   template class IdentitiesOf<int64_t>;
+
+  ////////// EncodedIdentities
+
+  EncodedIdentities::EncodedIdentities(const Ref ref,
+                                       const FieldLoc& fieldloc,
+                                       int64_t offset,
+                                       int64_t width,
+                                       int64_t length)
+      : Identities(ref, fieldloc, offset, width, length) { }
+
+  const std::string
+  EncodedIdentities::identity_at(int64_t at) const {
+    std::stringstream out;
+    for (int64_t i = 0;  i < width_;  i++) {
+      if (i != 0) {
+        out << ", ";
+      }
+      out << value(at, i);
+      for (auto pair : fieldloc_) {
+        if (pair.first == i) {
+          out << ", " << util::quote(pair.second, true);
+        }
+      }
+    }
+    return out.str();
+  }
+
+  ////////// VirtualIdentities
+
+  VirtualIdentities::VirtualIdentities(const Ref ref,
+                                       const FieldLoc& fieldloc,
+                                       int64_t length)
+      : EncodedIdentities(ref, fieldloc, 0, 1, length)
+      , kind_(Kind::root)
+      , baselength_(length)
+      , parent_(nullptr)
+      , index_(0)
+      , stops_(0)
+      , tags_(0)
+      , size_(0) { }
+
+  VirtualIdentities::VirtualIdentities(const Ref ref,
+                                       const FieldLoc& fieldloc,
+                                       int64_t offset,
+                                       int64_t width,
+                                       int64_t length,
+                                       Kind kind,
+                                       int64_t baselength,
+                                       const IdentitiesPtr& parent,
+                                       const Index64& index,
+                                       const Index64& stops,
+                                       const Index8& tags,
+                                       int64_t size)
+      : EncodedIdentities(ref, fieldloc, offset, width, length)
+      , kind_(kind)
+      , baselength_(baselength)
+      , parent_(parent)
+      , index_(index)
+      , stops_(stops)
+      , tags_(tags)
+      , size_(size) { }
+
+  VirtualIdentities::Kind
+  VirtualIdentities::kind() const {
+    return kind_;
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::parent() const {
+    return parent_;
+  }
+
+  const std::string
+  VirtualIdentities::classname() const {
+    return "VirtualIdentities";
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::to64() const {
+    IdentitiesPtr base = materialize();
+    if (base.get() == nullptr) {
+      return base;
+    }
+    return base.get()->getitem_range_nowrap(offset_, offset_ + length_);
+  }
+
+  const std::string
+  VirtualIdentities::tostring_part(const std::string& indent,
+                                   const std::string& pre,
+                                   const std::string& post) const {
+    std::string kind;
+    if (kind_ == Kind::root) {
+      kind = "root";
+    }
+    else if (kind_ == Kind::carry) {
+      kind = "carry";
+    }
+    else if (kind_ == Kind::listarray) {
+      kind = "listarray";
+    }
+    else if (kind_ == Kind::regulararray) {
+      kind = "regulararray";
+    }
+    else if (kind_ == Kind::indexedarray) {
+      kind = "indexedarray";
+    }
+    else if (kind_ == Kind::unionarray) {
+      kind = "unionarray";
+    }
+    else {
+      kind = "extend";
+    }
+    std::stringstream out;
+    out << indent << pre << "<VirtualIdentities ref=\"" << ref_
+        << "\" fieldloc=\"[";
+    for (size_t i = 0;  i < fieldloc_.size();  i++) {
+      if (i != 0) {
+        out << " ";
+      }
+      out << "(" << fieldloc_[i].first << ", "
+          << util::quote(fieldloc_[i].second, false) << ")";
+    }
+    out << "]\" width=\"" << width_ << "\" offset=\"" << offset_
+        << "\" length=\"" << length_ << "\" kind=\"" << kind << "\"/>"
+        << post;
+    return out.str();
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::getitem_range_nowrap(int64_t start, int64_t stop) const {
+    if (!(0 <= start  &&  start < length_  &&  0 <= stop  &&  stop <= length_)
+        &&  start != stop) {
+      throw std::runtime_error(
+        "Identities::getitem_range_nowrap with illegal start:stop "
+        "for this length");
+    }
+    return std::make_shared<VirtualIdentities>(
+      ref_,
+      fieldloc_,
+      offset_ + start*(start != stop),
+      width_,
+      (stop - start),
+      kind_,
+      baselength_,
+      parent_,
+      index_,
+      stops_,
+      tags_,
+      size_);
+  }
+
+  void
+  VirtualIdentities::nbytes_part(std::map<size_t, int64_t>& largest) const {
+    // Only the carries are its own; the other indexes belong to the layout.
+    index_.nbytes_part(largest);
+    stops_.nbytes_part(largest);
+    tags_.nbytes_part(largest);
+    if (parent_.get() != nullptr) {
+      parent_.get()->nbytes_part(largest);
+    }
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::shallow_copy() const {
+    return std::make_shared<VirtualIdentities>(ref_,
+                                               fieldloc_,
+                                               offset_,
+                                               width_,
+                                               length_,
+                                               kind_,
+                                               baselength_,
+                                               parent_,
+                                               index_,
+                                               stops_,
+                                               tags_,
+                                               size_);
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::deep_copy() const {
+    // Nothing here is ever modified, so there is nothing to copy.
+    return shallow_copy();
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::getitem_carry_64(const Index64& carry) const {
+    if (kind_ == Kind::carry) {
+      // A carry of a carry is a single carry of the same parent, so that
+      // repeated selections do not make a chain as long as their number.
+      Index64 nextcarry(carry.length());
+      struct Error err = awkward_index64_carry_nocheck_64(
+        nextcarry.ptr().get(),
+        index_.ptr().get(),
+        carry.ptr().get(),
+        index_.offset() + offset_,
+        carry.length());
+      util::handle_error(err, classname(), nullptr);
+      return std::make_shared<VirtualIdentities>(ref_,
+                                                 fieldloc_,
+                                                 0,
+                                                 width_,
+                                                 carry.length(),
+                                                 Kind::carry,
+                                                 carry.length(),
+                                                 parent_,
+                                                 nextcarry,
+                                                 Index64(0),
+                                                 Index8(0),
+                                                 0);
+    }
+    // The carry is kept, so it must not be a temporary in a scratch arena.
+    return std::make_shared<VirtualIdentities>(
+      ref_,
+      fieldloc_,
+      0,
+      width_,
+      carry.length(),
+      Kind::carry,
+      carry.length(),
+      shallow_copy(),
+      is_scratch(carry.ptr().get()) ? carry.deep_copy() : carry,
+      Index64(0),
+      Index8(0),
+      0);
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::withfieldloc(const FieldLoc& fieldloc) const {
+    return std::make_shared<VirtualIdentities>(ref_,
+                                               fieldloc,
+                                               offset_,
+                                               width_,
+                                               length_,
+                                               kind_,
+                                               baselength_,
+                                               parent_,
+                                               index_,
+                                               stops_,
+                                               tags_,
+                                               size_);
+  }
+
+  int64_t
+  VirtualIdentities::value(int64_t row, int64_t col) const {
+    int64_t baserow = offset_ + row;
+    if (kind_ == Kind::root) {
+      return baserow;
+    }
+    int64_t local = -1;
+    int64_t parentrow = VirtualIdentities::parentrow(baserow, local);
+    if (parentrow < 0) {
+      return -1;
+    }
+    else if (col == parent_.get()->width()) {
+      return local;
+    }
+    else {
+      return parent_.get()->value(parentrow, col);
+    }
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::from_listarray(const Index64& starts,
+                                    const Index64& stops,
+                                    int64_t tolength) const {
+    return child(Kind::listarray,
+                 width_ + 1,
+                 tolength,
+                 starts,
+                 stops,
+                 Index8(0),
+                 0);
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::from_regulararray(int64_t size, int64_t tolength) const {
+    return child(Kind::regulararray,
+                 width_ + 1,
+                 tolength,
+                 Index64(0),
+                 Index64(0),
+                 Index8(0),
+                 size);
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::from_indexedarray(const Index64& index,
+                                       int64_t tolength) const {
+    return child(Kind::indexedarray,
+                 width_,
+                 tolength,
+                 index,
+                 Index64(0),
+                 Index8(0),
+                 0);
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::from_unionarray(const Index8& tags,
+                                     const Index64& index,
+                                     int64_t which,
+                                     int64_t tolength) const {
+    return child(Kind::unionarray,
+                 width_,
+                 tolength,
+                 index,
+                 Index64(0),
+                 tags,
+                 which);
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::extend(int64_t tolength) const {
+    return child(Kind::extend,
+                 width_,
+                 tolength,
+                 Index64(0),
+                 Index64(0),
+                 Index8(0),
+                 0);
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::child(Kind kind,
+                           int64_t width,
+                           int64_t tolength,
+                           const Index64& index,
+                           const Index64& stops,
+                           const Index8& tags,
+                           int64_t size) const {
+    return std::make_shared<VirtualIdentities>(Identities::newref(),
+                                               fieldloc_,
+                                               0,
+                                               width,
+                                               tolength,
+                                               kind,
+                                               tolength,
+                                               shallow_copy(),
+                                               index,
+                                               stops,
+                                               tags,
+                                               size);
+  }
+
+  int64_t
+  VirtualIdentities::parentrow(int64_t baserow, int64_t& local) const {
+    // Linear searches are fine: this is only for the rows in error messages.
+    if (kind_ == Kind::carry) {
+      return index_.getitem_at_nowrap(baserow);
+    }
+    else if (kind_ == Kind::listarray) {
+      for (int64_t i = 0;  i < index_.length();  i++) {
+        int64_t start = index_.getitem_at_nowrap(i);
+        if (start <= baserow  &&  baserow < stops_.getitem_at_nowrap(i)) {
+          local = baserow - start;
+          return i;
+        }
+      }
+    }
+    else if (kind_ == Kind::regulararray) {
+      if (size_ > 0  &&  baserow / size_ < parent_.get()->length()) {
+        local = baserow % size_;
+        return baserow / size_;
+      }
+    }
+    else if (kind_ == Kind::indexedarray) {
+      for (int64_t i = 0;  i < index_.length();  i++) {
+        if (index_.getitem_at_nowrap(i) == baserow) {
+          return i;
+        }
+      }
+    }
+    else if (kind_ == Kind::unionarray) {
+      for (int64_t i = 0;  i < index_.length();  i++) {
+        if (tags_.getitem_at_nowrap(i) == size_  &&
+            index_.getitem_at_nowrap(i) == baserow) {
+          return i;
+        }
+      }
+    }
+    else if (kind_ == Kind::extend) {
+      if (baserow < parent_.get()->length()) {
+        return baserow;
+      }
+    }
+    return -1;
+  }
+
+  const IdentitiesPtr
+  VirtualIdentities::materialize() const {
+    if (kind_ == Kind::root) {
+      IdentitiesPtr out = std::make_shared<Identities64>(ref_,
+                                                         fieldloc_,
+                                                         1,
+                                                         baselength_);
+      Identities64* rawout = reinterpret_cast<Identities64*>(out.get());
+      struct Error err = awkward_new_identities64(rawout->ptr().get(),
+                                                  baselength_);
+      util::handle_error(err, classname(), nullptr);
+      return out;
+    }
+
+    IdentitiesPtr parent = parent_.get()->to64();
+    Identities64* rawparent = dynamic_cast<Identities64*>(parent.get());
+    if (rawparent == nullptr) {
+      return Identities::none();
+    }
+    IdentitiesPtr out = std::make_shared<Identities64>(ref_,
+                                                       fieldloc_,
+                                                       width_,
+                                                       baselength_);
+    Identities64* rawout = reinterpret_cast<Identities64*>(out.get());
+    bool uniquecontents = true;
+    struct Error err;
+    if (kind_ == Kind::carry) {
+      err = awkward_identities64_getitem_carry_64(
+        rawout->ptr().get(),
+        rawparent->ptr().get(),
+        &index_.ptr().get()[index_.offset()],
+        index_.length(),
+        rawparent->offset(),
+        rawparent->width(),
+        rawparent->length());
+    }
+    else if (kind_ == Kind::listarray) {
+      err = awkward_identities64_from_listarray64(
+        &uniquecontents,
+        rawout->ptr().get(),
+        rawparent->ptr().get(),
+        index_.ptr().get(),
+        stops_.ptr().get(),
+        rawparent->offset(),
+        index_.offset(),
+        stops_.offset(),
+        baselength_,
+        rawparent->length(),
+        rawparent->width());
+    }
+    else if (kind_ == Kind::regulararray) {
+      err = awkward_identities64_from_regulararray(
+        rawout->ptr().get(),
+        rawparent->ptr().get(),
+        rawparent->offset(),
+        size_,
+        baselength_,
+        rawparent->length(),
+        rawparent->width());
+    }
+    else if (kind_ == Kind::indexedarray) {
+      err = awkward_identities64_from_indexedarray64(
+        &uniquecontents,
+        rawout->ptr().get(),
+        rawparent->ptr().get(),
+        index_.ptr().get(),
+        rawparent->offset(),
+        index_.offset(),
+        baselength_,
+        rawparent->length(),
+        rawparent->width());
+    }
+    else if (kind_ == Kind::unionarray) {
+      err = awkward_identities64_from_unionarray8_64(
+        &uniquecontents,
+        rawout->ptr().get(),
+        rawparent->ptr().get(),
+        tags_.ptr().get(),
+        index_.ptr().get(),
+        rawparent->offset(),
+        tags_.offset(),
+        index_.offset(),
+        baselength_,
+        rawparent->length(),
+        rawparent->width(),
+        size_);
+    }
+    else {
+      err = awkward_identities64_extend(
+        rawout->ptr().get(),
+        rawparent->ptr().get(),
+        rawparent->offset(),
+        rawparent->length()*rawparent->width(),
+        baselength_*width_);
+    }
+    util::handle_error(err, classname(), nullptr);
+    if (!uniquecontents) {
+      return Identities::none();
+    }
+    return out;
+  }
+  ////////// IdentitiesColumn
+
+  namespace {
+    int64_t
+    signedsize(int64_t minimum, int64_t maximum) {
+      if (minimum >= INT8_MIN  &&  maximum <= INT8_MAX) {
+        return 1;
+      }
+      else if (minimum >= INT16_MIN  &&  maximum <= INT16_MAX) {
+        return 2;
+      }
+      else if (minimum >= INT32_MIN  &&  maximum <= INT32_MAX) {
+        return 4;
+      }
+      else {
+        return 8;
+      }
+    }
+
+    int64_t
+    unsignedsize(uint64_t maximum) {
+      if (maximum <= UINT8_MAX) {
+        return 1;
+      }
+      else if (maximum <= UINT16_MAX) {
+        return 2;
+      }
+      else if (maximum <= UINT32_MAX) {
+        return 4;
+      }
+      else {
+        return 8;
+      }
+    }
+
+    void
+    pack(uint8_t* ptr, int64_t itemsize, int64_t at, int64_t x) {
+      switch (itemsize) {
+      case 1:
+        ptr[at] = (uint8_t)x;
+        break;
+      case 2:
+        reinterpret_cast<uint16_t*>(ptr)[at] = (uint16_t)x;
+        break;
+      case 4:
+        reinterpret_cast<uint32_t*>(ptr)[at] = (uint32_t)x;
+        break;
+      default:
+        reinterpret_cast<int64_t*>(ptr)[at] = x;
+      }
+    }
+  }
+
+  const IdentitiesColumn
+  IdentitiesColumn::encode(int64_t length,
+                           const std::function<int64_t(int64_t)>& getvalue) {
+    int64_t numblocks = (length + kBlockSize - 1) / kBlockSize;
+
+    // First pass: the size of each encoding. Differences are taken modulo
+    // 2**64, so that they add back exactly however far apart values are.
+    int64_t numruns = 0;
+    int64_t mindelta = 0;
+    int64_t maxdelta = 0;
+    uint64_t maxspread = 0;
+    int64_t blockmin = 0;
+    int64_t blockmax = 0;
+    int64_t previous = 0;
+    for (int64_t i = 0;  i < length;  i++) {
+      int64_t x = getvalue(i);
+      if (i == 0  ||  x != previous) {
+        numruns++;
+      }
+      if (i % kBlockSize == 0) {
+        maxspread = std::max(maxspread,
+                             (uint64_t)blockmax - (uint64_t)blockmin);
+        blockmin = x;
+        blockmax = x;
+      }
+      else {
+        int64_t delta = (int64_t)((uint64_t)x - (uint64_t)previous);
+        mindelta = std::min(mindelta, delta);
+        maxdelta = std::max(maxdelta, delta);
+        blockmin = std::min(blockmin, x);
+        blockmax = std::max(blockmax, x);
+      }
+      previous = x;
+    }
+    maxspread = std::max(maxspread,
+                         (uint64_t)blockmax - (uint64_t)blockmin);
+
+    int64_t deltasize = signedsize(mindelta, maxdelta);
+    int64_t referencesize = unsignedsize(maxspread);
+    int64_t runlengthbytes = numruns*2*(int64_t)sizeof(int64_t);
+    int64_t deltabytes = numblocks*(int64_t)sizeof(int64_t)
+                         + length*deltasize;
+    int64_t referencebytes = numblocks*(int64_t)sizeof(int64_t)
+                             + length*referencesize;
+
+    // Second pass: fill the smallest, preferring the ones with faster
+    // random access on ties.
+    if (runlengthbytes <= deltabytes  &&  runlengthbytes <= referencebytes) {
+      Index64 values(numruns);
+      Index64 runstops(numruns);
+      int64_t* rawvalues = values.ptr().get();
+      int64_t* rawrunstops = runstops.ptr().get();
+      int64_t run = -1;
+      for (int64_t i = 0;  i < length;  i++) {
+        int64_t x = getvalue(i);
+        if (i == 0  ||  x != rawvalues[run]) {
+          run++;
+          rawvalues[run] = x;
+        }
+        rawrunstops[run] = i + 1;
+      }
+      return IdentitiesColumn(Encoding::runlength,
+                              length,
+                              0,
+                              values,
+                              runstops,
+                              std::shared_ptr<uint8_t>(nullptr));
+    }
+    else if (referencebytes <= deltabytes) {
+      Index64 values(numblocks);
+      int64_t* rawvalues = values.ptr().get();
+      std::shared_ptr<uint8_t> packed =
+        allocate_array<uint8_t>(length*referencesize);
+      int64_t block[kBlockSize];
+      for (int64_t b = 0;  b < numblocks;  b++) {
+        int64_t start = b*kBlockSize;
+        int64_t stop = std::min(start + kBlockSize, length);
+        for (int64_t i = start;  i < stop;  i++) {
+          block[i - start] = getvalue(i);
+        }
+        int64_t reference = *std::min_element(block, block + (stop - start));
+        rawvalues[b] = reference;
+        for (int64_t i = start;  i < stop;  i++) {
+          pack(packed.get(),
+               referencesize,
+               i,
+               (int64_t)((uint64_t)block[i - start] - (uint64_t)reference));
+        }
+      }
+      return IdentitiesColumn(Encoding::frameofreference,
+                              length,
+                              referencesize,
+                              values,
+                              Index64(0),
+                              packed);
+    }
+    else {
+      Index64 values(numblocks);
+      int64_t* rawvalues = values.ptr().get();
+      std::shared_ptr<uint8_t> packed =
+        allocate_array<uint8_t>(length*deltasize);
+      for (int64_t i = 0;  i < length;  i++) {
+        int64_t x = getvalue(i);
+        if (i % kBlockSize == 0) {
+          rawvalues[i / kBlockSize] = x;
+          pack(packed.get(), deltasize, i, 0);
+        }
+        else {
+          pack(packed.get(),
+               deltasize,
+               i,
+               (int64_t)((uint64_t)x - (uint64_t)previous));
+        }
+        previous = x;
+      }
+      return IdentitiesColumn(Encoding::delta,
+                              length,
+                              deltasize,
+                              values,
+                              Index64(0),
+                              packed);
+    }
+  }
+
+  IdentitiesColumn::IdentitiesColumn(Encoding encoding,
+                                     int64_t length,
+                                     int64_t itemsize,
+                                     const Index64& values,
+                                     const Index64& runstops,
+                                     const std::shared_ptr<uint8_t>& packed)
+      : encoding_(encoding)
+      , length_(length)
+      , itemsize_(itemsize)
+      , values_(values)
+      , runstops_(runstops)
+      , packed_(packed) { }
+
+  IdentitiesColumn::Encoding
+  IdentitiesColumn::encoding() const {
+    return encoding_;
+  }
+
+  int64_t
+  IdentitiesColumn::length() const {
+    return length_;
+  }
+
+  int64_t
+  IdentitiesColumn::value(int64_t row) const {
+    if (encoding_ == Encoding::runlength) {
+      const int64_t* begin = &runstops_.ptr().get()[runstops_.offset()];
+      const int64_t* end = begin + runstops_.length();
+      return values_.getitem_at_nowrap(
+        (int64_t)(std::upper_bound(begin, end, row) - begin));
+    }
+    else if (encoding_ == Encoding::frameofreference) {
+      return (int64_t)((uint64_t)values_.getitem_at_nowrap(row / kBlockSize)
+                       + (uint64_t)packed_at(row));
+    }
+    else {
+      int64_t start = row - row % kBlockSize;
+      uint64_t out = (uint64_t)values_.getitem_at_nowrap(start / kBlockSize);
+      for (int64_t i = start + 1;  i <= row;  i++) {
+        out += (uint64_t)packed_at(i);
+      }
+      return (int64_t)out;
+    }
+  }
+
+  void
+  IdentitiesColumn::decode(int64_t start,
+                           int64_t length,
+                           int64_t* toptr,
+                           int64_t stride) const {
+    if (length == 0) {
+      return;
+    }
+    if (encoding_ == Encoding::runlength) {
+      const int64_t* runstops = &runstops_.ptr().get()[runstops_.offset()];
+      int64_t run = (int64_t)(std::upper_bound(runstops,
+                                               runstops + runstops_.length(),
+                                               start) - runstops);
+      for (int64_t i = 0;  i < length;  i++) {
+        if (start + i >= runstops[run]) {
+          run++;
+        }
+        toptr[i*stride] = values_.getitem_at_nowrap(run);
+      }
+    }
+    else if (encoding_ == Encoding::frameofreference) {
+      for (int64_t i = 0;  i < length;  i++) {
+        toptr[i*stride] = (int64_t)(
+          (uint64_t)values_.getitem_at_nowrap((start + i) / kBlockSize)
+          + (uint64_t)packed_at(start + i));
+      }
+    }
+    else {
+      uint64_t x = (uint64_t)value(start);
+      toptr[0] = (int64_t)x;
+      for (int64_t i = 1;  i < length;  i++) {
+        if ((start + i) % kBlockSize == 0) {
+          x = (uint64_t)values_.getitem_at_nowrap((start + i) / kBlockSize);
+        }
+        else {
+          x += (uint64_t)packed_at(start + i);
+        }
+        toptr[i*stride] = (int64_t)x;
+      }
+    }
+  }
+
+  int64_t
+  IdentitiesColumn::nbytes() const {
+    return (values_.length() + runstops_.length())*(int64_t)sizeof(int64_t)
+           + length_*itemsize_;
+  }
+
+  void
+  IdentitiesColumn::nbytes_part(std::map<size_t, int64_t>& largest) const {
+    values_.nbytes_part(largest);
+    runstops_.nbytes_part(largest);
+    if (packed_.get() != nullptr) {
+      size_t x = (size_t)packed_.get();
+      auto it = largest.find(x);
+      if (it == largest.end()  ||  it->second < length_*itemsize_) {
+        largest[x] = length_*itemsize_;
+      }
+    }
+  }
+
+  int64_t
+  IdentitiesColumn::packed_at(int64_t at) const {
+    // delta is signed; frameofreference, unsigned
+    const uint8_t* ptr = packed_.get();
+    bool issigned = (encoding_ == Encoding::delta);
+    switch (itemsize_) {
+    case 1:
+      return issigned ? (int64_t)reinterpret_cast<const int8_t*>(ptr)[at]
+                      : (int64_t)ptr[at];
+    case 2:
+      return issigned ? (int64_t)reinterpret_cast<const int16_t*>(ptr)[at]
+                      : (int64_t)reinterpret_cast<const uint16_t*>(ptr)[at];
+    case 4:
+      return issigned ? (int64_t)reinterpret_cast<const int32_t*>(ptr)[at]
+                      : (int64_t)reinterpret_cast<const uint32_t*>(ptr)[at];
+    default:
+      return reinterpret_cast<const int64_t*>(ptr)[at];
+    }
+  }
+
+  ////////// CompressedIdentities
+
+  const IdentitiesPtr
+  CompressedIdentities::compress(const Identities& identities) {
+    // VirtualIdentities below the root search for each row, so those are
+    // materialized first.
+    IdentitiesPtr materialized(nullptr);
+    const Identities* source = &identities;
+    if (const VirtualIdentities* rawvirtual =
+        dynamic_cast<const VirtualIdentities*>(&identities)) {
+      if (rawvirtual->kind() != VirtualIdentities::Kind::root) {
+        materialized = rawvirtual->to64();
+        if (materialized.get() == nullptr) {
+          return materialized;
+        }
+        source = materialized.get();
+      }
+    }
+    std::vector<IdentitiesColumn> columns;
+    for (int64_t col = 0;  col < source->width();  col++) {
+      columns.push_back(IdentitiesColumn::encode(
+        source->length(),
+        [source, col](int64_t row) -> int64_t {
+          return source->value(row, col);
+        }));
+    }
+    return std::make_shared<CompressedIdentities>(source->ref(),
+                                                  source->fieldloc(),
+                                                  0,
+                                                  source->width(),
+                                                  source->length(),
+                                                  columns);
+  }
+
+  CompressedIdentities::CompressedIdentities(
+    const Ref ref,
+    const FieldLoc& fieldloc,
+    int64_t offset,
+    int64_t width,
+    int64_t length,
+    const std::vector<IdentitiesColumn>& columns)
+      : EncodedIdentities(ref, fieldloc, offset, width, length)
+      , columns_(columns) { }
+
+  const std::vector<IdentitiesColumn>
+  CompressedIdentities::columns() const {
+    return columns_;
+  }
+
+  const std::string
+  CompressedIdentities::classname() const {
+    return "CompressedIdentities";
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::to64() const {
+    IdentitiesPtr out = std::make_shared<Identities64>(ref_,
+                                                       fieldloc_,
+                                                       width_,
+                                                       length_);
+    Identities64* rawout = reinterpret_cast<Identities64*>(out.get());
+    for (int64_t col = 0;  col < width_;  col++) {
+      columns_[(size_t)col].decode(offset_,
+                                   length_,
+                                   &rawout->ptr().get()[col],
+                                   width_);
+    }
+    return out;
+  }
+
+  const std::string
+  CompressedIdentities::tostring_part(const std::string& indent,
+                                      const std::string& pre,
+                                      const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<CompressedIdentities ref=\"" << ref_
+        << "\" fieldloc=\"[";
+    for (size_t i = 0;  i < fieldloc_.size();  i++) {
+      if (i != 0) {
+        out << " ";
+      }
+      out << "(" << fieldloc_[i].first << ", "
+          << util::quote(fieldloc_[i].second, false) << ")";
+    }
+    out << "]\" width=\"" << width_ << "\" offset=\"" << offset_
+        << "\" length=\"" << length_ << "\" encodings=\"";
+    for (size_t i = 0;  i < columns_.size();  i++) {
+      if (i != 0) {
+        out << " ";
+      }
+      if (columns_[i].encoding() == IdentitiesColumn::Encoding::runlength) {
+        out << "runlength";
+      }
+      else if (columns_[i].encoding() == IdentitiesColumn::Encoding::delta) {
+        out << "delta";
+      }
+      else {
+        out << "frameofreference";
+      }
+    }
+    out << "\"/>" << post;
+    return out.str();
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::getitem_range_nowrap(int64_t start,
+                                             int64_t stop) const {
+    if (!(0 <= start  &&  start < length_  &&  0 <= stop  &&  stop <= length_)
+        &&  start != stop) {
+      throw std::runtime_error(
+        "Identities::getitem_range_nowrap with illegal start:stop "
+        "for this length");
+    }
+    return std::make_shared<CompressedIdentities>(
+      ref_,
+      fieldloc_,
+      offset_ + start*(start != stop),
+      width_,
+      (stop - start),
+      columns_);
+  }
+
+  void
+  CompressedIdentities::nbytes_part(
+    std::map<size_t, int64_t>& largest) const {
+    for (auto column : columns_) {
+      column.nbytes_part(largest);
+    }
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::shallow_copy() const {
+    return std::make_shared<CompressedIdentities>(ref_,
+                                                  fieldloc_,
+                                                  offset_,
+                                                  width_,
+                                                  length_,
+                                                  columns_);
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::deep_copy() const {
+    // Columns are never modified, so there is nothing to copy.
+    return shallow_copy();
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::getitem_carry_64(const Index64& carry) const {
+    for (int64_t i = 0;  i < carry.length();  i++) {
+      int64_t at = carry.getitem_at_nowrap(i);
+      if (at < 0  ||  at >= length_) {
+        util::handle_error(failure("index out of range", kSliceNone, at),
+                           classname(),
+                           nullptr);
+      }
+    }
+    std::vector<IdentitiesColumn> columns;
+    for (auto column : columns_) {
+      columns.push_back(IdentitiesColumn::encode(
+        carry.length(),
+        [this, &column, &carry](int64_t row) -> int64_t {
+          return column.value(offset_ + carry.getitem_at_nowrap(row));
+        }));
+    }
+    return std::make_shared<CompressedIdentities>(ref_,
+                                                  fieldloc_,
+                                                  0,
+                                                  width_,
+                                                  carry.length(),
+                                                  columns);
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::withfieldloc(const FieldLoc& fieldloc) const {
+    return std::make_shared<CompressedIdentities>(ref_,
+                                                  fieldloc,
+                                                  offset_,
+                                                  width_,
+                                                  length_,
+                                                  columns_);
+  }
+
+  int64_t
+  CompressedIdentities::value(int64_t row, int64_t col) const {
+    return columns_[(size_t)col].value(offset_ + row);
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::from_listarray(const Index64& starts,
+                                       const Index64& stops,
+                                       int64_t tolength) const {
+    std::shared_ptr<int64_t> parents = scratch_array<int64_t>(tolength);
+    int64_t* rawparents = parents.get();
+    for (int64_t j = 0;  j < tolength;  j++) {
+      rawparents[j] = -1;
+    }
+    for (int64_t i = 0;  i < length_;  i++) {
+      int64_t start = starts.getitem_at_nowrap(i);
+      int64_t stop = stops.getitem_at_nowrap(i);
+      if (start != stop  &&  stop > tolength) {
+        util::handle_error(
+          failure("max(stop) > len(content)", i, kSliceNone),
+          classname(),
+          nullptr);
+      }
+      for (int64_t j = start;  j < stop;  j++) {
+        if (rawparents[j] != -1) {
+          return Identities::none();
+        }
+        rawparents[j] = i;
+      }
+    }
+    return child(width_ + 1,
+                 tolength,
+                 [rawparents](int64_t j) -> int64_t {
+                   return rawparents[j];
+                 },
+                 [rawparents, &starts](int64_t j) -> int64_t {
+                   return j - starts.getitem_at_nowrap(rawparents[j]);
+                 });
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::from_regulararray(int64_t size,
+                                          int64_t tolength) const {
+    int64_t length = length_;
+    return child(width_ + 1,
+                 tolength,
+                 [size, length](int64_t j) -> int64_t {
+                   return (size > 0  &&  j / size < length) ? j / size : -1;
+                 },
+                 [size](int64_t j) -> int64_t {
+                   return j % size;
+                 });
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::from_indexedarray(const Index64& index,
+                                          int64_t tolength) const {
+    std::shared_ptr<int64_t> parents = scratch_array<int64_t>(tolength);
+    int64_t* rawparents = parents.get();
+    for (int64_t j = 0;  j < tolength;  j++) {
+      rawparents[j] = -1;
+    }
+    for (int64_t i = 0;  i < length_;  i++) {
+      int64_t j = index.getitem_at_nowrap(i);
+      if (j >= tolength) {
+        util::handle_error(failure("max(index) > len(content)", i, j),
+                           classname(),
+                           nullptr);
+      }
+      else if (j >= 0) {
+        if (rawparents[j] != -1) {
+          return Identities::none();
+        }
+        rawparents[j] = i;
+      }
+    }
+    return child(width_,
+                 tolength,
+                 [rawparents](int64_t j) -> int64_t {
+                   return rawparents[j];
+                 },
+                 nullptr);
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::from_unionarray(const Index8& tags,
+                                        const Index64& index,
+                                        int64_t which,
+                                        int64_t tolength) const {
+    std::shared_ptr<int64_t> parents = scratch_array<int64_t>(tolength);
+    int64_t* rawparents = parents.get();
+    for (int64_t j = 0;  j < tolength;  j++) {
+      rawparents[j] = -1;
+    }
+    for (int64_t i = 0;  i < length_;  i++) {
+      if (tags.getitem_at_nowrap(i) == which) {
+        int64_t j = index.getitem_at_nowrap(i);
+        if (j >= tolength) {
+          util::handle_error(failure("max(index) > len(content)", i, j),
+                             classname(),
+                             nullptr);
+        }
+        else if (j < 0) {
+          util::handle_error(failure("min(index) < 0", i, j),
+                             classname(),
+                             nullptr);
+        }
+        else {
+          if (rawparents[j] != -1) {
+            return Identities::none();
+          }
+          rawparents[j] = i;
+        }
+      }
+    }
+    return child(width_,
+                 tolength,
+                 [rawparents](int64_t j) -> int64_t {
+                   return rawparents[j];
+                 },
+                 nullptr);
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::extend(int64_t tolength) const {
+    int64_t length = length_;
+    return child(width_,
+                 tolength,
+                 [length](int64_t j) -> int64_t {
+                   return j < length ? j : -1;
+                 },
+                 nullptr);
+  }
+
+  const IdentitiesPtr
+  CompressedIdentities::child(
+    int64_t width,
+    int64_t tolength,
+    const std::function<int64_t(int64_t)>& parent,
+    const std::function<int64_t(int64_t)>& local) const {
+    std::vector<IdentitiesColumn> columns;
+    for (int64_t col = 0;  col < width_;  col++) {
+      // Consecutive rows usually share a parent: look each one up once.
+      int64_t lastparent = -1;
+      int64_t lastvalue = -1;
+      columns.push_back(IdentitiesColumn::encode(
+        tolength,
+        [this, col, &parent, &lastparent, &lastvalue](int64_t j) -> int64_t {
+          int64_t i = parent(j);
+          if (i < 0) {
+            return -1;
+          }
+          if (i != lastparent) {
+            lastparent = i;
+            lastvalue = value(i, col);
+          }
+          return lastvalue;
+        }));
+    }
+    if (width > width_) {
+      columns.push_back(IdentitiesColumn::encode(
+        tolength,
+        [&parent, &local](int64_t j) -> int64_t {
+          return parent(j) < 0 ? -1 : local(j);
+        }));
+    }
+    return std::make_shared<CompressedIdentities>(Identities::newref(),
+                                                  fieldloc_,
+                                                  0,
+                                                  width,
+                                                  tolength,
+                                                  columns);
+  }
 }
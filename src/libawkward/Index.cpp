@@ -5,6 +5,7 @@
 #include <sstream>
 #include <type_traits>
 
+#include "awkward/Allocator.h"
 #include "awkward/Slice.h"
 
 #include "awkward/Index.h"
@@ -12,8 +13,8 @@
 namespace awkward {
   template <typename T>
   IndexOf<T>::IndexOf(int64_t length)
-      : ptr_(std::shared_ptr<T>(length == 0 ? nullptr : new T[(size_t)length],
-                                util::array_deleter<T>()))
+      : ptr_(std::shared_ptr<T>(length == 0 ? nullptr
+                                            : allocate_array<T>(length)))
       , offset_(0)
       , length_(length) { }
 
@@ -25,6 +26,15 @@ namespace awkward {
       , offset_(offset)
       , length_(length) { }
 
+  template <typename T>
+  IndexOf<T>
+  IndexOf<T>::scratch(int64_t length) {
+    if (length == 0) {
+      return IndexOf<T>(0);
+    }
+    return IndexOf<T>(scratch_array<T>(length), 0, length);
+  }
+
   template <typename T>
   const std::shared_ptr<T>
   IndexOf<T>::ptr() const {
@@ -175,8 +185,7 @@ namespace awkward {
   template <>
   IndexOf<int64_t> IndexOf<int8_t>::to64() const {
     std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+      length_ == 0 ? nullptr : allocate_array<int64_t>(length_));
     if (length_ != 0) {
       awkward_index8_to_index64(ptr.get(), &ptr_.get()[(size_t)offset_],
                                 length_);
@@ -187,8 +196,7 @@ namespace awkward {
   template <>
   IndexOf<int64_t> IndexOf<uint8_t>::to64() const {
     std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+      length_ == 0 ? nullptr : allocate_array<int64_t>(length_));
     if (length_ != 0) {
       awkward_indexU8_to_index64(ptr.get(), &ptr_.get()[(size_t)offset_],
                                  length_);
@@ -199,8 +207,7 @@ namespace awkward {
   template <>
   IndexOf<int64_t> IndexOf<int32_t>::to64() const {
     std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+      length_ == 0 ? nullptr : allocate_array<int64_t>(length_));
     if (length_ != 0) {
       awkward_index32_to_index64(ptr.get(),
                                  &ptr_.get()[(size_t)offset_],
@@ -212,8 +219,7 @@ namespace awkward {
   template <>
   IndexOf<int64_t> IndexOf<uint32_t>::to64() const {
     std::shared_ptr<int64_t> ptr(
-      length_ == 0 ? nullptr : new int64_t[(size_t)length_],
-      util::array_deleter<int64_t>());
+      length_ == 0 ? nullptr : allocate_array<int64_t>(length_));
     if (length_ != 0) {
       awkward_indexU32_to_index64(ptr.get(),
                                   &ptr_.get()[(size_t)offset_],
@@ -231,8 +237,7 @@ namespace awkward {
   const IndexOf<T>
   IndexOf<T>::deep_copy() const {
     std::shared_ptr<T> ptr(
-      length_ == 0 ? nullptr : new T[(size_t)length_],
-      util::array_deleter<T>());
+      length_ == 0 ? nullptr : allocate_array<T>(length_));
     if (length_ != 0) {
       memcpy(ptr.get(),
              &ptr_.get()[(size_t)offset_],
@@ -2,6 +2,7 @@
 
 #include <limits>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/reducers.h"
 
 #include "awkward/Reducer.h"
@@ -106,8 +107,7 @@ namespace awkward {
                            const Index64& parents,
                            int64_t outlength) const {
     // This is the only reducer that completely ignores the data.
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_count_64(
       ptr.get(),
       parents.ptr().get(),
@@ -248,6 +248,132 @@ namespace awkward {
                       outlength);
   }
 
+  const std::shared_ptr<void>
+  ReducerCount::apply_bool_segments(const bool* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    // This is the only reducer that completely ignores the data.
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_count_segments_64(
+      ptr.get(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_int8_segments(const int8_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_uint8_segments(const uint8_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_int16_segments(const int16_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_uint16_segments(const uint16_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_int32_segments(const int32_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_uint32_segments(const uint32_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_int64_segments(const int64_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_uint64_segments(const uint64_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_float32_segments(const float* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_float64_segments(const double* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    return apply_bool_segments(reinterpret_cast<const bool*>(data),
+                               offset,
+                               offsets,
+                               outlength);
+  }
+
   ////////// count nonzero
 
   const std::string
@@ -285,8 +411,7 @@ namespace awkward {
                                   const Index64& starts,
                                   const Index64& parents,
                                   int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_bool_64(
       ptr.get(),
       data,
@@ -305,8 +430,7 @@ namespace awkward {
                                   const Index64& starts,
                                   const Index64& parents,
                                   int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_int8_64(
       ptr.get(),
       data,
@@ -325,8 +449,7 @@ namespace awkward {
                                    const Index64& starts,
                                    const Index64& parents,
                                    int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_uint8_64(
       ptr.get(),
       data,
@@ -345,8 +468,7 @@ namespace awkward {
                                    const Index64& starts,
                                    const Index64& parents,
                                    int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_int16_64(
       ptr.get(),
       data,
@@ -365,8 +487,7 @@ namespace awkward {
                                     const Index64& starts,
                                     const Index64& parents,
                                     int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_uint16_64(
       ptr.get(),
       data,
@@ -385,8 +506,7 @@ namespace awkward {
                                    const Index64& starts,
                                    const Index64& parents,
                                    int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_int32_64(
       ptr.get(),
       data,
@@ -405,8 +525,7 @@ namespace awkward {
                                     const Index64& starts,
                                     const Index64& parents,
                                     int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_uint32_64(
       ptr.get(),
       data,
@@ -425,8 +544,7 @@ namespace awkward {
                                    const Index64& starts,
                                    const Index64& parents,
                                    int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_int64_64(
       ptr.get(),
       data,
@@ -445,8 +563,7 @@ namespace awkward {
                                     const Index64& starts,
                                     const Index64& parents,
                                     int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_uint64_64(
       ptr.get(),
       data,
@@ -465,8 +582,7 @@ namespace awkward {
                                      const Index64& starts,
                                      const Index64& parents,
                                      int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_float32_64(
       ptr.get(),
       data,
@@ -485,8 +601,7 @@ namespace awkward {
                                      const Index64& starts,
                                      const Index64& parents,
                                      int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_countnonzero_float64_64(
       ptr.get(),
       data,
@@ -499,6 +614,193 @@ namespace awkward {
     return ptr;
   }
 
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_bool_segments(const bool* data,
+                                           int64_t offset,
+                                           const Index64& offsets,
+                                           int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_int8_segments(const int8_t* data,
+                                           int64_t offset,
+                                           const Index64& offsets,
+                                           int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_uint8_segments(const uint8_t* data,
+                                            int64_t offset,
+                                            const Index64& offsets,
+                                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_int16_segments(const int16_t* data,
+                                            int64_t offset,
+                                            const Index64& offsets,
+                                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_uint16_segments(const uint16_t* data,
+                                             int64_t offset,
+                                             const Index64& offsets,
+                                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_int32_segments(const int32_t* data,
+                                            int64_t offset,
+                                            const Index64& offsets,
+                                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_uint32_segments(const uint32_t* data,
+                                             int64_t offset,
+                                             const Index64& offsets,
+                                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_int64_segments(const int64_t* data,
+                                            int64_t offset,
+                                            const Index64& offsets,
+                                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_int64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_uint64_segments(const uint64_t* data,
+                                             int64_t offset,
+                                             const Index64& offsets,
+                                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_uint64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_float32_segments(const float* data,
+                                              int64_t offset,
+                                              const Index64& offsets,
+                                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_float32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_float64_segments(const double* data,
+                                              int64_t offset,
+                                              const Index64& offsets,
+                                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_countnonzero_float64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
   ////////// sum (addition)
 
   const std::string
@@ -595,8 +897,7 @@ namespace awkward {
                          const Index64& parents,
                          int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_sum_int32_bool_64(
       ptr.get(),
       data,
@@ -606,8 +907,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_sum_int64_bool_64(
       ptr.get(),
       data,
@@ -628,8 +928,7 @@ namespace awkward {
                          const Index64& parents,
                          int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_sum_int32_int8_64(
       ptr.get(),
       data,
@@ -639,8 +938,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_sum_int64_int8_64(
       ptr.get(),
       data,
@@ -661,8 +959,7 @@ namespace awkward {
                           const Index64& parents,
                           int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
     struct Error err = awkward_reduce_sum_uint32_uint8_64(
       ptr.get(),
       data,
@@ -672,8 +969,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_sum_uint64_uint8_64(
       ptr.get(),
       data,
@@ -694,8 +990,7 @@ namespace awkward {
                           const Index64& parents,
                           int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_sum_int32_int16_64(
       ptr.get(),
       data,
@@ -705,8 +1000,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_sum_int64_int16_64(
       ptr.get(),
       data,
@@ -727,8 +1021,7 @@ namespace awkward {
                            const Index64& parents,
                            int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
     struct Error err = awkward_reduce_sum_uint32_uint16_64(
       ptr.get(),
       data,
@@ -738,8 +1031,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_sum_uint64_uint16_64(
       ptr.get(),
       data,
@@ -760,8 +1052,7 @@ namespace awkward {
                           const Index64& parents,
                           int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_sum_int32_int32_64(
       ptr.get(),
       data,
@@ -771,8 +1062,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_sum_int64_int32_64(
       ptr.get(),
       data,
@@ -793,8 +1083,7 @@ namespace awkward {
                            const Index64& parents,
                            int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
     struct Error err = awkward_reduce_sum_uint32_uint32_64(
       ptr.get(),
       data,
@@ -804,8 +1093,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_sum_uint64_uint32_64(
       ptr.get(),
       data,
@@ -825,8 +1113,7 @@ namespace awkward {
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_sum_int64_int64_64(
       ptr.get(),
       data,
@@ -845,8 +1132,7 @@ namespace awkward {
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_sum_uint64_uint64_64(
       ptr.get(),
       data,
@@ -865,8 +1151,7 @@ namespace awkward {
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<float> ptr(new float[(size_t)outlength],
-                               util::array_deleter<float>());
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
     struct Error err = awkward_reduce_sum_float32_float32_64(
       ptr.get(),
       data,
@@ -885,8 +1170,7 @@ namespace awkward {
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<double> ptr(new double[(size_t)outlength],
-                                util::array_deleter<double>());
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
     struct Error err = awkward_reduce_sum_float64_float64_64(
       ptr.get(),
       data,
@@ -899,70 +1183,334 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// prod (multiplication)
-
-  const std::string
-  ReducerProd::name() const {
-    return "prod";
-  }
-
-  const std::string
-  ReducerProd::preferred_type() const {
+  const std::shared_ptr<void>
+  ReducerSum::apply_bool_segments(const bool* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    return "q";
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_sum_int32_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
 #else
-    return "l";
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_sum_int64_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
 #endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
   }
 
-  ssize_t
-  ReducerProd::preferred_typesize() const {
-    return 8;
+  const std::shared_ptr<void>
+  ReducerSum::apply_int8_segments(const int8_t* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_sum_int32_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_sum_int64_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
   }
 
-  const std::string
-  ReducerProd::return_type(const std::string& given_type) const {
+  const std::shared_ptr<void>
+  ReducerSum::apply_uint8_segments(const uint8_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    // if the array is 64-bit, even Windows and 32-bit platforms return 64-bit
-    if (given_type.compare("q") == 0) {
-      return "q";
-    }
-    if (given_type.compare("Q") == 0) {
-      return "Q";
-    }
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_sum_uint32_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_sum_uint64_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
 #endif
-    if (given_type.compare("?") == 0  ||
-        given_type.compare("b") == 0  ||
-        given_type.compare("h") == 0  ||
-        given_type.compare("i") == 0  ||
-        given_type.compare("l") == 0  ||
-        given_type.compare("q") == 0) {
-      // for _MSC_VER or __i386__, "l" means 32-bit
-      // for MacOS/Linux 64-bit,   "l" means 64-bit
-      return "l";
-    }
-    else if (
-        given_type.compare("B") == 0  ||
-        given_type.compare("H") == 0  ||
-        given_type.compare("I") == 0  ||
-        given_type.compare("L") == 0  ||
-        given_type.compare("Q") == 0) {
-      // for _MSC_VER or __i386__, "L" means unsigned 32-bit
-      // for MacOS/Linux 64-bit,   "L" means unsigned 64-bit
-      return "L";
-    }
-    else {
-      return given_type;
-    }
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
   }
 
-  ssize_t
-  ReducerProd::return_typesize(const std::string& given_type) const {
+  const std::shared_ptr<void>
+  ReducerSum::apply_int16_segments(const int16_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    if (given_type.compare("q") == 0  ||
-        given_type.compare("Q") == 0) {
-      return 8;
-    }
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_sum_int32_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_sum_int64_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_uint16_segments(const uint16_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_sum_uint32_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_sum_uint64_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_int32_segments(const int32_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_sum_int32_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_sum_int64_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_uint32_segments(const uint32_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_sum_uint32_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_sum_uint64_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_int64_segments(const int64_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_sum_int64_int64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_uint64_segments(const uint64_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_sum_uint64_uint64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_float32_segments(const float* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
+    struct Error err = awkward_reduce_sum_float32_float32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_float64_segments(const double* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
+    struct Error err = awkward_reduce_sum_float64_float64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// prod (multiplication)
+
+  const std::string
+  ReducerProd::name() const {
+    return "prod";
+  }
+
+  const std::string
+  ReducerProd::preferred_type() const {
+#if defined _MSC_VER || defined __i386__
+    return "q";
+#else
+    return "l";
+#endif
+  }
+
+  ssize_t
+  ReducerProd::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::string
+  ReducerProd::return_type(const std::string& given_type) const {
+#if defined _MSC_VER || defined __i386__
+    // if the array is 64-bit, even Windows and 32-bit platforms return 64-bit
+    if (given_type.compare("q") == 0) {
+      return "q";
+    }
+    if (given_type.compare("Q") == 0) {
+      return "Q";
+    }
+#endif
+    if (given_type.compare("?") == 0  ||
+        given_type.compare("b") == 0  ||
+        given_type.compare("h") == 0  ||
+        given_type.compare("i") == 0  ||
+        given_type.compare("l") == 0  ||
+        given_type.compare("q") == 0) {
+      // for _MSC_VER or __i386__, "l" means 32-bit
+      // for MacOS/Linux 64-bit,   "l" means 64-bit
+      return "l";
+    }
+    else if (
+        given_type.compare("B") == 0  ||
+        given_type.compare("H") == 0  ||
+        given_type.compare("I") == 0  ||
+        given_type.compare("L") == 0  ||
+        given_type.compare("Q") == 0) {
+      // for _MSC_VER or __i386__, "L" means unsigned 32-bit
+      // for MacOS/Linux 64-bit,   "L" means unsigned 64-bit
+      return "L";
+    }
+    else {
+      return given_type;
+    }
+  }
+
+  ssize_t
+  ReducerProd::return_typesize(const std::string& given_type) const {
+#if defined _MSC_VER || defined __i386__
+    if (given_type.compare("q") == 0  ||
+        given_type.compare("Q") == 0) {
+      return 8;
+    }
 #endif
     if (given_type.compare("?") == 0  ||
         given_type.compare("b") == 0  ||
@@ -999,8 +1547,7 @@ namespace awkward {
                           const Index64& parents,
                           int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_prod_int32_bool_64(
       ptr.get(),
       data,
@@ -1010,8 +1557,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_prod_int64_bool_64(
       ptr.get(),
       data,
@@ -1032,8 +1578,7 @@ namespace awkward {
                           const Index64& parents,
                           int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_prod_int32_int8_64(
       ptr.get(),
       data,
@@ -1043,8 +1588,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_prod_int64_int8_64(
       ptr.get(),
       data,
@@ -1065,8 +1609,7 @@ namespace awkward {
                            const Index64& parents,
                            int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
     struct Error err = awkward_reduce_prod_uint32_uint8_64(
       ptr.get(),
       data,
@@ -1076,8 +1619,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_prod_uint64_uint8_64(
       ptr.get(),
       data,
@@ -1098,8 +1640,7 @@ namespace awkward {
                            const Index64& parents,
                            int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_prod_int32_int16_64(
       ptr.get(),
       data,
@@ -1109,8 +1650,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_prod_int64_int16_64(
       ptr.get(),
       data,
@@ -1131,8 +1671,7 @@ namespace awkward {
                             const Index64& parents,
                             int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
     struct Error err = awkward_reduce_prod_uint32_uint16_64(
       ptr.get(),
       data,
@@ -1142,8 +1681,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_prod_uint64_uint16_64(
       ptr.get(),
       data,
@@ -1164,8 +1702,7 @@ namespace awkward {
                            const Index64& parents,
                            int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_prod_int32_int32_64(
       ptr.get(),
       data,
@@ -1175,8 +1712,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_prod_int64_int32_64(
       ptr.get(),
       data,
@@ -1197,8 +1733,7 @@ namespace awkward {
                             const Index64& parents,
                             int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
     struct Error err = awkward_reduce_prod_uint32_uint32_64(
       ptr.get(),
       data,
@@ -1208,8 +1743,7 @@ namespace awkward {
       parents.length(),
       outlength);
 #else
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_prod_uint64_uint32_64(
       ptr.get(),
       data,
@@ -1229,8 +1763,7 @@ namespace awkward {
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_prod_int64_int64_64(
       ptr.get(),
       data,
@@ -1249,8 +1782,7 @@ namespace awkward {
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
     struct Error err = awkward_reduce_prod_uint64_uint64_64(
       ptr.get(),
       data,
@@ -1269,8 +1801,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<float> ptr(new float[(size_t)outlength],
-                               util::array_deleter<float>());
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
     struct Error err = awkward_reduce_prod_float32_float32_64(
       ptr.get(),
       data,
@@ -1289,8 +1820,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<double> ptr(new double[(size_t)outlength],
-                                util::array_deleter<double>());
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
     struct Error err = awkward_reduce_prod_float64_float64_64(
       ptr.get(),
       data,
@@ -1303,289 +1833,305 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// any (logical or)
-
-  const std::string
-  ReducerAny::name() const {
-    return "any";
-  }
-
-  const std::string
-  ReducerAny::preferred_type() const {
-    return "?";
-  }
-
-  ssize_t
-  ReducerAny::preferred_typesize() const {
-    return 1;
-  }
-
-  const std::string
-  ReducerAny::return_type(const std::string& given_type) const {
-    return "?";
-  }
-
-  ssize_t
-  ReducerAny::return_typesize(const std::string& given_type) const {
-    return 1;
-  }
-
   const std::shared_ptr<void>
-  ReducerAny::apply_bool(const bool* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_bool_64(
+  ReducerProd::apply_bool_segments(const bool* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_prod_int32_bool_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_prod_int64_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int8(const int8_t* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int8_64(
+  ReducerProd::apply_int8_segments(const int8_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_prod_int32_int8_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
+#else
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_prod_int64_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint8(const uint8_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint8_64(
+  ReducerProd::apply_uint8_segments(const uint8_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_prod_uint32_uint8_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_prod_uint64_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int16(const int16_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int16_64(
-      ptr.get(),
-      data,
+  ReducerProd::apply_int16_segments(const int16_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_prod_int32_int16_segments_64(
+      ptr.get(),
+      data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
+#else
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_prod_int64_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint16(const uint16_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint16_64(
+  ReducerProd::apply_uint16_segments(const uint16_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_prod_uint32_uint16_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_prod_uint64_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int32(const int32_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int32_64(
+  ReducerProd::apply_int32_segments(const int32_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_prod_int32_int32_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_prod_int64_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint32(const uint32_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint32_64(
+  ReducerProd::apply_uint32_segments(const uint32_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_prod_uint32_uint32_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_prod_uint64_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int64(const int64_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int64_64(
+  ReducerProd::apply_int64_segments(const int64_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_prod_int64_int64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint64(const uint64_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint64_64(
+  ReducerProd::apply_uint64_segments(const uint64_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_prod_uint64_uint64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_float32(const float* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_float32_64(
+  ReducerProd::apply_float32_segments(const float* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
+    struct Error err = awkward_reduce_prod_float32_float32_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_float64(const double* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_float64_64(
+  ReducerProd::apply_float64_segments(const double* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
+    struct Error err = awkward_reduce_prod_float64_float64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
-  ////////// all (logical and)
+  ////////// any (logical or)
 
   const std::string
-  ReducerAll::name() const {
-    return "all";
+  ReducerAny::name() const {
+    return "any";
   }
 
   const std::string
-  ReducerAll::preferred_type() const {
+  ReducerAny::preferred_type() const {
     return "?";
   }
 
   ssize_t
-  ReducerAll::preferred_typesize() const {
+  ReducerAny::preferred_typesize() const {
     return 1;
   }
 
   const std::string
-  ReducerAll::return_type(const std::string& given_type) const {
+  ReducerAny::return_type(const std::string& given_type) const {
     return "?";
   }
 
   ssize_t
-  ReducerAll::return_typesize(const std::string& given_type) const {
+  ReducerAny::return_typesize(const std::string& given_type) const {
     return 1;
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_bool(const bool* data,
+  ReducerAny::apply_bool(const bool* data,
                          int64_t offset,
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_bool_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_bool_64(
       ptr.get(),
       data,
       offset,
@@ -1598,14 +2144,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int8(const int8_t* data,
+  ReducerAny::apply_int8(const int8_t* data,
                          int64_t offset,
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int8_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int8_64(
       ptr.get(),
       data,
       offset,
@@ -1618,14 +2163,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint8(const uint8_t* data,
+  ReducerAny::apply_uint8(const uint8_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint8_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint8_64(
       ptr.get(),
       data,
       offset,
@@ -1638,14 +2182,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int16(const int16_t* data,
+  ReducerAny::apply_int16(const int16_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int16_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int16_64(
       ptr.get(),
       data,
       offset,
@@ -1658,14 +2201,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint16(const uint16_t* data,
+  ReducerAny::apply_uint16(const uint16_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint16_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint16_64(
       ptr.get(),
       data,
       offset,
@@ -1678,14 +2220,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int32(const int32_t* data,
+  ReducerAny::apply_int32(const int32_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int32_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int32_64(
       ptr.get(),
       data,
       offset,
@@ -1698,14 +2239,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint32(const uint32_t* data,
+  ReducerAny::apply_uint32(const uint32_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint32_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint32_64(
       ptr.get(),
       data,
       offset,
@@ -1718,14 +2258,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int64(const int64_t* data,
+  ReducerAny::apply_int64(const int64_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int64_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int64_64(
       ptr.get(),
       data,
       offset,
@@ -1738,14 +2277,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint64(const uint64_t* data,
+  ReducerAny::apply_uint64(const uint64_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint64_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint64_64(
       ptr.get(),
       data,
       offset,
@@ -1758,14 +2296,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_float32(const float* data,
+  ReducerAny::apply_float32(const float* data,
                             int64_t offset,
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_float32_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_float32_64(
       ptr.get(),
       data,
       offset,
@@ -1778,14 +2315,13 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_float64(const double* data,
+  ReducerAny::apply_float64(const double* data,
                             int64_t offset,
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_float64_64(
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_float64_64(
       ptr.get(),
       data,
       offset,
@@ -1797,142 +2333,953 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// min (minimum, in which infinity is the identity)
-
-  const std::string
-  ReducerMin::name() const {
-    return "min";
-  }
-
-  const std::string
-  ReducerMin::preferred_type() const {
-    return "d";
-  }
-
-  ssize_t
-  ReducerMin::preferred_typesize() const {
-    return 8;
-  }
-
   const std::shared_ptr<void>
-  ReducerMin::apply_bool(const bool* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_bool_64(
+  ReducerAny::apply_bool_segments(const bool* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_bool_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int8(const int8_t* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
-                                util::array_deleter<int8_t>());
-    struct Error err = awkward_reduce_min_int8_int8_64(
+  ReducerAny::apply_int8_segments(const int8_t* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int8_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<int8_t>::max());
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint8(const uint8_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
-                                 util::array_deleter<uint8_t>());
-    struct Error err = awkward_reduce_min_uint8_uint8_64(
+  ReducerAny::apply_uint8_segments(const uint8_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint8_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<uint8_t>::max());
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int16(const int16_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
-                                 util::array_deleter<int16_t>());
-    struct Error err = awkward_reduce_min_int16_int16_64(
+  ReducerAny::apply_int16_segments(const int16_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int16_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<int16_t>::max());
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint16(const uint16_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
-                                  util::array_deleter<uint16_t>());
-    struct Error err = awkward_reduce_min_uint16_uint16_64(
+  ReducerAny::apply_uint16_segments(const uint16_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint16_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<uint16_t>::max());
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int32(const int32_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
-    struct Error err = awkward_reduce_min_int32_int32_64(
+  ReducerAny::apply_int32_segments(const int32_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_uint32_segments(const uint32_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_int64_segments(const int64_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_int64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_uint64_segments(const uint64_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_uint64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_float32_segments(const float* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_float32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_float64_segments(const double* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_float64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// all (logical and)
+
+  const std::string
+  ReducerAll::name() const {
+    return "all";
+  }
+
+  const std::string
+  ReducerAll::preferred_type() const {
+    return "?";
+  }
+
+  ssize_t
+  ReducerAll::preferred_typesize() const {
+    return 1;
+  }
+
+  const std::string
+  ReducerAll::return_type(const std::string& given_type) const {
+    return "?";
+  }
+
+  ssize_t
+  ReducerAll::return_typesize(const std::string& given_type) const {
+    return 1;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_bool(const bool* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_bool_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int8(const int8_t* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int8_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint8_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int16(const int16_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int16_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint16_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int32(const int32_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int64(const int64_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_float32(const float* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_float32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_float64(const double* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_float64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_bool_segments(const bool* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int8_segments(const int8_t* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint8_segments(const uint8_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int16_segments(const int16_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint16_segments(const uint16_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int32_segments(const int32_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint32_segments(const uint32_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_int64_segments(const int64_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_int64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_uint64_segments(const uint64_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_uint64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_float32_segments(const float* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_float32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAll::apply_float64_segments(const double* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_float64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// min (minimum, in which infinity is the identity)
+
+  const std::string
+  ReducerMin::name() const {
+    return "min";
+  }
+
+  const std::string
+  ReducerMin::preferred_type() const {
+    return "d";
+  }
+
+  ssize_t
+  ReducerMin::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_bool(const bool* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_bool_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int8(const int8_t* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<int8_t> ptr(allocate_array<int8_t>(outlength));
+    struct Error err = awkward_reduce_min_int8_int8_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int8_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<uint8_t> ptr(allocate_array<uint8_t>(outlength));
+    struct Error err = awkward_reduce_min_uint8_uint8_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint8_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int16(const int16_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int16_t> ptr(allocate_array<int16_t>(outlength));
+    struct Error err = awkward_reduce_min_int16_int16_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int16_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint16_t> ptr(allocate_array<uint16_t>(outlength));
+    struct Error err = awkward_reduce_min_uint16_uint16_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint16_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int32(const int32_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_min_int32_int32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int32_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_min_uint32_uint32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint32_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int64(const int64_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_min_int64_int64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int64_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_min_uint64_uint64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint64_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_float32(const float* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
+    struct Error err = awkward_reduce_min_float32_float32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<float>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_float64(const double* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
+    struct Error err = awkward_reduce_min_float64_float64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<double>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_bool_segments(const bool* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_prod_bool_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int8_segments(const int8_t* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<int8_t> ptr(allocate_array<int8_t>(outlength));
+    struct Error err = awkward_reduce_min_int8_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<int8_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint8_segments(const uint8_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint8_t> ptr(allocate_array<uint8_t>(outlength));
+    struct Error err = awkward_reduce_min_uint8_uint8_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<uint8_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int16_segments(const int16_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<int16_t> ptr(allocate_array<int16_t>(outlength));
+    struct Error err = awkward_reduce_min_int16_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<int16_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint16_segments(const uint16_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint16_t> ptr(allocate_array<uint16_t>(outlength));
+    struct Error err = awkward_reduce_min_uint16_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<uint16_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int32_segments(const int32_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_min_int32_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<int32_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -1940,20 +3287,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint32(const uint32_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
-    struct Error err = awkward_reduce_min_uint32_uint32_64(
+  ReducerMin::apply_uint32_segments(const uint32_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_min_uint32_uint32_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<uint32_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -1961,20 +3305,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int64(const int64_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_min_int64_int64_64(
+  ReducerMin::apply_int64_segments(const int64_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_min_int64_int64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<int64_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -1982,20 +3323,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint64(const uint64_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
-    struct Error err = awkward_reduce_min_uint64_uint64_64(
+  ReducerMin::apply_uint64_segments(const uint64_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_min_uint64_uint64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<uint64_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2003,20 +3341,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_float32(const float* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<float> ptr(new float[(size_t)outlength],
-                               util::array_deleter<float>());
-    struct Error err = awkward_reduce_min_float32_float32_64(
+  ReducerMin::apply_float32_segments(const float* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
+    struct Error err = awkward_reduce_min_float32_float32_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<float>::infinity());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2024,20 +3359,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_float64(const double* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<double> ptr(new double[(size_t)outlength],
-                                util::array_deleter<double>());
-    struct Error err = awkward_reduce_min_float64_float64_64(
+  ReducerMin::apply_float64_segments(const double* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
+    struct Error err = awkward_reduce_min_float64_float64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<double>::infinity());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2067,8 +3399,7 @@ namespace awkward {
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
     struct Error err = awkward_reduce_sum_bool_bool_64(
       ptr.get(),
       data,
@@ -2087,8 +3418,7 @@ namespace awkward {
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
-    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
-                                util::array_deleter<int8_t>());
+    std::shared_ptr<int8_t> ptr(allocate_array<int8_t>(outlength));
     struct Error err = awkward_reduce_max_int8_int8_64(
       ptr.get(),
       data,
@@ -2108,8 +3438,7 @@ namespace awkward {
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
-                                 util::array_deleter<uint8_t>());
+    std::shared_ptr<uint8_t> ptr(allocate_array<uint8_t>(outlength));
     struct Error err = awkward_reduce_max_uint8_uint8_64(
       ptr.get(),
       data,
@@ -2129,8 +3458,7 @@ namespace awkward {
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
-                                 util::array_deleter<int16_t>());
+    std::shared_ptr<int16_t> ptr(allocate_array<int16_t>(outlength));
     struct Error err = awkward_reduce_max_int16_int16_64(
       ptr.get(),
       data,
@@ -2150,8 +3478,7 @@ namespace awkward {
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
-                                  util::array_deleter<uint16_t>());
+    std::shared_ptr<uint16_t> ptr(allocate_array<uint16_t>(outlength));
     struct Error err = awkward_reduce_max_uint16_uint16_64(
       ptr.get(),
       data,
@@ -2171,8 +3498,7 @@ namespace awkward {
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
     struct Error err = awkward_reduce_max_int32_int32_64(
       ptr.get(),
       data,
@@ -2192,15 +3518,219 @@ namespace awkward {
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
     struct Error err = awkward_reduce_max_uint32_uint32_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint32_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_int64(const int64_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_max_int64_int64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int64_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_max_uint64_uint64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint64_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_float32(const float* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
+    struct Error err = awkward_reduce_max_float32_float32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      -std::numeric_limits<float>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_float64(const double* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
+    struct Error err = awkward_reduce_max_float64_float64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      -std::numeric_limits<double>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_bool_segments(const bool* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(allocate_array<bool>(outlength));
+    struct Error err = awkward_reduce_sum_bool_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_int8_segments(const int8_t* data,
+                                  int64_t offset,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    std::shared_ptr<int8_t> ptr(allocate_array<int8_t>(outlength));
+    struct Error err = awkward_reduce_max_int8_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<int8_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint8_segments(const uint8_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint8_t> ptr(allocate_array<uint8_t>(outlength));
+    struct Error err = awkward_reduce_max_uint8_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<uint8_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_int16_segments(const int16_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<int16_t> ptr(allocate_array<int16_t>(outlength));
+    struct Error err = awkward_reduce_max_int16_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<int16_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint16_segments(const uint16_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint16_t> ptr(allocate_array<uint16_t>(outlength));
+    struct Error err = awkward_reduce_max_uint16_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<uint16_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_int32_segments(const int32_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<int32_t> ptr(allocate_array<int32_t>(outlength));
+    struct Error err = awkward_reduce_max_int32_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength,
+      std::numeric_limits<int32_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint32_segments(const uint32_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint32_t> ptr(allocate_array<uint32_t>(outlength));
+    struct Error err = awkward_reduce_max_uint32_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<uint32_t>::min());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2208,20 +3738,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int64(const int64_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_max_int64_int64_64(
+  ReducerMax::apply_int64_segments(const int64_t* data,
+                                   int64_t offset,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_max_int64_int64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<int64_t>::min());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2229,20 +3756,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint64(const uint64_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
-    struct Error err = awkward_reduce_max_uint64_uint64_64(
+  ReducerMax::apply_uint64_segments(const uint64_t* data,
+                                    int64_t offset,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(allocate_array<uint64_t>(outlength));
+    struct Error err = awkward_reduce_max_uint64_uint64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       std::numeric_limits<uint64_t>::min());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2250,20 +3774,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_float32(const float* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<float> ptr(new float[(size_t)outlength],
-                               util::array_deleter<float>());
-    struct Error err = awkward_reduce_max_float32_float32_64(
+  ReducerMax::apply_float32_segments(const float* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<float> ptr(allocate_array<float>(outlength));
+    struct Error err = awkward_reduce_max_float32_float32_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       -std::numeric_limits<float>::infinity());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2271,20 +3792,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_float64(const double* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<double> ptr(new double[(size_t)outlength],
-                                util::array_deleter<double>());
-    struct Error err = awkward_reduce_max_float64_float64_64(
+  ReducerMax::apply_float64_segments(const double* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<double> ptr(allocate_array<double>(outlength));
+    struct Error err = awkward_reduce_max_float64_float64_segments_64(
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
+      offsets.ptr().get(),
+      offsets.offset(),
       outlength,
       -std::numeric_limits<double>::infinity());
     util::handle_error(err, util::quote(name(), true), nullptr);
@@ -2332,8 +3850,7 @@ namespace awkward {
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_bool_64(
       ptr.get(),
       data,
@@ -2354,8 +3871,7 @@ namespace awkward {
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_int8_64(
       ptr.get(),
       data,
@@ -2376,8 +3892,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_uint8_64(
       ptr.get(),
       data,
@@ -2398,8 +3913,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_int16_64(
       ptr.get(),
       data,
@@ -2420,8 +3934,7 @@ namespace awkward {
                               const Index64& starts,
                               const Index64& parents,
                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_uint16_64(
       ptr.get(),
       data,
@@ -2442,8 +3955,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_int32_64(
       ptr.get(),
       data,
@@ -2464,8 +3976,7 @@ namespace awkward {
                               const Index64& starts,
                               const Index64& parents,
                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_uint32_64(
       ptr.get(),
       data,
@@ -2486,8 +3997,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_int64_64(
       ptr.get(),
       data,
@@ -2508,8 +4018,7 @@ namespace awkward {
                               const Index64& starts,
                               const Index64& parents,
                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_uint64_64(
       ptr.get(),
       data,
@@ -2530,8 +4039,7 @@ namespace awkward {
                                const Index64& starts,
                                const Index64& parents,
                                int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_float32_64(
       ptr.get(),
       data,
@@ -2552,8 +4060,7 @@ namespace awkward {
                                const Index64& starts,
                                const Index64& parents,
                                int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmin_float64_64(
       ptr.get(),
       data,
@@ -2568,6 +4075,193 @@ namespace awkward {
     return ptr;
   }
 
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_bool_segments(const bool* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int8_segments(const int8_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint8_segments(const uint8_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int16_segments(const int16_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint16_segments(const uint16_t* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int32_segments(const int32_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint32_segments(const uint32_t* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int64_segments(const int64_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_int64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint64_segments(const uint64_t* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_uint64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_float32_segments(const float* data,
+                                        int64_t offset,
+                                        const Index64& offsets,
+                                        int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_float32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_float64_segments(const double* data,
+                                        int64_t offset,
+                                        const Index64& offsets,
+                                        int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmin_float64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
   ////////// argmax (argument maximum, in which -1 is the identity)
 
   const std::string
@@ -2609,8 +4303,7 @@ namespace awkward {
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_bool_64(
       ptr.get(),
       data,
@@ -2631,8 +4324,7 @@ namespace awkward {
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_int8_64(
       ptr.get(),
       data,
@@ -2653,8 +4345,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_uint8_64(
       ptr.get(),
       data,
@@ -2675,8 +4366,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_int16_64(
       ptr.get(),
       data,
@@ -2697,8 +4387,7 @@ namespace awkward {
                               const Index64& starts,
                               const Index64& parents,
                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_uint16_64(
       ptr.get(),
       data,
@@ -2719,8 +4408,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_int32_64(
       ptr.get(),
       data,
@@ -2741,8 +4429,7 @@ namespace awkward {
                               const Index64& starts,
                               const Index64& parents,
                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_uint32_64(
       ptr.get(),
       data,
@@ -2763,8 +4450,7 @@ namespace awkward {
                              const Index64& starts,
                              const Index64& parents,
                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_int64_64(
       ptr.get(),
       data,
@@ -2785,8 +4471,7 @@ namespace awkward {
                               const Index64& starts,
                               const Index64& parents,
                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_uint64_64(
       ptr.get(),
       data,
@@ -2807,8 +4492,7 @@ namespace awkward {
                                const Index64& starts,
                                const Index64& parents,
                                int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_float32_64(
       ptr.get(),
       data,
@@ -2829,9 +4513,7 @@ namespace awkward {
                                const Index64& starts,
                                const Index64& parents,
                                int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                
-                                 util::array_deleter<int64_t>());
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
     struct Error err = awkward_reduce_argmax_float64_64(
       ptr.get(),
       data,
@@ -2846,4 +4528,191 @@ namespace awkward {
     return ptr;
   }
 
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_bool_segments(const bool* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_bool_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int8_segments(const int8_t* data,
+                                     int64_t offset,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_int8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint8_segments(const uint8_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_uint8_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int16_segments(const int16_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_int16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint16_segments(const uint16_t* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_uint16_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int32_segments(const int32_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_int32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint32_segments(const uint32_t* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_uint32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int64_segments(const int64_t* data,
+                                      int64_t offset,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_int64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint64_segments(const uint64_t* data,
+                                       int64_t offset,
+                                       const Index64& offsets,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_uint64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_float32_segments(const float* data,
+                                        int64_t offset,
+                                        const Index64& offsets,
+                                        int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_float32_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_float64_segments(const double* data,
+                                        int64_t offset,
+                                        const Index64& offsets,
+                                        int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(outlength));
+    struct Error err = awkward_reduce_argmax_float64_segments_64(
+      ptr.get(),
+      data,
+      offset,
+      offsets.ptr().get(),
+      offsets.offset(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
 }
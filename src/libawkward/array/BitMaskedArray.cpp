@@ -153,7 +153,7 @@ namespace awkward {
   void
   BitMaskedArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      content_.get()->setidentities(identities);
+      content_ = content_.get()->withidentities(identities);
     }
     else {
       if (length() != identities.get()->length()) {
@@ -164,8 +164,13 @@ namespace awkward {
           classname(),
           identities_.get());
       }
-      if (Identities32* rawidentities =
-          dynamic_cast<Identities32*>(identities.get())) {
+      if (EncodedIdentities* rawidentities =
+          dynamic_cast<EncodedIdentities*>(identities.get())) {
+        content_ = content_.get()->withidentities(
+          rawidentities->extend(content_.get()->length()));
+      }
+      else if (Identities32* rawidentities =
+               dynamic_cast<Identities32*>(identities.get())) {
         std::shared_ptr<Identities32> subidentities =
           std::make_shared<Identities32>(Identities::newref(),
                                          rawidentities->fieldloc(),
@@ -180,7 +185,7 @@ namespace awkward {
           rawidentities->length(),
           content_.get()->length());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else if (Identities64* rawidentities =
                dynamic_cast<Identities64*>(identities.get())) {
@@ -198,7 +203,7 @@ namespace awkward {
           rawidentities->length(),
           content_.get()->length());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else {
         throw std::runtime_error("unrecognized Identities specialization");
@@ -238,7 +243,7 @@ namespace awkward {
   }
 
   const TypePtr
-  BitMaskedArray::type(const util::TypeStrs& typestrs) const {
+  BitMaskedArray::type_part(const util::TypeStrs& typestrs) const {
     return std::make_shared<OptionType>(
       parameters_,
       util::gettypestr(parameters_, typestrs),
@@ -66,7 +66,7 @@ namespace awkward {
       validwhen_);
     util::handle_error(err1, classname(), identities_.get());
 
-    Index64 nextcarry(length() - numnull);
+    Index64 nextcarry = Index64::scratch(length() - numnull);
     struct Error err2 = awkward_bytemaskedarray_getitem_nextcarry_64(
       nextcarry.ptr().get(),
       mask_.ptr().get(),
@@ -166,7 +166,7 @@ namespace awkward {
   void
   ByteMaskedArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      content_.get()->setidentities(identities);
+      content_ = content_.get()->withidentities(identities);
     }
     else {
       if (length() != identities.get()->length()) {
@@ -177,8 +177,13 @@ namespace awkward {
           classname(),
           identities_.get());
       }
-      if (Identities32* rawidentities =
-          dynamic_cast<Identities32*>(identities.get())) {
+      if (EncodedIdentities* rawidentities =
+          dynamic_cast<EncodedIdentities*>(identities.get())) {
+        content_ = content_.get()->withidentities(
+          rawidentities->extend(content_.get()->length()));
+      }
+      else if (Identities32* rawidentities =
+               dynamic_cast<Identities32*>(identities.get())) {
         std::shared_ptr<Identities32> subidentities =
           std::make_shared<Identities32>(Identities::newref(),
                                          rawidentities->fieldloc(),
@@ -193,7 +198,7 @@ namespace awkward {
           rawidentities->length(),
           content_.get()->length());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else if (Identities64* rawidentities =
                dynamic_cast<Identities64*>(identities.get())) {
@@ -211,7 +216,7 @@ namespace awkward {
           rawidentities->length(),
           content_.get()->length());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else {
         throw std::runtime_error("unrecognized Identities specialization");
@@ -251,7 +256,7 @@ namespace awkward {
   }
 
   const TypePtr
-  ByteMaskedArray::type(const util::TypeStrs& typestrs) const {
+  ByteMaskedArray::type_part(const util::TypeStrs& typestrs) const {
     return std::make_shared<OptionType>(
              parameters_,
              util::gettypestr(parameters_, typestrs),
@@ -787,8 +792,8 @@ namespace awkward {
       validwhen_);
     util::handle_error(err1, classname(), identities_.get());
 
-    Index64 nextparents(length() - numnull);
-    Index64 nextcarry(length() - numnull);
+    Index64 nextparents = Index64::scratch(length() - numnull);
+    Index64 nextcarry = Index64::scratch(length() - numnull);
     Index64 outindex(length());
     struct Error err2 = awkward_bytemaskedarray_reduce_next_64(
       nextcarry.ptr().get(),
@@ -1007,7 +1012,7 @@ namespace awkward {
       validwhen_);
     util::handle_error(err1, classname(), identities_.get());
 
-    Index64 nextcarry(length() - numnull);
+    Index64 nextcarry = Index64::scratch(length() - numnull);
     Index64 outindex(length());
     struct Error err2 = awkward_bytemaskedarray_getitem_nextcarry_outindex_64(
       nextcarry.ptr().get(),
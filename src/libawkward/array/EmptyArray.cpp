@@ -4,6 +4,7 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/operations.h"
 #include "awkward/type/UnknownType.h"
 #include "awkward/type/ArrayType.h"
@@ -20,7 +21,7 @@ namespace awkward {
 
   const ContentPtr
   EmptyArray::toNumpyArray(const std::string& format, ssize_t itemsize) const {
-    std::shared_ptr<void> ptr(new uint8_t[0], util::array_deleter<uint8_t>());
+    std::shared_ptr<void> ptr(allocate_array<uint8_t>(0));
     std::vector<ssize_t> shape({ 0 });
     std::vector<ssize_t> strides({ itemsize });
     return std::make_shared<NumpyArray>(identities_,
@@ -56,7 +57,7 @@ namespace awkward {
   EmptyArray::setidentities() { }
 
   const TypePtr
-  EmptyArray::type(const util::TypeStrs& typestrs) const {
+  EmptyArray::type_part(const util::TypeStrs& typestrs) const {
     return std::make_shared<UnknownType>(parameters_,
                                          util::gettypestr(parameters_,
                                                           typestrs));
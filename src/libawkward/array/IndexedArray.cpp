@@ -65,7 +65,7 @@ namespace awkward {
         index_.length());
       util::handle_error(err1, classname(), identities_.get());
 
-      Index64 nextcarry(length() - numnull);
+      Index64 nextcarry = Index64::scratch(length() - numnull);
       struct Error err2 = util::awkward_indexedarray_flatten_nextcarry_64<T>(
         nextcarry.ptr().get(),
         index_.ptr().get(),
@@ -77,7 +77,7 @@ namespace awkward {
       return content_.get()->carry(nextcarry);
     }
     else {
-      Index64 nextcarry(length());
+      Index64 nextcarry = Index64::scratch(length());
       struct Error err = util::awkward_indexedarray_getitem_nextcarry_64<T>(
         nextcarry.ptr().get(),
         index_.ptr().get(),
@@ -494,7 +494,7 @@ namespace awkward {
   void
   IndexedArrayOf<T, ISOPTION>::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      content_.get()->setidentities(identities);
+      content_ = content_.get()->withidentities(identities);
     }
     else {
       if (length() != identities.get()->length()) {
@@ -506,12 +506,19 @@ namespace awkward {
           identities_.get());
       }
       IdentitiesPtr bigidentities = identities;
-      if (content_.get()->length() > kMaxInt32  ||
-          !std::is_same<T, int32_t>::value) {
+      if (dynamic_cast<EncodedIdentities*>(identities.get()) == nullptr  &&
+          (content_.get()->length() > kMaxInt32  ||
+           !std::is_same<T, int32_t>::value)) {
         bigidentities = identities.get()->to64();
       }
-      if (Identities32* rawidentities =
-          dynamic_cast<Identities32*>(bigidentities.get())) {
+      if (EncodedIdentities* rawidentities =
+          dynamic_cast<EncodedIdentities*>(bigidentities.get())) {
+        content_ = content_.get()->withidentities(
+          rawidentities->from_indexedarray(index_.to64(),
+                                          content_.get()->length()));
+      }
+      else if (Identities32* rawidentities =
+               dynamic_cast<Identities32*>(bigidentities.get())) {
         bool uniquecontents;
         IdentitiesPtr subidentities =
           std::make_shared<Identities32>(Identities::newref(),
@@ -532,10 +539,10 @@ namespace awkward {
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
         if (uniquecontents) {
-          content_.get()->setidentities(subidentities);
+          content_ = content_.get()->withidentities(subidentities);
         }
         else {
-          content_.get()->setidentities(Identities::none());
+          content_ = content_.get()->withidentities(Identities::none());
         }
       }
       else if (Identities64* rawidentities =
@@ -560,10 +567,10 @@ namespace awkward {
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
         if (uniquecontents) {
-          content_.get()->setidentities(subidentities);
+          content_ = content_.get()->withidentities(subidentities);
         }
         else {
-          content_.get()->setidentities(Identities::none());
+          content_ = content_.get()->withidentities(Identities::none());
         }
       }
       else {
@@ -606,7 +613,7 @@ namespace awkward {
 
   template <typename T, bool ISOPTION>
   const TypePtr
-  IndexedArrayOf<T, ISOPTION>::type(const util::TypeStrs& typestrs) const {
+  IndexedArrayOf<T, ISOPTION>::type_part(const util::TypeStrs& typestrs) const {
     if (ISOPTION) {
       return std::make_shared<OptionType>(
         parameters_,
@@ -614,7 +621,7 @@ namespace awkward {
         content_.get()->type(typestrs));
     }
     else {
-      TypePtr out = content_.get()->type(typestrs);
+      TypePtr out = content_.get()->type(typestrs).get()->shallow_copy();
       out.get()->setparameters(parameters_);
       return out;
     }
@@ -839,7 +846,7 @@ namespace awkward {
         return out2.simplify_optiontype();
       }
       else {
-        Index64 nextcarry(length());
+        Index64 nextcarry = Index64::scratch(length());
         struct Error err = util::awkward_indexedarray_getitem_nextcarry_64<T>(
           nextcarry.ptr().get(),
           index_.ptr().get(),
@@ -877,6 +884,23 @@ namespace awkward {
     }
   }
 
+  namespace {
+    // An inner IndexedArray or IndexedOptionArray can be merged into an outer
+    // one without losing anything if it has no identities or parameters.
+    bool
+    indexedarray_composable(const ContentPtr& content) {
+      if (dynamic_cast<IndexedArray32*>(content.get())  ||
+          dynamic_cast<IndexedArrayU32*>(content.get())  ||
+          dynamic_cast<IndexedArray64*>(content.get())  ||
+          dynamic_cast<IndexedOptionArray32*>(content.get())  ||
+          dynamic_cast<IndexedOptionArray64*>(content.get())) {
+        return (content.get()->identities().get() == nullptr  &&
+                content.get()->parameters().empty());
+      }
+      return false;
+    }
+  }
+
   template <typename T, bool ISOPTION>
   const ContentPtr
   IndexedArrayOf<T, ISOPTION>::carry(const Index64& carry) const {
@@ -893,6 +917,16 @@ namespace awkward {
     if (identities_.get() != nullptr) {
       identities = identities_.get()->getitem_carry_64(carry);
     }
+    if (indexedarray_composable(content_)) {
+      // Compose the carried index with the inner index, so that a chain of
+      // selections becomes one index and the leaf content is gathered only
+      // once, when it is projected.
+      IndexedArrayOf<T, ISOPTION> out(identities,
+                                      parameters_,
+                                      nextindex,
+                                      content_);
+      return out.simplify_optiontype();
+    }
     return std::make_shared<IndexedArrayOf<T, ISOPTION>>(identities,
                                                          parameters_,
                                                          nextindex,
@@ -1134,7 +1168,8 @@ namespace awkward {
       0);
     util::handle_error(err1, classname(), identities_.get());
 
-    int64_t mycontentlength = content_.get()->length();
+    // content is their items followed by mine, so my index shifts by the
+    // number of their items.
     if (std::is_same<T, int32_t>::value) {
       struct Error err2 = awkward_indexedarray_fill_to64_from32(
         index.ptr().get(),
@@ -1142,7 +1177,7 @@ namespace awkward {
         reinterpret_cast<int32_t*>(index_.ptr().get()),
         index_.offset(),
         mylength,
-        mycontentlength);
+        theirlength);
       util::handle_error(err2, classname(), identities_.get());
     }
     else if (std::is_same<T, uint32_t>::value) {
@@ -1152,17 +1187,17 @@ namespace awkward {
         reinterpret_cast<uint32_t*>(index_.ptr().get()),
         index_.offset(),
         mylength,
-        mycontentlength);
+        theirlength);
       util::handle_error(err2, classname(), identities_.get());
     }
-    if (std::is_same<T, int64_t>::value) {
+    else if (std::is_same<T, int64_t>::value) {
       struct Error err2 = awkward_indexedarray_fill_to64_from64(
         index.ptr().get(),
         theirlength,
         reinterpret_cast<int64_t*>(index_.ptr().get()),
         index_.offset(),
         mylength,
-        mycontentlength);
+        theirlength);
       util::handle_error(err2, classname(), identities_.get());
     }
     else {
@@ -1353,7 +1388,7 @@ namespace awkward {
         index_.length());
       util::handle_error(err1, classname(), identities_.get());
 
-      Index64 nextcarry(length() - numnull);
+      Index64 nextcarry = Index64::scratch(length() - numnull);
       Index64 outindex(length());
       struct Error err2 =
         util::awkward_indexedarray_getitem_nextcarry_outindex_mask_64<T>(
@@ -1544,8 +1579,8 @@ namespace awkward {
       index_.length());
     util::handle_error(err1, classname(), identities_.get());
 
-    Index64 nextparents(index_.length() - numnull);
-    Index64 nextcarry(index_.length() - numnull);
+    Index64 nextparents = Index64::scratch(index_.length() - numnull);
+    Index64 nextcarry = Index64::scratch(index_.length() - numnull);
     Index64 outindex(index_.length());
     struct Error err2 = util::awkward_indexedarray_reduce_next_64<T>(
       nextcarry.ptr().get(),
@@ -1788,7 +1823,7 @@ namespace awkward {
       return out2.simplify_optiontype();
     }
     else {
-      Index64 nextcarry(length());
+      Index64 nextcarry = Index64::scratch(length());
       struct Error err = util::awkward_indexedarray_getitem_nextcarry_64<T>(
         nextcarry.ptr().get(),
         index_.ptr().get(),
@@ -1815,7 +1850,7 @@ namespace awkward {
       index_.length());
     util::handle_error(err1, classname(), identities_.get());
 
-    Index64 nextcarry(length() - numnull);
+    Index64 nextcarry = Index64::scratch(length() - numnull);
     IndexOf<T> outindex(length());
     struct Error err2 =
       util::awkward_indexedarray_getitem_nextcarry_outindex_64<T>(
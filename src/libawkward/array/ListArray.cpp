@@ -3,6 +3,7 @@
 #include <sstream>
 #include <type_traits>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
@@ -89,7 +90,7 @@ namespace awkward {
     }
 
     int64_t carrylen = offsets.getitem_at_nowrap(offsets.length() - 1);
-    Index64 nextcarry(carrylen);
+    Index64 nextcarry = Index64::scratch(carrylen);
     struct Error err = util::awkward_listarray_broadcast_tooffsets64<T>(
       nextcarry.ptr().get(),
       offsets.ptr().get(),
@@ -153,7 +154,7 @@ namespace awkward {
   void
   ListArrayOf<T>::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      content_.get()->setidentities(identities);
+      content_ = content_.get()->withidentities(identities);
     }
     else {
       if (length() != identities.get()->length()) {
@@ -165,12 +166,20 @@ namespace awkward {
           identities_.get());
       }
       IdentitiesPtr bigidentities = identities;
-      if (content_.get()->length() > kMaxInt32  ||
-          !std::is_same<T, int32_t>::value) {
+      if (dynamic_cast<EncodedIdentities*>(identities.get()) == nullptr  &&
+          (content_.get()->length() > kMaxInt32  ||
+           !std::is_same<T, int32_t>::value)) {
         bigidentities = identities.get()->to64();
       }
-      if (Identities32* rawidentities =
-          dynamic_cast<Identities32*>(bigidentities.get())) {
+      if (EncodedIdentities* rawidentities =
+          dynamic_cast<EncodedIdentities*>(bigidentities.get())) {
+        content_ = content_.get()->withidentities(
+          rawidentities->from_listarray(starts_.to64(),
+                                       stops_.to64(),
+                                       content_.get()->length()));
+      }
+      else if (Identities32* rawidentities =
+               dynamic_cast<Identities32*>(bigidentities.get())) {
         bool uniquecontents;
         IdentitiesPtr subidentities =
           std::make_shared<Identities32>(Identities::newref(),
@@ -193,10 +202,10 @@ namespace awkward {
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
         if (uniquecontents) {
-          content_.get()->setidentities(subidentities);
+          content_ = content_.get()->withidentities(subidentities);
         }
         else {
-          content_.get()->setidentities(Identities::none());
+          content_ = content_.get()->withidentities(Identities::none());
         }
       }
       else if (Identities64* rawidentities =
@@ -223,10 +232,10 @@ namespace awkward {
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
         if (uniquecontents) {
-          content_.get()->setidentities(subidentities);
+          content_ = content_.get()->withidentities(subidentities);
         }
         else {
-          content_.get()->setidentities(Identities::none());
+          content_ = content_.get()->withidentities(Identities::none());
         }
       }
       else {
@@ -267,7 +276,7 @@ namespace awkward {
 
   template <typename T>
   const TypePtr
-  ListArrayOf<T>::type(const util::TypeStrs& typestrs) const {
+  ListArrayOf<T>::type_part(const util::TypeStrs& typestrs) const {
     return std::make_shared<ListType>(parameters_,
                                       util::gettypestr(parameters_, typestrs),
                                       content_.get()->type(typestrs));
@@ -1112,6 +1121,29 @@ namespace awkward {
                                                         keepdims);
   }
 
+  template <typename T>
+  const ContentPtrVec
+  ListArrayOf<T>::reduce_next_multi(const ContentPtrVec& contents,
+                                    const ReducerPtrVec& reducers,
+                                    int64_t negaxis,
+                                    const Index64& starts,
+                                    const Index64& parents,
+                                    int64_t outlength,
+                                    bool mask,
+                                    bool keepdims) const {
+    ContentPtr next = toListOffsetArray64(true);
+    ContentPtrVec nextcontents(contents);
+    nextcontents[0] = next;
+    return next.get()->reduce_next_multi(nextcontents,
+                                         reducers,
+                                         negaxis,
+                                         starts,
+                                         parents,
+                                         outlength,
+                                         mask,
+                                         keepdims);
+  }
+
   template <typename T>
   const ContentPtr
   ListArrayOf<T>::localindex(int64_t axis, int64_t depth) const {
@@ -1181,8 +1213,7 @@ namespace awkward {
       std::vector<std::shared_ptr<int64_t>> tocarry;
       std::vector<int64_t*> tocarryraw;
       for (int64_t j = 0;  j < n;  j++) {
-        std::shared_ptr<int64_t> ptr(new int64_t[(size_t)totallen],
-                                     util::array_deleter<int64_t>());
+        std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(totallen));
         tocarry.push_back(ptr);
         tocarryraw.push_back(ptr.get());
       }
@@ -1249,7 +1280,7 @@ namespace awkward {
     }
     SliceItemPtr nexthead = tail.head();
     Slice nexttail = tail.tail();
-    Index64 nextcarry(lenstarts);
+    Index64 nextcarry = Index64::scratch(lenstarts);
     struct Error err = util::awkward_listarray_getitem_next_at_64<T>(
       nextcarry.ptr().get(),
       starts_.ptr().get(),
@@ -1299,7 +1330,7 @@ namespace awkward {
     util::handle_error(err1, classname(), identities_.get());
 
     IndexOf<T> nextoffsets(lenstarts + 1);
-    Index64 nextcarry(carrylength);
+    Index64 nextcarry = Index64::scratch(carrylength);
 
     struct Error err2 = util::awkward_listarray_getitem_next_range_64<T>(
       nextoffsets.ptr().get(),
@@ -1330,7 +1361,7 @@ namespace awkward {
         nextoffsets.ptr().get(),
         lenstarts);
       util::handle_error(err1, classname(), identities_.get());
-      Index64 nextadvanced(total);
+      Index64 nextadvanced = Index64::scratch(total);
       struct Error err2 =
         util::awkward_listarray_getitem_next_range_spreadadvanced_64<T>(
         nextadvanced.ptr().get(),
@@ -1363,8 +1394,8 @@ namespace awkward {
     Slice nexttail = tail.tail();
     Index64 flathead = array.ravel();
     if (advanced.length() == 0) {
-      Index64 nextcarry(lenstarts*flathead.length());
-      Index64 nextadvanced(lenstarts*flathead.length());
+      Index64 nextcarry = Index64::scratch(lenstarts*flathead.length());
+      Index64 nextadvanced = Index64::scratch(lenstarts*flathead.length());
       struct Error err = util::awkward_listarray_getitem_next_array_64<T>(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
@@ -1385,8 +1416,8 @@ namespace awkward {
         array.shape());
     }
     else {
-      Index64 nextcarry(lenstarts);
-      Index64 nextadvanced(lenstarts);
+      Index64 nextcarry = Index64::scratch(lenstarts);
+      Index64 nextadvanced = Index64::scratch(lenstarts);
       struct Error err =
         util::awkward_listarray_getitem_next_array_advanced_64<T>(
         nextcarry.ptr().get(),
@@ -1426,7 +1457,7 @@ namespace awkward {
     Index64 singleoffsets = jagged.offsets();
     Index64 multistarts(jagged.length()*len);
     Index64 multistops(jagged.length()*len);
-    Index64 nextcarry(jagged.length()*len);
+    Index64 nextcarry = Index64::scratch(jagged.length()*len);
     struct Error err = util::awkward_listarray_getitem_jagged_expand_64(
       multistarts.ptr().get(),
       multistops.ptr().get(),
@@ -1484,7 +1515,7 @@ namespace awkward {
 
     Index64 sliceindex = slicecontent.index();
     Index64 outoffsets(slicestarts.length() + 1);
-    Index64 nextcarry(carrylen);
+    Index64 nextcarry = Index64::scratch(carrylen);
     struct Error err2 = util::awkward_listarray_getitem_jagged_apply_64<T>(
       outoffsets.ptr().get(),
       nextcarry.ptr().get(),
@@ -1543,7 +1574,7 @@ namespace awkward {
       missing.length());
     util::handle_error(err1, classname(), nullptr);
 
-    Index64 nextcarry(numvalid);
+    Index64 nextcarry = Index64::scratch(numvalid);
     Index64 smalloffsets(slicestarts.length() + 1);
     Index64 largeoffsets(slicestarts.length() + 1);
     struct Error err2 = awkward_listarray_getitem_jagged_shrink_64(
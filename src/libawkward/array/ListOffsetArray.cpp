@@ -1,8 +1,10 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <cstring>
 #include <sstream>
 #include <type_traits>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
@@ -116,7 +118,7 @@ namespace awkward {
     IndexOf<T> stops = util::make_stops(offsets_);
 
     int64_t carrylen = offsets.getitem_at_nowrap(offsets.length() - 1);
-    Index64 nextcarry(carrylen);
+    Index64 nextcarry = Index64::scratch(carrylen);
     struct Error err = util::awkward_listarray_broadcast_tooffsets64<T>(
       nextcarry.ptr().get(),
       offsets.ptr().get(),
@@ -198,7 +200,7 @@ namespace awkward {
   void
   ListOffsetArrayOf<T>::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      content_.get()->setidentities(identities);
+      content_ = content_.get()->withidentities(identities);
     }
     else {
       if (length() != identities.get()->length()) {
@@ -210,12 +212,20 @@ namespace awkward {
         identities_.get());
       }
       IdentitiesPtr bigidentities = identities;
-      if (content_.get()->length() > kMaxInt32  ||
-          !std::is_same<T, int32_t>::value) {
+      if (dynamic_cast<EncodedIdentities*>(identities.get()) == nullptr  &&
+          (content_.get()->length() > kMaxInt32  ||
+           !std::is_same<T, int32_t>::value)) {
         bigidentities = identities.get()->to64();
       }
-      if (Identities32* rawidentities =
-          dynamic_cast<Identities32*>(bigidentities.get())) {
+      if (EncodedIdentities* rawidentities =
+          dynamic_cast<EncodedIdentities*>(bigidentities.get())) {
+        content_ = content_.get()->withidentities(
+          rawidentities->from_listarray(starts().to64(),
+                                       stops().to64(),
+                                       content_.get()->length()));
+      }
+      else if (Identities32* rawidentities =
+               dynamic_cast<Identities32*>(bigidentities.get())) {
         IdentitiesPtr subidentities =
           std::make_shared<Identities32>(Identities::newref(),
                                          rawidentities->fieldloc(),
@@ -233,7 +243,7 @@ namespace awkward {
           length(),
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else if (Identities64* rawidentities =
                dynamic_cast<Identities64*>(bigidentities.get())) {
@@ -254,7 +264,7 @@ namespace awkward {
           length(),
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else {
         throw std::runtime_error("unrecognized Identities specialization");
@@ -296,7 +306,7 @@ namespace awkward {
 
   template <typename T>
   const TypePtr
-  ListOffsetArrayOf<T>::type(const util::TypeStrs& typestrs) const {
+  ListOffsetArrayOf<T>::type_part(const util::TypeStrs& typestrs) const {
     return std::make_shared<ListType>(parameters_,
                                       util::gettypestr(parameters_, typestrs),
                                       content_.get()->type(typestrs));
@@ -330,6 +340,22 @@ namespace awkward {
   ListOffsetArrayOf<T>::tojson_part(ToJson& builder) const {
     int64_t len = length();
     check_for_iteration();
+    // Lists of numbers are written with one bulk ToJson call per list; if
+    // the offsets are invalid, the loop below reports the error.
+    if (NumpyArray* raw = dynamic_cast<NumpyArray*>(content_.get())) {
+      const T* offsets = offsets_.ptr().get() + offsets_.offset();
+      int64_t lencontent = raw->length();
+      bool valid = true;
+      for (int64_t i = 0;  valid  &&  i < len;  i++) {
+        int64_t start = (int64_t)offsets[i];
+        int64_t stop = (int64_t)offsets[i + 1];
+        valid = (start == stop  ||
+                 (start >= 0  &&  start <= stop  &&  stop <= lencontent));
+      }
+      if (valid  &&  raw->tojson_lists<T>(builder, offsets, len)) {
+        return;
+      }
+    }
     builder.beginlist();
     for (int64_t i = 0;  i < len;  i++) {
       getitem_at_nowrap(i).get()->tojson_part(builder);
@@ -1261,14 +1287,40 @@ namespace awkward {
   }
 
   template <>
-  const ContentPtr ListOffsetArrayOf<int64_t>::reduce_next(
-    const Reducer& reducer,
+  const ContentPtrVec ListOffsetArrayOf<int64_t>::reduce_next_multi(
+    const ContentPtrVec& contents,
+    const ReducerPtrVec& reducers,
     int64_t negaxis,
     const Index64& starts,
     const Index64& parents,
     int64_t outlength, bool mask, bool keepdims) const {
     std::pair<bool, int64_t> branchdepth = branch_depth();
 
+    // Every content must have exactly these offsets (and the same depth) to
+    // share the index preparation; otherwise, each is reduced on its own.
+    ContentPtrVec nextcontents;
+    for (auto content : contents) {
+      ListOffsetArray64* raw =
+        dynamic_cast<ListOffsetArray64*>(content.get());
+      if (raw == nullptr  ||
+          raw->branch_depth() != branchdepth  ||
+          raw->offsets().length() != offsets_.length()  ||
+          std::memcmp(raw->offsets().ptr().get() + raw->offsets().offset(),
+                      offsets_.ptr().get() + offsets_.offset(),
+                      sizeof(int64_t)*(size_t)offsets_.length()) != 0) {
+        return Content::reduce_next_multi(contents,
+                                          reducers,
+                                          negaxis,
+                                          starts,
+                                          parents,
+                                          outlength,
+                                          mask,
+                                          keepdims);
+      }
+      nextcontents.push_back(raw->content());
+    }
+    ContentPtrVec out;
+
     if (!branchdepth.first  &&  negaxis == branchdepth.second) {
       if (offsets_.length() - 1 != parents.length()) {
         throw std::runtime_error("offsets_.length() - 1 != parents.length()");
@@ -1286,7 +1338,7 @@ namespace awkward {
       int64_t nextlen = globalstop - globalstart;
 
       int64_t maxcount;
-      Index64 offsetscopy(offsets_.length());
+      Index64 offsetscopy = Index64::scratch(offsets_.length());
       struct Error err2 =
         awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
         &maxcount,
@@ -1296,10 +1348,10 @@ namespace awkward {
         offsets_.length() - 1);
       util::handle_error(err2, classname(), identities_.get());
 
-      Index64 nextcarry(nextlen);
-      Index64 nextparents(nextlen);
+      Index64 nextcarry = Index64::scratch(nextlen);
+      Index64 nextparents = Index64::scratch(nextlen);
       int64_t maxnextparents;
-      Index64 distincts(maxcount * outlength);
+      Index64 distincts = Index64::scratch(maxcount * outlength);
       struct Error err3 =
         awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
         nextcarry.ptr().get(),
@@ -1325,12 +1377,14 @@ namespace awkward {
         nextlen);
       util::handle_error(err4, classname(), identities_.get());
 
-      ContentPtr nextcontent = content_.get()->carry(nextcarry);
-      ContentPtr outcontent = nextcontent.get()->reduce_next(
-        reducer, negaxis - 1, nextstarts, nextparents, maxnextparents + 1,
-        mask, false);
+      for (size_t i = 0;  i < nextcontents.size();  i++) {
+        nextcontents[i] = nextcontents[i].get()->carry(nextcarry);
+      }
+      ContentPtrVec outcontents = nextcontents[0].get()->reduce_next_multi(
+        nextcontents, reducers, negaxis - 1, nextstarts, nextparents,
+        maxnextparents + 1, mask, false);
 
-      Index64 gaps(outlength);
+      Index64 gaps = Index64::scratch(outlength);
       struct Error err5 = awkward_listoffsetarray_reduce_nonlocal_findgaps_64(
         gaps.ptr().get(),
         parents.ptr().get(),
@@ -1349,44 +1403,70 @@ namespace awkward {
         gaps.ptr().get());
       util::handle_error(err6, classname(), identities_.get());
 
-      ContentPtr out = std::make_shared<ListArray64>(Identities::none(),
-                                                     util::Parameters(),
-                                                     outstarts,
-                                                     outstops,
-                                                     outcontent);
-      if (keepdims) {
-        out = std::make_shared<RegularArray>(Identities::none(),
-                                             util::Parameters(),
-                                             out,
-                                             1);
+      for (auto outcontent : outcontents) {
+        ContentPtr next = std::make_shared<ListArray64>(Identities::none(),
+                                                        util::Parameters(),
+                                                        outstarts,
+                                                        outstops,
+                                                        outcontent);
+        if (keepdims) {
+          next = std::make_shared<RegularArray>(Identities::none(),
+                                                util::Parameters(),
+                                                next,
+                                                1);
+        }
+        out.push_back(next);
       }
-      return out;
     }
 
     else {
-      int64_t globalstart;
-      int64_t globalstop;
-      struct Error err1 = awkward_listoffsetarray_reduce_global_startstop_64(
-        &globalstart,
-        &globalstop,
-        offsets_.ptr().get(),
-        offsets_.offset(),
-        offsets_.length() - 1);
-      util::handle_error(err1, classname(), identities_.get());
+      bool flat = true;
+      for (auto nextcontent : nextcontents) {
+        NumpyArray* raw = dynamic_cast<NumpyArray*>(nextcontent.get());
+        if (raw == nullptr  ||  raw->ndim() != 1  ||  !raw->iscontiguous()) {
+          flat = false;
+        }
+      }
 
-      Index64 nextparents(globalstop - globalstart);
-      struct Error err2 = awkward_listoffsetarray_reduce_local_nextparents_64(
-        nextparents.ptr().get(),
-        offsets_.ptr().get(),
-        offsets_.offset(),
-        offsets_.length() - 1);
-      util::handle_error(err2, classname(), identities_.get());
+      ContentPtrVec outcontents;
+      if (flat) {
+        // Innermost lists of a flat array: the offsets are the segments, so
+        // there is no need to build (or read) nextparents.
+        for (size_t i = 0;  i < nextcontents.size();  i++) {
+          NumpyArray* raw = dynamic_cast<NumpyArray*>(nextcontents[i].get());
+          outcontents.push_back(raw->reduce_segments(*reducers[i].get(),
+                                                     offsets_,
+                                                     mask,
+                                                     keepdims));
+        }
+      }
+      else {
+        int64_t globalstart;
+        int64_t globalstop;
+        struct Error err1 = awkward_listoffsetarray_reduce_global_startstop_64(
+          &globalstart,
+          &globalstop,
+          offsets_.ptr().get(),
+          offsets_.offset(),
+          offsets_.length() - 1);
+        util::handle_error(err1, classname(), identities_.get());
 
-      ContentPtr trimmed = content_.get()->getitem_range_nowrap(globalstart,
-                                                                globalstop);
-      ContentPtr outcontent = trimmed.get()->reduce_next(
-        reducer, negaxis, util::make_starts(offsets_), nextparents,
-        offsets_.length() - 1, mask, keepdims);
+        Index64 nextparents = Index64::scratch(globalstop - globalstart);
+        struct Error err2 = awkward_listoffsetarray_reduce_local_nextparents_64(
+          nextparents.ptr().get(),
+          offsets_.ptr().get(),
+          offsets_.offset(),
+          offsets_.length() - 1);
+        util::handle_error(err2, classname(), identities_.get());
+
+        for (size_t i = 0;  i < nextcontents.size();  i++) {
+          nextcontents[i] = nextcontents[i].get()->getitem_range_nowrap(
+            globalstart, globalstop);
+        }
+        outcontents = nextcontents[0].get()->reduce_next_multi(
+          nextcontents, reducers, negaxis, util::make_starts(offsets_),
+          nextparents, offsets_.length() - 1, mask, keepdims);
+      }
 
       Index64 outoffsets(outlength + 1);
       struct Error err3 = awkward_listoffsetarray_reduce_local_outoffsets_64(
@@ -1397,11 +1477,34 @@ namespace awkward {
         outlength);
       util::handle_error(err3, classname(), identities_.get());
 
-      return std::make_shared<ListOffsetArray64>(Identities::none(),
-                                                 util::Parameters(),
-                                                 outoffsets,
-                                                 outcontent);
+      for (auto outcontent : outcontents) {
+        out.push_back(std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                          util::Parameters(),
+                                                          outoffsets,
+                                                          outcontent));
+      }
     }
+
+    return out;
+  }
+
+  template <>
+  const ContentPtr ListOffsetArrayOf<int64_t>::reduce_next(
+    const Reducer& reducer,
+    int64_t negaxis,
+    const Index64& starts,
+    const Index64& parents,
+    int64_t outlength, bool mask, bool keepdims) const {
+    // The reducer is borrowed for the duration of the call, not owned.
+    ReducerPtr borrowed(&reducer, [](const Reducer*) -> void { });
+    return reduce_next_multi(ContentPtrVec({ shallow_copy() }),
+                             ReducerPtrVec({ borrowed }),
+                             negaxis,
+                             starts,
+                             parents,
+                             outlength,
+                             mask,
+                             keepdims)[0];
   }
 
   template <typename T>
@@ -1422,6 +1525,29 @@ namespace awkward {
                                                         keepdims);
   }
 
+  template <typename T>
+  const ContentPtrVec
+  ListOffsetArrayOf<T>::reduce_next_multi(const ContentPtrVec& contents,
+                                          const ReducerPtrVec& reducers,
+                                          int64_t negaxis,
+                                          const Index64& starts,
+                                          const Index64& parents,
+                                          int64_t length,
+                                          bool mask,
+                                          bool keepdims) const {
+    ContentPtr next = toListOffsetArray64(true);
+    ContentPtrVec nextcontents(contents);
+    nextcontents[0] = next;
+    return next.get()->reduce_next_multi(nextcontents,
+                                         reducers,
+                                         negaxis,
+                                         starts,
+                                         parents,
+                                         length,
+                                         mask,
+                                         keepdims);
+  }
+
   template <typename T>
   const ContentPtr
   ListOffsetArrayOf<T>::localindex(int64_t axis, int64_t depth) const {
@@ -1493,8 +1619,7 @@ namespace awkward {
       std::vector<std::shared_ptr<int64_t>> tocarry;
       std::vector<int64_t*> tocarryraw;
       for (int64_t j = 0;  j < n;  j++) {
-        std::shared_ptr<int64_t> ptr(new int64_t[(size_t)totallen],
-                                     util::array_deleter<int64_t>());
+        std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(totallen));
         tocarry.push_back(ptr);
         tocarryraw.push_back(ptr.get());
       }
@@ -1553,7 +1678,7 @@ namespace awkward {
     IndexOf<T> stops = util::make_stops(offsets_);
     SliceItemPtr nexthead = tail.head();
     Slice nexttail = tail.tail();
-    Index64 nextcarry(lenstarts);
+    Index64 nextcarry = Index64::scratch(lenstarts);
     struct Error err = util::awkward_listarray_getitem_next_at_64<T>(
       nextcarry.ptr().get(),
       starts.ptr().get(),
@@ -1598,7 +1723,7 @@ namespace awkward {
     util::handle_error(err1, classname(), identities_.get());
 
     IndexOf<T> nextoffsets(lenstarts + 1);
-    Index64 nextcarry(carrylength);
+    Index64 nextcarry = Index64::scratch(carrylength);
 
     struct Error err2 = util::awkward_listarray_getitem_next_range_64<T>(
       nextoffsets.ptr().get(),
@@ -1629,7 +1754,7 @@ namespace awkward {
         nextoffsets.ptr().get(),
         lenstarts);
       util::handle_error(err1, classname(), identities_.get());
-      Index64 nextadvanced(total);
+      Index64 nextadvanced = Index64::scratch(total);
       struct Error err2 =
         util::awkward_listarray_getitem_next_range_spreadadvanced_64<T>(
         nextadvanced.ptr().get(),
@@ -1657,8 +1782,8 @@ namespace awkward {
     Slice nexttail = tail.tail();
     Index64 flathead = array.ravel();
     if (advanced.length() == 0) {
-      Index64 nextcarry(lenstarts*flathead.length());
-      Index64 nextadvanced(lenstarts*flathead.length());
+      Index64 nextcarry = Index64::scratch(lenstarts*flathead.length());
+      Index64 nextadvanced = Index64::scratch(lenstarts*flathead.length());
       struct Error err = util::awkward_listarray_getitem_next_array_64<T>(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
@@ -1679,8 +1804,8 @@ namespace awkward {
                array.shape());
     }
     else {
-      Index64 nextcarry(lenstarts);
-      Index64 nextadvanced(lenstarts);
+      Index64 nextcarry = Index64::scratch(lenstarts);
+      Index64 nextadvanced = Index64::scratch(lenstarts);
       struct Error err =
         util::awkward_listarray_getitem_next_array_advanced_64<T>(
         nextcarry.ptr().get(),
@@ -35,7 +35,7 @@ namespace awkward {
   }
 
   const TypePtr
-  None::type(const util::TypeStrs& typestrs) const {
+  None::type_part(const util::TypeStrs& typestrs) const {
     throw std::runtime_error("undefined operation: None::type()");
   }
 
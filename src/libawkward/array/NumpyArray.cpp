@@ -5,6 +5,7 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
@@ -403,7 +404,7 @@ namespace awkward {
   }
 
   const TypePtr
-  NumpyArray::type(const util::TypeStrs& typestrs) const {
+  NumpyArray::type_part(const util::TypeStrs& typestrs) const {
     TypePtr out;
     if (format_.compare("d") == 0) {
       out = std::make_shared<PrimitiveType>(
@@ -675,6 +676,116 @@ namespace awkward {
     }
   }
 
+  template <typename T, typename V>
+  void
+  numpyarray_tojson_lists(ToJson& builder,
+                          const T* offsets,
+                          int64_t length,
+                          const void* data,
+                          int64_t stride,
+                          void (ToJson::*bulk)(const V*, int64_t, int64_t)) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    builder.beginlist();
+    for (int64_t i = 0;  i < length;  i++) {
+      int64_t start = (int64_t)offsets[i];
+      int64_t stop = (int64_t)offsets[i + 1];
+      (builder.*bulk)(reinterpret_cast<const V*>(bytes + start*stride),
+                      stop - start,
+                      stride);
+    }
+    builder.endlist();
+  }
+
+  template <typename T>
+  bool
+  NumpyArray::tojson_lists(ToJson& builder,
+                           const T* offsets,
+                           int64_t length) const {
+    if (ndim() != 1  ||  identities_.get() != nullptr  ||
+        parameter_equals("__array__", "\"byte\"")  ||
+        parameter_equals("__array__", "\"char\"")) {
+      return false;
+    }
+    int64_t stride = (int64_t)strides_[0];
+    if (format_.compare("d") == 0) {
+      numpyarray_tojson_lists<T, double>(
+        builder, offsets, length, byteptr(), stride, &ToJson::real_array);
+    }
+    else if (format_.compare("f") == 0) {
+      numpyarray_tojson_lists<T, float>(
+        builder, offsets, length, byteptr(), stride, &ToJson::real_array);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("q") == 0) {
+#else
+    else if (format_.compare("l") == 0) {
+#endif
+      numpyarray_tojson_lists<T, int64_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("Q") == 0) {
+#else
+    else if (format_.compare("L") == 0) {
+#endif
+      numpyarray_tojson_lists<T, uint64_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("l") == 0) {
+#else
+    else if (format_.compare("i") == 0) {
+#endif
+      numpyarray_tojson_lists<T, int32_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("L") == 0) {
+#else
+    else if (format_.compare("I") == 0) {
+#endif
+      numpyarray_tojson_lists<T, uint32_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+    else if (format_.compare("h") == 0) {
+      numpyarray_tojson_lists<T, int16_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+    else if (format_.compare("H") == 0) {
+      numpyarray_tojson_lists<T, uint16_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+    else if (format_.compare("b") == 0) {
+      numpyarray_tojson_lists<T, int8_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+    else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
+      numpyarray_tojson_lists<T, uint8_t>(
+        builder, offsets, length, byteptr(), stride, &ToJson::integer_array);
+    }
+    else if (format_.compare("?") == 0) {
+      numpyarray_tojson_lists<T, bool>(
+        builder, offsets, length, byteptr(), stride, &ToJson::boolean_array);
+    }
+    else {
+      return false;
+    }
+    return true;
+  }
+
+  template bool
+  NumpyArray::tojson_lists<int32_t>(ToJson& builder,
+                                    const int32_t* offsets,
+                                    int64_t length) const;
+  template bool
+  NumpyArray::tojson_lists<uint32_t>(ToJson& builder,
+                                     const uint32_t* offsets,
+                                     int64_t length) const;
+  template bool
+  NumpyArray::tojson_lists<int64_t>(ToJson& builder,
+                                    const int64_t* offsets,
+                                    int64_t length) const;
+
   void
   NumpyArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
     int64_t len = 1;
@@ -745,6 +856,7 @@ namespace awkward {
   void
   NumpyArray::check_for_iteration() const {
     if (identities_.get() != nullptr  &&
+        !shape_.empty()  &&
         identities_.get()->length() < shape_[0]) {
       util::handle_error(
         failure("len(identities) < len(array)", kSliceNone, kSliceNone),
@@ -875,6 +987,7 @@ namespace awkward {
 
   const ContentPtr
   NumpyArray::getitem(const Slice& where) const {
+    ScratchScope scratch;
     if (isscalar()) {
       throw std::runtime_error("cannot get-item on a scalar");
     }
@@ -941,7 +1054,7 @@ namespace awkward {
 
       SliceItemPtr nexthead = where.head();
       Slice nexttail = where.tail();
-      Index64 nextcarry(1);
+      Index64 nextcarry = Index64::scratch(1);
       nextcarry.setitem_at_nowrap(0, 0);
       Index64 nextadvanced(0);
       NumpyArray out = next.getitem_next(nexthead,
@@ -985,8 +1098,7 @@ namespace awkward {
   const ContentPtr
   NumpyArray::carry(const Index64& carry) const {
     std::shared_ptr<void> ptr(
-      new uint8_t[(size_t)(carry.length()*strides_[0])],
-      util::array_deleter<uint8_t>());
+      allocate_array<uint8_t>(carry.length()*strides_[0]));
     struct Error err = awkward_numpyarray_getitem_next_null_64(
       reinterpret_cast<uint8_t*>(ptr.get()),
       reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -1463,8 +1575,7 @@ namespace awkward {
       }
 
       std::shared_ptr<void> ptr(
-        new uint8_t[(size_t)(itemsize*(self_flatlength + other_flatlength))],
-        util::array_deleter<uint8_t>());
+        allocate_array<uint8_t>(itemsize*(self_flatlength + other_flatlength)));
 
       NumpyArray contiguous_other = rawother->contiguous();
 
@@ -2292,6 +2403,157 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  NumpyArray::reduce_segments(const Reducer& reducer,
+                              const Index64& offsets,
+                              bool mask,
+                              bool keepdims) const {
+    if (shape_.size() != 1  ||  !iscontiguous()) {
+      throw std::runtime_error(
+        "NumpyArray::reduce_segments requires a one-dimensional, "
+        "contiguous array");
+    }
+    int64_t outlength = offsets.length() - 1;
+
+    std::shared_ptr<void> ptr;
+    if (format_.compare("?") == 0) {
+      ptr = reducer.apply_bool_segments(
+        reinterpret_cast<bool*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+    else if (format_.compare("b") == 0) {
+      ptr = reducer.apply_int8_segments(
+        reinterpret_cast<int8_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+    else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
+      ptr = reducer.apply_uint8_segments(
+        reinterpret_cast<uint8_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+    else if (format_.compare("h") == 0) {
+      ptr = reducer.apply_int16_segments(
+        reinterpret_cast<int16_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+    else if (format_.compare("H") == 0) {
+      ptr = reducer.apply_uint16_segments(
+        reinterpret_cast<uint16_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("l") == 0) {
+#else
+    else if (format_.compare("i") == 0) {
+#endif
+      ptr = reducer.apply_int32_segments(
+        reinterpret_cast<int32_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("L") == 0) {
+#else
+    else if (format_.compare("I") == 0) {
+#endif
+      ptr = reducer.apply_uint32_segments(
+        reinterpret_cast<uint32_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("q") == 0) {
+#else
+    else if (format_.compare("l") == 0) {
+#endif
+      ptr = reducer.apply_int64_segments(
+        reinterpret_cast<int64_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("Q") == 0) {
+#else
+    else if (format_.compare("L") == 0) {
+#endif
+      ptr = reducer.apply_uint64_segments(
+        reinterpret_cast<uint64_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+    else if (format_.compare("f") == 0) {
+      ptr = reducer.apply_float32_segments(
+        reinterpret_cast<float*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+    else if (format_.compare("d") == 0) {
+      ptr = reducer.apply_float64_segments(
+        reinterpret_cast<double*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        offsets,
+        outlength);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot apply reducers to NumpyArray with format \"")
+        + format_ + std::string("\""));
+    }
+
+    std::string format = reducer.return_type(format_);
+    ssize_t itemsize = reducer.return_typesize(format_);
+    std::vector<ssize_t> shape({ (ssize_t)outlength });
+    std::vector<ssize_t> strides({ itemsize });
+    ContentPtr out = std::make_shared<NumpyArray>(Identities::none(),
+                                                  util::Parameters(),
+                                                  ptr,
+                                                  shape,
+                                                  strides,
+                                                  0,
+                                                  itemsize,
+                                                  format);
+
+    if (mask) {
+      Index8 mask(outlength);
+      struct Error err =
+        awkward_numpyarray_reduce_mask_bytemaskedarray_segments_64(
+          mask.ptr().get(),
+          offsets.ptr().get(),
+          offsets.offset(),
+          outlength);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ByteMaskedArray>(Identities::none(),
+                                              util::Parameters(),
+                                              mask,
+                                              out,
+                                              false);
+    }
+
+    if (keepdims) {
+      out = std::make_shared<RegularArray>(Identities::none(),
+                                           util::Parameters(),
+                                           out,
+                                           1);
+    }
+
+    return out;
+  }
+
   const ContentPtr
   NumpyArray::localindex(int64_t axis, int64_t depth) const {
     int64_t toaxis = axis_wrap_if_negative(axis);
@@ -2485,8 +2747,7 @@ namespace awkward {
   NumpyArray::contiguous_next(const Index64& bytepos) const {
     if (iscontiguous()) {
       std::shared_ptr<void> ptr(
-        new uint8_t[(size_t)(bytepos.length()*strides_[0])],
-        util::array_deleter<uint8_t>());
+        allocate_array<uint8_t>(bytepos.length()*strides_[0]));
       struct Error err = awkward_numpyarray_contiguous_copy_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -2507,8 +2768,7 @@ namespace awkward {
 
     else if (shape_.size() == 1) {
       std::shared_ptr<void> ptr(
-        new uint8_t[(size_t)(bytepos.length()*itemsize_)],
-        util::array_deleter<uint8_t>());
+        allocate_array<uint8_t>(bytepos.length()*itemsize_));
       struct Error err = awkward_numpyarray_contiguous_copy_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -2763,8 +3023,7 @@ namespace awkward {
                            int64_t stride,
                            bool first) const {
     if (head.get() == nullptr) {
-      std::shared_ptr<void> ptr(new uint8_t[(size_t)(carry.length()*stride)],
-                                util::array_deleter<uint8_t>());
+      std::shared_ptr<void> ptr(allocate_array<uint8_t>(carry.length()*stride));
       struct Error err = awkward_numpyarray_getitem_next_null_64(
         reinterpret_cast<uint8_t*>(ptr.get()),
         reinterpret_cast<uint8_t*>(ptr_.get()),
@@ -2907,7 +3166,7 @@ namespace awkward {
         identities_.get());
     }
 
-    Index64 nextcarry(carry.length());
+    Index64 nextcarry = Index64::scratch(carry.length());
     struct Error err = awkward_numpyarray_getitem_next_at_64(
       nextcarry.ptr().get(),
       carry.ptr().get(),
@@ -2982,7 +3241,7 @@ namespace awkward {
     Slice nexttail = tail.tail();
 
     if (advanced.length() == 0) {
-      Index64 nextcarry(carry.length()*lenhead);
+      Index64 nextcarry = Index64::scratch(carry.length()*lenhead);
       struct Error err = awkward_numpyarray_getitem_next_range_64(
         nextcarry.ptr().get(),
         carry.ptr().get(),
@@ -3019,8 +3278,8 @@ namespace awkward {
     }
 
     else {
-      Index64 nextcarry(carry.length()*lenhead);
-      Index64 nextadvanced(carry.length()*lenhead);
+      Index64 nextcarry = Index64::scratch(carry.length()*lenhead);
+      Index64 nextadvanced = Index64::scratch(carry.length()*lenhead);
       struct Error err = awkward_numpyarray_getitem_next_range_advanced_64(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
@@ -3169,8 +3428,8 @@ namespace awkward {
     util::handle_error(err, classname(), identities_.get());
 
     if (advanced.length() == 0) {
-      Index64 nextcarry(carry.length()*flathead.length());
-      Index64 nextadvanced(carry.length()*flathead.length());
+      Index64 nextcarry = Index64::scratch(carry.length()*flathead.length());
+      Index64 nextadvanced = Index64::scratch(carry.length()*flathead.length());
       struct Error err = awkward_numpyarray_getitem_next_array_64(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
@@ -3215,7 +3474,7 @@ namespace awkward {
     }
 
     else {
-      Index64 nextcarry(carry.length());
+      Index64 nextcarry = Index64::scratch(carry.length());
       struct Error err = awkward_numpyarray_getitem_next_array_advanced_64(
         nextcarry.ptr().get(),
         carry.ptr().get(),
@@ -3256,11 +3515,7 @@ namespace awkward {
     }
     else if (ndim() == 1) {
       bool* array = reinterpret_cast<bool*>(byteptr());
-      builder.beginlist();
-      for (int64_t i = 0;  i < length();  i++) {
-        builder.boolean(array[i]);
-      }
-      builder.endlist();
+      builder.boolean_array(array, length(), (int64_t)strides_[0]);
     }
     else {
       const std::vector<ssize_t> shape(shape_.begin() + 1, shape_.end());
@@ -3291,11 +3546,7 @@ namespace awkward {
     }
     else if (ndim() == 1) {
       T* array = reinterpret_cast<T*>(byteptr());
-      builder.beginlist();
-      for (int64_t i = 0;  i < length();  i++) {
-        builder.integer(array[i]);
-      }
-      builder.endlist();
+      builder.integer_array(array, length(), (int64_t)strides_[0]);
     }
     else {
       const std::vector<ssize_t> shape(shape_.begin() + 1, shape_.end());
@@ -3326,11 +3577,7 @@ namespace awkward {
     }
     else if (ndim() == 1) {
       T* array = reinterpret_cast<T*>(byteptr());
-      builder.beginlist();
-      for (int64_t i = 0;  i < length();  i++) {
-        builder.real(array[i]);
-      }
-      builder.endlist();
+      builder.real_array(array, length(), (int64_t)strides_[0]);
     }
     else {
       const std::vector<ssize_t> shape(shape_.begin() + 1, shape_.end());
@@ -82,8 +82,8 @@ namespace awkward {
   }
 
   const TypePtr
-  Record::type(const util::TypeStrs& typestrs) const {
-    TypePtr out = array_.get()->type(typestrs);
+  Record::type_part(const util::TypeStrs& typestrs) const {
+    TypePtr out = array_.get()->type(typestrs).get()->shallow_copy();
     out.get()->setparameters(parameters_);
     return out;
   }
@@ -3,6 +3,7 @@
 #include <sstream>
 #include <algorithm>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
@@ -28,7 +29,8 @@ namespace awkward {
       : Content(identities, parameters)
       , contents_(contents)
       , recordlookup_(recordlookup)
-      , length_(length) {
+      , length_(length)
+      , lazy_(nullptr) {
     if (recordlookup_.get() != nullptr  &&
         recordlookup_.get()->size() != contents_.size()) {
       throw std::invalid_argument(
@@ -62,9 +64,45 @@ namespace awkward {
                     recordlookup,
                     minlength(contents)) { }
 
+  RecordArray::LazyCarry::LazyCarry(const Index64& carry, size_t numfields)
+      : carry(carry)
+      , carried(numfields, ContentPtr(nullptr)) { }
+
+  RecordArray::RecordArray(const IdentitiesPtr& identities,
+                           const util::Parameters& parameters,
+                           const ContentPtrVec& contents,
+                           const util::RecordLookupPtr& recordlookup,
+                           const std::shared_ptr<LazyCarry>& lazy)
+      : Content(identities, parameters)
+      , contents_(contents)
+      , recordlookup_(recordlookup)
+      , length_(lazy.get()->carry.length())
+      , lazy_(lazy) { }
+
   const ContentPtrVec
   RecordArray::contents() const {
-    return contents_;
+    if (lazy_.get() == nullptr) {
+      return contents_;
+    }
+    ContentPtrVec out;
+    for (int64_t i = 0;  i < numfields();  i++) {
+      out.push_back(field(i));
+    }
+    return out;
+  }
+
+  bool
+  RecordArray::islazy() const {
+    if (lazy_.get() == nullptr) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(lazy_.get()->mutex);
+    for (auto x : lazy_.get()->carried) {
+      if (x.get() == nullptr) {
+        return true;
+      }
+    }
+    return false;
   }
 
   const util::RecordLookupPtr
@@ -93,7 +131,7 @@ namespace awkward {
       if (where == (int64_t)i) {
         contents.push_back(what);
       }
-      contents.push_back(contents_[i]);
+      contents.push_back(field((int64_t)i));
     }
     if (where >= numfields()) {
       contents.push_back(what);
@@ -126,7 +164,7 @@ namespace awkward {
         + std::string(" cannot be assigned to record array of length ")
         + std::to_string(length()));
     }
-    ContentPtrVec contents(contents_.begin(), contents_.end());
+    ContentPtrVec contents = this->contents();
     contents.push_back(what);
     util::RecordLookupPtr recordlookup;
     if (recordlookup_.get() != nullptr) {
@@ -183,9 +221,17 @@ namespace awkward {
 
   void
   RecordArray::setidentities(const IdentitiesPtr& identities) {
+    if (lazy_.get() != nullptr) {
+      // The identities are for the carried fields, and lazy_->carried is
+      // shared with other copies, so carry every field into contents_.
+      for (size_t j = 0;  j < contents_.size();  j++) {
+        contents_[j] = field((int64_t)j);
+      }
+      lazy_ = nullptr;
+    }
     if (identities.get() == nullptr) {
-      for (auto content : contents_) {
-        content.get()->setidentities(identities);
+      for (size_t j = 0;  j < contents_.size();  j++) {
+        contents_[j] = contents_[j].get()->withidentities(identities);
       }
     }
     else {
@@ -204,7 +250,7 @@ namespace awkward {
           fieldloc.push_back(
             std::pair<int64_t, std::string>(identities.get()->width() - 1,
                                             std::to_string(j)));
-          contents_[j].get()->setidentities(
+          contents_[j] = contents_[j].get()->withidentities(
             identities.get()->withfieldloc(fieldloc));
         }
       }
@@ -214,7 +260,7 @@ namespace awkward {
           Identities::FieldLoc fieldloc(original.begin(), original.end());
           fieldloc.push_back(std::pair<int64_t, std::string>(
             identities.get()->width() - 1, recordlookup_.get()->at(j)));
-          contents_[j].get()->setidentities(
+          contents_[j] = contents_[j].get()->withidentities(
             identities.get()->withfieldloc(fieldloc));
         }
       }
@@ -223,7 +269,8 @@ namespace awkward {
   }
 
   const TypePtr
-  RecordArray::type(const util::TypeStrs& typestrs) const {
+  RecordArray::type_part(const util::TypeStrs& typestrs) const {
+    // Carrying does not change the type, so lazy fields are not carried here.
     std::vector<TypePtr> types;
     for (auto item : contents_) {
       types.push_back(item.get()->type(typestrs));
@@ -260,7 +307,7 @@ namespace awkward {
         out << ">";
       }
       out << "\n";
-      out << contents_[j].get()->tostring_part(
+      out << field((int64_t)j).get()->tostring_part(
                indent + std::string("        "), "", "\n");
       out << indent << "    </field>\n";
     }
@@ -271,7 +318,8 @@ namespace awkward {
   void
   RecordArray::tojson_part(ToJson& builder) const {
     int64_t rows = length();
-    size_t cols = contents_.size();
+    ContentPtrVec contents = this->contents();
+    size_t cols = contents.size();
     util::RecordLookupPtr keys = recordlookup_;
     if (istuple()) {
       keys = std::make_shared<util::RecordLookup>();
@@ -285,7 +333,7 @@ namespace awkward {
       builder.beginrecord();
       for (size_t j = 0;  j < cols;  j++) {
         builder.field(keys.get()->at(j).c_str());
-        contents_[j].get()->getitem_at_nowrap(i).get()->tojson_part(builder);
+        contents[j].get()->getitem_at_nowrap(i).get()->tojson_part(builder);
       }
       builder.endrecord();
     }
@@ -294,8 +342,27 @@ namespace awkward {
 
   void
   RecordArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
-    for (auto x : contents_) {
-      x.get()->nbytes_part(largest);
+    if (lazy_.get() == nullptr) {
+      for (auto x : contents_) {
+        x.get()->nbytes_part(largest);
+      }
+    }
+    else {
+      // Fields that have not been carried yet still hold the uncarried
+      // buffers, as well as the carry itself.
+      std::lock_guard<std::mutex> lock(lazy_.get()->mutex);
+      bool pending = false;
+      for (size_t i = 0;  i < contents_.size();  i++) {
+        ContentPtr x = lazy_.get()->carried[i];
+        if (x.get() == nullptr) {
+          pending = true;
+          x = contents_[i];
+        }
+        x.get()->nbytes_part(largest);
+      }
+      if (pending) {
+        lazy_.get()->carry.nbytes_part(largest);
+      }
     }
     if (identities_.get() != nullptr) {
       identities_.get()->nbytes_part(largest);
@@ -309,6 +376,13 @@ namespace awkward {
 
   const ContentPtr
   RecordArray::shallow_copy() const {
+    if (lazy_.get() != nullptr) {
+      return std::shared_ptr<RecordArray>(new RecordArray(identities_,
+                                                          parameters_,
+                                                          contents_,
+                                                          recordlookup_,
+                                                          lazy_));
+    }
     return std::make_shared<RecordArray>(identities_,
                                          parameters_,
                                          contents_,
@@ -321,7 +395,7 @@ namespace awkward {
                          bool copyindexes,
                          bool copyidentities) const {
     ContentPtrVec contents;
-    for (auto x : contents_) {
+    for (auto x : this->contents()) {
       contents.push_back(x.get()->deep_copy(copyarrays,
                                             copyindexes,
                                             copyidentities));
@@ -399,6 +473,35 @@ namespace awkward {
                                            recordlookup_,
                                            stop - start);
     }
+    else if (lazy_.get() != nullptr) {
+      // Slice the carry rather than the fields, but keep the fields that
+      // have already been carried. The carry kernels ignore the offset of a
+      // carry, so the slice points into the same buffer at offset 0.
+      const Index64& carry = lazy_.get()->carry;
+      Index64 sliced(std::shared_ptr<int64_t>(
+                       carry.ptr(),
+                       carry.ptr().get() + carry.offset() + start),
+                     0,
+                     stop - start);
+      std::shared_ptr<LazyCarry> lazy = std::make_shared<LazyCarry>(
+        is_scratch(sliced.ptr().get()) ? sliced.deep_copy() : sliced,
+        contents_.size());
+      {
+        std::lock_guard<std::mutex> lock(lazy_.get()->mutex);
+        for (size_t i = 0;  i < contents_.size();  i++) {
+          ContentPtr x = lazy_.get()->carried[i];
+          if (x.get() != nullptr) {
+            lazy.get()->carried[i] = x.get()->getitem_range_nowrap(start,
+                                                                    stop);
+          }
+        }
+      }
+      return std::shared_ptr<RecordArray>(new RecordArray(identities_,
+                                                          parameters_,
+                                                          contents_,
+                                                          recordlookup_,
+                                                          lazy));
+    }
     else {
       ContentPtrVec contents;
       for (auto content : contents_) {
@@ -438,19 +541,47 @@ namespace awkward {
 
   const ContentPtr
   RecordArray::carry(const Index64& carry) const {
-    ContentPtrVec contents;
-    for (auto content : contents_) {
-      contents.push_back(content.get()->carry(carry));
-    }
     IdentitiesPtr identities(nullptr);
     if (identities_.get() != nullptr) {
       identities = identities_.get()->getitem_carry_64(carry);
     }
-    return std::make_shared<RecordArray>(identities,
-                                         parameters_,
-                                         contents,
-                                         recordlookup_,
-                                         carry.length());
+    if (contents_.empty()) {
+      return std::make_shared<RecordArray>(identities,
+                                           parameters_,
+                                           contents_,
+                                           recordlookup_,
+                                           carry.length());
+    }
+    // The fields are carried when they are first accessed, so check the
+    // carry now to raise errors where they would be raised eagerly.
+    struct Error err = awkward_carry_check_64(
+      carry.ptr().get(),
+      carry.length(),
+      length_);
+    util::handle_error(err, classname(), identities_.get());
+    std::shared_ptr<LazyCarry> lazy(nullptr);
+    if (lazy_.get() == nullptr) {
+      lazy = std::make_shared<LazyCarry>(
+        is_scratch(carry.ptr().get()) ? carry.deep_copy() : carry,
+        contents_.size());
+    }
+    else {
+      // A carry of a carry is a single carry of the original fields.
+      Index64 nextcarry(carry.length());
+      struct Error err2 = awkward_index64_carry_nocheck_64(
+        nextcarry.ptr().get(),
+        lazy_.get()->carry.ptr().get(),
+        carry.ptr().get(),
+        lazy_.get()->carry.offset(),
+        carry.length());
+      util::handle_error(err2, classname(), identities_.get());
+      lazy = std::make_shared<LazyCarry>(nextcarry, contents_.size());
+    }
+    return std::shared_ptr<RecordArray>(new RecordArray(identities,
+                                                        parameters_,
+                                                        contents_,
+                                                        recordlookup_,
+                                                        lazy));
   }
 
   const std::string
@@ -580,7 +711,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->num(axis, depth));
       }
       return std::make_shared<RecordArray>(Identities::none(),
@@ -604,7 +735,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         ContentPtr trimmed = content.get()->getitem_range(0, length());
         std::pair<Index64, ContentPtr> pair =
           trimmed.get()->offsets_and_flattened(axis, depth);
@@ -824,7 +955,7 @@ namespace awkward {
   const ContentPtr
   RecordArray::fillna(const ContentPtr& value) const {
     ContentPtrVec contents;
-    for (auto content : contents_) {
+    for (auto content : this->contents()) {
       contents.push_back(content.get()->fillna(value));
     }
     return std::make_shared<RecordArray>(identities_,
@@ -842,7 +973,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->rpad(target, toaxis, depth));
       }
       if (contents.empty()) {
@@ -871,7 +1002,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(
           content.get()->rpad_and_clip(target, toaxis, depth));
       }
@@ -900,7 +1031,7 @@ namespace awkward {
                            bool mask,
                            bool keepdims) const {
     ContentPtrVec contents;
-    for (auto content : contents_) {
+    for (auto content : this->contents()) {
       ContentPtr trimmed = content.get()->getitem_range_nowrap(0, length());
       ContentPtr next = trimmed.get()->reduce_next(reducer,
                                                    negaxis,
@@ -926,7 +1057,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->localindex(axis, depth));
       }
       return std::make_shared<RecordArray>(identities_,
@@ -953,7 +1084,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->choose(n,
                                                  diagonal,
                                                  recordlookup,
@@ -977,35 +1108,55 @@ namespace awkward {
         + std::string(" for record with only " + std::to_string(numfields()))
         + std::string(" fields"));
     }
-    return contents_[(size_t)fieldindex];
+    if (lazy_.get() == nullptr) {
+      return contents_[(size_t)fieldindex];
+    }
+    {
+      std::lock_guard<std::mutex> lock(lazy_.get()->mutex);
+      ContentPtr out = lazy_.get()->carried[(size_t)fieldindex];
+      if (out.get() != nullptr) {
+        return out;
+      }
+    }
+    // Carry without holding the lock; if two threads race, both results
+    // are equal and the first one stored wins.
+    ContentPtr carried =
+      contents_[(size_t)fieldindex].get()->carry(lazy_.get()->carry);
+    std::lock_guard<std::mutex> lock(lazy_.get()->mutex);
+    ContentPtr& out = lazy_.get()->carried[(size_t)fieldindex];
+    if (out.get() == nullptr) {
+      out = carried;
+    }
+    return out;
   }
 
   const ContentPtr
   RecordArray::field(const std::string& key) const {
-    return contents_[(size_t)fieldindex(key)];
+    return field(fieldindex(key));
   }
 
   const ContentPtrVec
   RecordArray::fields() const {
-    return ContentPtrVec(contents_);
+    return contents();
   }
 
   const std::vector<std::pair<std::string, ContentPtr>>
   RecordArray::fielditems() const {
     std::vector<std::pair<std::string, ContentPtr>> out;
+    ContentPtrVec contents = this->contents();
     if (istuple()) {
-      size_t cols = contents_.size();
+      size_t cols = contents.size();
       for (size_t j = 0;  j < cols;  j++) {
         out.push_back(
-          std::pair<std::string, ContentPtr>(std::to_string(j), contents_[j]));
+          std::pair<std::string, ContentPtr>(std::to_string(j), contents[j]));
       }
     }
     else {
-      size_t cols = contents_.size();
+      size_t cols = contents.size();
       for (size_t j = 0;  j < cols;  j++) {
         out.push_back(
           std::pair<std::string, ContentPtr>(recordlookup_.get()->at(j),
-                                             contents_[j]));
+                                             contents[j]));
       }
     }
     return out;
@@ -1013,6 +1164,14 @@ namespace awkward {
 
   const std::shared_ptr<RecordArray>
   RecordArray::astuple() const {
+    if (lazy_.get() != nullptr) {
+      return std::shared_ptr<RecordArray>(
+        new RecordArray(identities_,
+                        parameters_,
+                        contents_,
+                        util::RecordLookupPtr(nullptr),
+                        lazy_));
+    }
     return std::make_shared<RecordArray>(identities_,
                                          parameters_,
                                          contents_,
@@ -1048,7 +1207,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->getitem_next(head,
                                                        emptytail,
                                                        advanced));
@@ -1160,7 +1319,7 @@ namespace awkward {
     }
     else {
       ContentPtrVec contents;
-      for (auto content : contents_) {
+      for (auto content : this->contents()) {
         contents.push_back(content.get()->getitem_next_jagged(slicestarts,
                                                               slicestops,
                                                               slicecontent,
@@ -4,6 +4,7 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "awkward/Allocator.h"
 #include "awkward/cpu-kernels/identities.h"
 #include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
@@ -81,7 +82,7 @@ namespace awkward {
 
     if (size_ == 1) {
       int64_t carrylen = offsets.getitem_at_nowrap(offsets.length() - 1);
-      Index64 nextcarry(carrylen);
+      Index64 nextcarry = Index64::scratch(carrylen);
       struct Error err = awkward_regulararray_broadcast_tooffsets64_size1(
         nextcarry.ptr().get(),
         offsets.ptr().get(),
@@ -127,7 +128,7 @@ namespace awkward {
   void
   RegularArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      content_.get()->setidentities(identities);
+      content_ = content_.get()->withidentities(identities);
     }
     else {
       if (length() != identities.get()->length()) {
@@ -139,11 +140,17 @@ namespace awkward {
           identities_.get());
       }
       IdentitiesPtr bigidentities = identities;
-      if (content_.get()->length() > kMaxInt32) {
+      if (dynamic_cast<EncodedIdentities*>(identities.get()) == nullptr  &&
+          (content_.get()->length() > kMaxInt32)) {
         bigidentities = identities.get()->to64();
       }
-      if (Identities32* rawidentities =
-          dynamic_cast<Identities32*>(bigidentities.get())) {
+      if (EncodedIdentities* rawidentities =
+          dynamic_cast<EncodedIdentities*>(bigidentities.get())) {
+        content_ = content_.get()->withidentities(
+          rawidentities->from_regulararray(size_, content_.get()->length()));
+      }
+      else if (Identities32* rawidentities =
+               dynamic_cast<Identities32*>(bigidentities.get())) {
         IdentitiesPtr subidentities =
           std::make_shared<Identities32>(Identities::newref(),
                                          rawidentities->fieldloc(),
@@ -160,7 +167,7 @@ namespace awkward {
           length(),
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else if (Identities64* rawidentities =
                dynamic_cast<Identities64*>(bigidentities.get())) {
@@ -180,7 +187,7 @@ namespace awkward {
           length(),
           rawidentities->width());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else {
         throw std::runtime_error("unrecognized Identities specialization");
@@ -220,7 +227,7 @@ namespace awkward {
   }
 
   const TypePtr
-  RegularArray::type(const util::TypeStrs& typestrs) const {
+  RegularArray::type_part(const util::TypeStrs& typestrs) const {
     return std::make_shared<RegularType>(
       parameters_,
       util::gettypestr(parameters_, typestrs),
@@ -382,7 +389,7 @@ namespace awkward {
 
   const ContentPtr
   RegularArray::carry(const Index64& carry) const {
-    Index64 nextcarry(carry.length()*size_);
+    Index64 nextcarry = Index64::scratch(carry.length()*size_);
 
     struct Error err = awkward_regulararray_getitem_carry_64(
       nextcarry.ptr().get(),
@@ -831,8 +838,7 @@ namespace awkward {
       std::vector<std::shared_ptr<int64_t>> tocarry;
       std::vector<int64_t*> tocarryraw;
       for (int64_t j = 0;  j < n;  j++) {
-        std::shared_ptr<int64_t> ptr(new int64_t[(size_t)totallen],
-                                     util::array_deleter<int64_t>());
+        std::shared_ptr<int64_t> ptr(allocate_array<int64_t>(totallen));
         tocarry.push_back(ptr);
         tocarryraw.push_back(ptr.get());
       }
@@ -887,7 +893,7 @@ namespace awkward {
     int64_t len = length();
     SliceItemPtr nexthead = tail.head();
     Slice nexttail = tail.tail();
-    Index64 nextcarry(len);
+    Index64 nextcarry = Index64::scratch(len);
 
     struct Error err = awkward_regulararray_getitem_next_at_64(
       nextcarry.ptr().get(),
@@ -937,7 +943,7 @@ namespace awkward {
       }
     }
 
-    Index64 nextcarry(len*nextsize);
+    Index64 nextcarry = Index64::scratch(len*nextsize);
 
     struct Error err = awkward_regulararray_getitem_next_range_64(
       nextcarry.ptr().get(),
@@ -958,7 +964,7 @@ namespace awkward {
         nextsize);
     }
     else {
-      Index64 nextadvanced(len*nextsize);
+      Index64 nextadvanced = Index64::scratch(len*nextsize);
 
       struct Error err =
         awkward_regulararray_getitem_next_range_spreadadvanced_64(
@@ -994,8 +1000,8 @@ namespace awkward {
     util::handle_error(err, classname(), identities_.get());
 
     if (advanced.length() == 0) {
-      Index64 nextcarry(len*flathead.length());
-      Index64 nextadvanced(len*flathead.length());
+      Index64 nextcarry = Index64::scratch(len*flathead.length());
+      Index64 nextadvanced = Index64::scratch(len*flathead.length());
 
       struct Error err = awkward_regulararray_getitem_next_array_64(
         nextcarry.ptr().get(),
@@ -1015,8 +1021,8 @@ namespace awkward {
                array.shape());
     }
     else {
-      Index64 nextcarry(len);
-      Index64 nextadvanced(len);
+      Index64 nextcarry = Index64::scratch(len);
+      Index64 nextadvanced = Index64::scratch(len);
 
       struct Error err = awkward_regulararray_getitem_next_array_advanced_64(
         nextcarry.ptr().get(),
@@ -412,8 +412,8 @@ namespace awkward {
   void
   UnionArrayOf<T, I>::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      for (auto content : contents_) {
-        content.get()->setidentities(identities);
+      for (size_t which = 0;  which < contents_.size();  which++) {
+        contents_[which] = contents_[which].get()->withidentities(identities);
       }
     }
     else {
@@ -434,12 +434,21 @@ namespace awkward {
       for (size_t which = 0;  which < contents_.size();  which++) {
         ContentPtr content = contents_[which];
         IdentitiesPtr bigidentities = identities;
-        if (content.get()->length() > kMaxInt32  ||
-            !std::is_same<I, int32_t>::value) {
+        if (dynamic_cast<EncodedIdentities*>(identities.get()) == nullptr  &&
+            (content.get()->length() > kMaxInt32  ||
+             !std::is_same<I, int32_t>::value)) {
           bigidentities = identities.get()->to64();
         }
-        if (Identities32* rawidentities =
-            dynamic_cast<Identities32*>(bigidentities.get())) {
+        if (EncodedIdentities* rawidentities =
+            dynamic_cast<EncodedIdentities*>(bigidentities.get())) {
+          contents_[which] = content.get()->withidentities(
+            rawidentities->from_unionarray(tags_,
+                                           index_.to64(),
+                                           (int64_t)which,
+                                           content.get()->length()));
+        }
+        else if (Identities32* rawidentities =
+                 dynamic_cast<Identities32*>(bigidentities.get())) {
           bool uniquecontents;
           IdentitiesPtr subidentities =
             std::make_shared<Identities32>(Identities::newref(),
@@ -463,10 +472,11 @@ namespace awkward {
             (int64_t)which);
           util::handle_error(err, classname(), identities_.get());
           if (uniquecontents) {
-            content.get()->setidentities(subidentities);
+            contents_[which] = content.get()->withidentities(subidentities);
           }
           else {
-            content.get()->setidentities(Identities::none());
+            contents_[which] =
+              content.get()->withidentities(Identities::none());
           }
         }
         else if (Identities64* rawidentities =
@@ -494,10 +504,11 @@ namespace awkward {
             (int64_t)which);
           util::handle_error(err, classname(), identities_.get());
           if (uniquecontents) {
-            content.get()->setidentities(subidentities);
+            contents_[which] = content.get()->withidentities(subidentities);
           }
           else {
-            content.get()->setidentities(Identities::none());
+            contents_[which] =
+              content.get()->withidentities(Identities::none());
           }
         }
         else {
@@ -510,7 +521,7 @@ namespace awkward {
 
   template <typename T, typename I>
   const TypePtr
-  UnionArrayOf<T, I>::type(const util::TypeStrs& typestrs) const {
+  UnionArrayOf<T, I>::type_part(const util::TypeStrs& typestrs) const {
     std::vector<TypePtr> types;
     for (auto item : contents_) {
       types.push_back(item.get()->type(typestrs));
@@ -94,7 +94,7 @@ namespace awkward {
   void
   UnmaskedArray::setidentities(const IdentitiesPtr& identities) {
     if (identities.get() == nullptr) {
-      content_.get()->setidentities(identities);
+      content_ = content_.get()->withidentities(identities);
     }
     else {
       if (length() != identities.get()->length()) {
@@ -105,8 +105,13 @@ namespace awkward {
           classname(),
           identities_.get());
       }
-      if (Identities32* rawidentities =
-          dynamic_cast<Identities32*>(identities.get())) {
+      if (EncodedIdentities* rawidentities =
+          dynamic_cast<EncodedIdentities*>(identities.get())) {
+        content_ = content_.get()->withidentities(
+          rawidentities->extend(content_.get()->length()));
+      }
+      else if (Identities32* rawidentities =
+               dynamic_cast<Identities32*>(identities.get())) {
         std::shared_ptr<Identities32> subidentities =
           std::make_shared<Identities32>(Identities::newref(),
                                          rawidentities->fieldloc(),
@@ -121,7 +126,7 @@ namespace awkward {
           rawidentities->length(),
           content_.get()->length());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else if (Identities64* rawidentities =
                dynamic_cast<Identities64*>(identities.get())) {
@@ -139,7 +144,7 @@ namespace awkward {
           rawidentities->length(),
           content_.get()->length());
         util::handle_error(err, classname(), identities_.get());
-        content_.get()->setidentities(subidentities);
+        content_ = content_.get()->withidentities(subidentities);
       }
       else {
         throw std::runtime_error("unrecognized Identities specialization");
@@ -179,8 +184,7 @@ namespace awkward {
   }
 
   const TypePtr
-  UnmaskedArray::type(const std::map<std::string,
-                      std::string>& typestrs) const {
+  UnmaskedArray::type_part(const util::TypeStrs& typestrs) const {
     return std::make_shared<OptionType>(
       parameters_,
       util::gettypestr(parameters_, typestrs),
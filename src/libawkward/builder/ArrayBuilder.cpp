@@ -39,6 +39,16 @@ namespace awkward {
     return builder_.get()->snapshot();
   }
 
+  const ContentPtr
+  ArrayBuilder::finish(bool shrink) {
+    if (shrink) {
+      builder_.get()->shrink_to_fit();
+    }
+    ContentPtr out = builder_.get()->snapshot();
+    builder_.get()->clear();
+    return out;
+  }
+
   const ContentPtr
   ArrayBuilder::getitem_at(int64_t at) const {
     return snapshot().get()->getitem_at(at);
@@ -121,12 +131,7 @@ namespace awkward {
 
   void
   ArrayBuilder::endlist() {
-    BuilderPtr tmp = builder_.get()->endlist();
-    if (tmp.get() == nullptr) {
-      throw std::invalid_argument(
-        "endlist doesn't match a corresponding beginlist");
-    }
-    maybeupdate(tmp);
+    maybeupdate(builder_.get()->endlist());
   }
 
   void
@@ -206,16 +211,14 @@ namespace awkward {
 
   void
   ArrayBuilder::extend(const ContentPtr& array) {
-    BuilderPtr tmp = builder_;
     for (int64_t i = 0;  i < array.get()->length();  i++) {
-      tmp = builder_.get()->append(array, i);
+      maybeupdate(builder_.get()->append(array, i));
     }
-    maybeupdate(tmp);
   }
 
   void
   ArrayBuilder::maybeupdate(const BuilderPtr& tmp) {
-    if (tmp.get() != builder_.get()) {
+    if (tmp.get() != nullptr) {
       builder_ = tmp;
     }
   }
@@ -4,8 +4,14 @@
 
 namespace awkward {
   ArrayBuilderOptions::ArrayBuilderOptions(int64_t initial, double resize)
+      : ArrayBuilderOptions(initial, resize, false) { }
+
+  ArrayBuilderOptions::ArrayBuilderOptions(int64_t initial,
+                                           double resize,
+                                           bool reallocate)
       : initial_(initial)
-      , resize_(resize) { }
+      , resize_(resize)
+      , reallocate_(reallocate) { }
 
   int64_t
   ArrayBuilderOptions::initial() const {
@@ -16,4 +22,9 @@ namespace awkward {
   ArrayBuilderOptions::resize() const {
     return resize_;
   }
+
+  bool
+  ArrayBuilderOptions::reallocate() const {
+    return reallocate_;
+  }
 }
@@ -4,9 +4,4 @@
 
 namespace awkward {
   Builder::~Builder() { }
-
-  void
-  Builder::setthat(const BuilderPtr& that) {
-    that_ = that;
-  }
 }
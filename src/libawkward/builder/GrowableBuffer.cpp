@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include "awkward/Allocator.h"
 #include "awkward/builder/GrowableBuffer.h"
 
 namespace awkward {
@@ -18,7 +19,7 @@ namespace awkward {
     if (actual < (size_t)minreserve) {
       actual = (size_t)minreserve;
     }
-    std::shared_ptr<T> ptr(new T[actual], util::array_deleter<T>());
+    std::shared_ptr<T> ptr(allocate_array<T>(actual));
     return GrowableBuffer(options, ptr, 0, (int64_t)actual);
   }
 
@@ -43,8 +44,8 @@ namespace awkward {
     if (actual < (size_t)length) {
       actual = (size_t)length;
     }
-    T* rawptr = new T[(size_t)actual];
-    std::shared_ptr<T> ptr(rawptr, util::array_deleter<T>());
+    std::shared_ptr<T> ptr = allocate_array<T>((int64_t)actual);
+    T* rawptr = ptr.get();
     for (int64_t i = 0;  i < length;  i++) {
       rawptr[i] = (T)i;
     }
@@ -64,8 +65,7 @@ namespace awkward {
   template <typename T>
   GrowableBuffer<T>::GrowableBuffer(const ArrayBuilderOptions& options)
       : GrowableBuffer(options,
-                       std::shared_ptr<T>(new T[(size_t)options.initial()],
-                                          util::array_deleter<T>()),
+                       allocate_array<T>(options.initial()),
                        0,
                        options.initial()) { }
 
@@ -100,8 +100,17 @@ namespace awkward {
   void
   GrowableBuffer<T>::set_reserved(int64_t minreserved) {
     if (minreserved > reserved_) {
-      std::shared_ptr<T> ptr(new T[(size_t)minreserved],
-                             util::array_deleter<T>());
+      // In place, if the allocator can: snapshots sharing the buffer keep
+      // pointing to it, so its prefix is not copied.
+      if (grow_array(ptr_, minreserved)) {
+        reserved_ = minreserved;
+        return;
+      }
+      if (options_.reallocate()  &&  reallocate_array(ptr_, minreserved)) {
+        reserved_ = minreserved;
+        return;
+      }
+      std::shared_ptr<T> ptr(allocate_array<T>(minreserved));
       memcpy(ptr.get(), ptr_.get(), (size_t)(length_ * sizeof(T)));
       ptr_ = ptr;
       reserved_ = minreserved;
@@ -113,18 +122,31 @@ namespace awkward {
   GrowableBuffer<T>::clear() {
     length_ = 0;
     reserved_ = options_.initial();
-    ptr_ = std::shared_ptr<T>(new T[(size_t)options_.initial()],
-                              util::array_deleter<T>());
+    ptr_ = allocate_array<T>(options_.initial());
   }
 
   template <typename T>
   void
-  GrowableBuffer<T>::append(T datum) {
-    if (length_ == reserved_) {
-      set_reserved((int64_t)ceil(reserved_ * options_.resize()));
+  GrowableBuffer<T>::shrink_to_fit() {
+    // A zero reservation could never grow.
+    if (length_ > 0  &&
+        length_ < reserved_  &&
+        reallocate_array(ptr_, length_)) {
+      reserved_ = length_;
     }
-    ptr_.get()[length_] = datum;
-    length_++;
+  }
+
+  template <typename T>
+  void
+  GrowableBuffer<T>::extend(const T* data, int64_t length) {
+    int64_t needed = length_ + length;
+    if (needed > reserved_) {
+      // Geometric growth, but at least what is needed: with a resize of 1
+      // or less, multiplying alone would never get there.
+      set_reserved(std::max(needed, next_reserved()));
+    }
+    memcpy(ptr_.get() + length_, data, (size_t)length * sizeof(T));
+    length_ = needed;
   }
 
   template <typename T>
@@ -133,8 +155,15 @@ namespace awkward {
     return ptr_.get()[at];
   }
 
+  template class GrowableBuffer<bool>;
   template class GrowableBuffer<int8_t>;
   template class GrowableBuffer<uint8_t>;
+  template class GrowableBuffer<int16_t>;
+  template class GrowableBuffer<uint16_t>;
+  template class GrowableBuffer<int32_t>;
+  template class GrowableBuffer<uint32_t>;
   template class GrowableBuffer<int64_t>;
+  template class GrowableBuffer<uint64_t>;
+  template class GrowableBuffer<float>;
   template class GrowableBuffer<double>;
 }
@@ -39,6 +39,12 @@ namespace awkward {
     index_.clear();
   }
 
+  template <typename T>
+  void
+  IndexedBuilder<T>::shrink_to_fit() {
+    index_.shrink_to_fit();
+  }
+
   template <typename T>
   bool
   IndexedBuilder<T>::active() const {
@@ -50,13 +56,13 @@ namespace awkward {
   IndexedBuilder<T>::null() {
     index_.append(-1);
     hasnull_ = true;
-    return that_;
+    return nullptr;
   }
 
   template <typename T>
   const BuilderPtr
   IndexedBuilder<T>::boolean(bool x) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->boolean(x);
     return out;
   }
@@ -64,7 +70,7 @@ namespace awkward {
   template <typename T>
   const BuilderPtr
   IndexedBuilder<T>::integer(int64_t x) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->integer(x);
     return out;
   }
@@ -72,7 +78,7 @@ namespace awkward {
   template <typename T>
   const BuilderPtr
   IndexedBuilder<T>::real(double x) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->real(x);
     return out;
   }
@@ -82,7 +88,7 @@ namespace awkward {
   IndexedBuilder<T>::string(const char* x,
                             int64_t length,
                             const char* encoding) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->string(x, length, encoding);
     return out;
   }
@@ -90,7 +96,7 @@ namespace awkward {
   template <typename T>
   const BuilderPtr
   IndexedBuilder<T>::beginlist() {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->beginlist();
     return out;
   }
@@ -105,7 +111,7 @@ namespace awkward {
   template <typename T>
   const BuilderPtr
   IndexedBuilder<T>::begintuple(int64_t numfields) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->begintuple(numfields);
     return out;
   }
@@ -127,7 +133,7 @@ namespace awkward {
   template <typename T>
   const BuilderPtr
   IndexedBuilder<T>::beginrecord(const char* name, bool check) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->beginrecord(name, check);
     return out;
   }
@@ -204,7 +210,6 @@ namespace awkward {
         array,
         nullcount != 0);
     }
-    out.get()->setthat(out);
     return out;
   }
 
@@ -245,11 +250,11 @@ namespace awkward {
       index_.append(at);
     }
     else {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
-    return that_;
+    return nullptr;
   }
 
   ////////// IndexedI32Builder (makes IndexedArray32)
@@ -293,11 +298,11 @@ namespace awkward {
       index_.append((int64_t)array_.get()->index_at_nowrap(at));
     }
     else {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
-    return that_;
+    return nullptr;
   }
 
   ////////// IndexedIU32Builder (makes IndexedArrayU32)
@@ -341,11 +346,11 @@ namespace awkward {
       index_.append((int64_t)array_.get()->index_at_nowrap(at));
     }
     else {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
-    return that_;
+    return nullptr;
   }
 
   ////////// IndexedI64Builder (makes IndexedArray64)
@@ -389,11 +394,11 @@ namespace awkward {
       index_.append(array_.get()->index_at_nowrap(at));
     }
     else {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
-    return that_;
+    return nullptr;
   }
 
   ////////// IndexedIO32Builder (makes IndexedOptionArray32)
@@ -431,11 +436,11 @@ namespace awkward {
       index_.append((int64_t)array_.get()->index_at_nowrap(at));
     }
     else {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
-    return that_;
+    return nullptr;
   }
 
   ////////// IndexedIO64Builder (makes IndexedOptionArray64)
@@ -472,11 +477,11 @@ namespace awkward {
       index_.append(array_.get()->index_at_nowrap(at));
     }
     else {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
-    return that_;
+    return nullptr;
   }
 
 }
@@ -15,7 +15,6 @@ namespace awkward {
     BuilderPtr out =
       std::make_shared<Int64Builder>(options,
                                      GrowableBuffer<int64_t>::empty(options));
-    out.get()->setthat(out);
     return out;
   }
  
@@ -44,6 +43,11 @@ namespace awkward {
     buffer_.clear();
   }
 
+  void
+  Int64Builder::shrink_to_fit() {
+    buffer_.shrink_to_fit();
+  }
+
   const ContentPtr
   Int64Builder::snapshot() const {
     std::vector<ssize_t> shape = { (ssize_t)buffer_.length() };
@@ -76,14 +80,14 @@ namespace awkward {
 
   const BuilderPtr
   Int64Builder::null() {
-    BuilderPtr out = OptionBuilder::fromvalids(options_, that_);
+    BuilderPtr out = OptionBuilder::fromvalids(options_, shared_from_this());
     out.get()->null();
     return out;
   }
 
   const BuilderPtr
   Int64Builder::boolean(bool x) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->boolean(x);
     return out;
   }
@@ -91,7 +95,7 @@ namespace awkward {
   const BuilderPtr
   Int64Builder::integer(int64_t x) {
     buffer_.append(x);
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -103,14 +107,14 @@ namespace awkward {
 
   const BuilderPtr
   Int64Builder::string(const char* x, int64_t length, const char* encoding) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->string(x, length, encoding);
     return out;
   }
 
   const BuilderPtr
   Int64Builder::beginlist() {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->beginlist();
     return out;
   }
@@ -123,7 +127,7 @@ namespace awkward {
 
   const BuilderPtr
   Int64Builder::begintuple(int64_t numfields) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->begintuple(numfields);
     return out;
   }
@@ -142,7 +146,7 @@ namespace awkward {
 
   const BuilderPtr
   Int64Builder::beginrecord(const char* name, bool check) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->beginrecord(name, check);
     return out;
   }
@@ -161,7 +165,7 @@ namespace awkward {
 
   const BuilderPtr
   Int64Builder::append(const ContentPtr& array, int64_t at) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->append(array, at);
     return out;
   }
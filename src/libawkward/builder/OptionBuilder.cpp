@@ -20,7 +20,6 @@ namespace awkward {
     BuilderPtr out = std::make_shared<OptionBuilder>(options,
                                                      offsets,
                                                      content);
-    out.get()->setthat(out);
     return out;
   }
 
@@ -32,7 +31,6 @@ namespace awkward {
     BuilderPtr out = std::make_shared<OptionBuilder>(options,
                                                      offsets,
                                                      content);
-    out.get()->setthat(out);
     return out;
   }
  
@@ -59,6 +57,12 @@ namespace awkward {
     content_.get()->clear();
   }
 
+  void
+  OptionBuilder::shrink_to_fit() {
+    offsets_.shrink_to_fit();
+    content_.get()->shrink_to_fit();
+  }
+
   const ContentPtr
   OptionBuilder::snapshot() const {
     Index64 index(offsets_.ptr(), 0, offsets_.length());
@@ -81,7 +85,7 @@ namespace awkward {
     else {
       content_.get()->null();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -94,7 +98,7 @@ namespace awkward {
     else {
       content_.get()->boolean(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -107,7 +111,7 @@ namespace awkward {
     else {
       content_.get()->integer(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -120,7 +124,7 @@ namespace awkward {
     else {
       content_.get()->real(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -133,7 +137,7 @@ namespace awkward {
     else {
       content_.get()->string(x, length, encoding);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -144,7 +148,7 @@ namespace awkward {
     else {
       content_.get()->beginlist();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -160,7 +164,7 @@ namespace awkward {
         offsets_.append(length);
       }
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -171,7 +175,7 @@ namespace awkward {
     else {
       content_.get()->begintuple(numfields);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -183,7 +187,7 @@ namespace awkward {
     else {
       content_.get()->index(index);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -199,7 +203,7 @@ namespace awkward {
         offsets_.append(length);
       }
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -210,7 +214,7 @@ namespace awkward {
     else {
       content_.get()->beginrecord(name, check);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -222,7 +226,7 @@ namespace awkward {
     else {
       content_.get()->field(key, check);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -239,7 +243,7 @@ namespace awkward {
         offsets_.append(length);
       }
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -252,12 +256,12 @@ namespace awkward {
     else {
       content_.get()->append(array, at);
     }
-    return that_;
+    return nullptr;
   }
 
   void
   OptionBuilder::maybeupdate(const BuilderPtr& tmp) {
-    if (tmp.get() != content_.get()) {
+    if (tmp.get() != nullptr) {
       content_ = tmp;
     }
   }
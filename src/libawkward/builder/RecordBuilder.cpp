@@ -30,7 +30,6 @@ namespace awkward {
                                       false,
                                       -1,
                                       -1);
-    out.get()->setthat(out);
     return out;
   }
 
@@ -77,9 +76,7 @@ namespace awkward {
 
   void
   RecordBuilder::clear() {
-    for (auto x : contents_) {
-      x.get()->clear();
-    }
+    contents_.clear();
     keys_.clear();
     pointers_.clear();
     name_ = "";
@@ -90,6 +87,13 @@ namespace awkward {
     nexttotry_ = 0;
   }
 
+  void
+  RecordBuilder::shrink_to_fit() {
+    for (auto x : contents_) {
+      x.get()->shrink_to_fit();
+    }
+  }
+
   const ContentPtr
   RecordBuilder::snapshot() const {
     if (length_ == -1) {
@@ -122,7 +126,7 @@ namespace awkward {
   const BuilderPtr
   RecordBuilder::null() {
     if (!begun_) {
-      BuilderPtr out = OptionBuilder::fromvalids(options_, that_);
+      BuilderPtr out = OptionBuilder::fromvalids(options_, shared_from_this());
       out.get()->null();
       return out;
     }
@@ -137,13 +141,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->null();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   RecordBuilder::boolean(bool x) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->boolean(x);
       return out;
     }
@@ -158,13 +162,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->boolean(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   RecordBuilder::integer(int64_t x) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->integer(x);
       return out;
     }
@@ -179,13 +183,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->integer(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   RecordBuilder::real(double x) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->real(x);
       return out;
     }
@@ -200,13 +204,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->real(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   RecordBuilder::string(const char* x, int64_t length, const char* encoding) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->string(x, length, encoding);
       return out;
     }
@@ -224,13 +228,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->string(x, length, encoding);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   RecordBuilder::beginlist() {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->beginlist();
       return out;
     }
@@ -246,7 +250,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->beginlist();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -263,13 +267,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->endlist();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   RecordBuilder::begintuple(int64_t numfields) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->begintuple(numfields);
       return out;
     }
@@ -285,7 +289,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->begintuple(numfields);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -303,7 +307,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->index(index);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -321,7 +325,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->endtuple();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -344,7 +348,7 @@ namespace awkward {
       nexttotry_ = 0;
     }
     else if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->beginrecord(name, check);
       return out;
     }
@@ -361,7 +365,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->beginrecord(name, check);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -394,7 +398,7 @@ namespace awkward {
         if (pointers_[(size_t)i] == key) {
           nextindex_ = i;
           nexttotry_ = i + 1;
-          return that_;
+          return nullptr;
         }
         i++;
       } while (i != nexttotry_);
@@ -411,11 +415,11 @@ namespace awkward {
       }
       keys_.push_back(std::string(key));
       pointers_.push_back(key);
-      return that_;
+      return nullptr;
     }
     else {
       contents_[(size_t)nextindex_].get()->field(key, false);
-      return that_;
+      return nullptr;
     }
   }
 
@@ -439,7 +443,7 @@ namespace awkward {
         if (keys_[(size_t)i].compare(key) == 0) {
           nextindex_ = i;
           nexttotry_ = i + 1;
-          return that_;
+          return nullptr;
         }
         i++;
       } while (i != nexttotry_);
@@ -456,11 +460,11 @@ namespace awkward {
       }
       keys_.push_back(std::string(key));
       pointers_.push_back(nullptr);
-      return that_;
+      return nullptr;
     }
     else {
       contents_[(size_t)nextindex_].get()->field(key, true);
-      return that_;
+      return nullptr;
     }
   }
 
@@ -489,13 +493,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->endrecord();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   RecordBuilder::append(const ContentPtr& array, int64_t at) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
@@ -511,12 +515,12 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->append(array, at);
     }
-    return that_;
+    return nullptr;
   }
 
   void
   RecordBuilder::maybeupdate(int64_t i, const BuilderPtr& tmp) {
-    if (tmp.get() != contents_[(size_t)i].get()) {
+    if (tmp.get() != nullptr) {
       contents_[(size_t)i] = tmp;
     }
   }
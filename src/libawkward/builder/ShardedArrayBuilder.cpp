@@ -0,0 +1,120 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+
+#include "awkward/Identities.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/UnionArray.h"
+
+#include "awkward/builder/ShardedArrayBuilder.h"
+
+namespace awkward {
+  ShardedArrayBuilder::ShardedArrayBuilder(const ArrayBuilderOptions& options,
+                                           int64_t numshards) {
+    if (numshards < 1) {
+      throw std::invalid_argument(
+        std::string("ShardedArrayBuilder needs at least one shard, not ")
+        + std::to_string(numshards));
+    }
+    for (int64_t i = 0;  i < numshards;  i++) {
+      shards_.push_back(std::unique_ptr<ArrayBuilder>(
+        new ArrayBuilder(options)));
+    }
+  }
+
+  int64_t
+  ShardedArrayBuilder::numshards() const {
+    return (int64_t)shards_.size();
+  }
+
+  ArrayBuilder&
+  ShardedArrayBuilder::shard(int64_t i) {
+    if (!(0 <= i  &&  i < numshards())) {
+      throw std::invalid_argument(
+        std::string("shard ") + std::to_string(i)
+        + std::string(" out of range for ") + std::to_string(numshards())
+        + std::string(" shards"));
+    }
+    return *shards_[(size_t)i].get();
+  }
+
+  int64_t
+  ShardedArrayBuilder::length() const {
+    int64_t out = 0;
+    for (auto& x : shards_) {
+      out += x.get()->length();
+    }
+    return out;
+  }
+
+  void
+  ShardedArrayBuilder::clear() {
+    for (auto& x : shards_) {
+      x.get()->clear();
+    }
+  }
+
+  const ContentPtr
+  ShardedArrayBuilder::snapshot() const {
+    ContentPtrVec arrays;
+    for (auto& x : shards_) {
+      arrays.push_back(x.get()->snapshot());
+    }
+    return merge(arrays);
+  }
+
+  const ContentPtr
+  ShardedArrayBuilder::finish() {
+    ContentPtrVec arrays;
+    for (auto& x : shards_) {
+      arrays.push_back(x.get()->finish(true));
+    }
+    return merge(arrays);
+  }
+
+  namespace {
+    const ContentPtr
+    merge_two_shards(const ContentPtr& left, const ContentPtr& right) {
+      ContentPtr out;
+      if (left.get()->mergeable(right, true)) {
+        out = left.get()->merge(right);
+      }
+      else {
+        out = left.get()->merge_as_union(right);
+      }
+      if (UnionArray8_64* raw = dynamic_cast<UnionArray8_64*>(out.get())) {
+        out = raw->simplify_uniontype(true);
+      }
+      return out;
+    }
+  }
+
+  const ContentPtr
+  ShardedArrayBuilder::merge(const ContentPtrVec& arrays) {
+    // Shards that were never filled (EmptyArrays) have no type to unify.
+    ContentPtrVec level;
+    for (auto x : arrays) {
+      if (x.get()->length() != 0) {
+        level.push_back(x);
+      }
+    }
+    if (level.empty()) {
+      if (arrays.empty()) {
+        return std::make_shared<EmptyArray>(Identities::none(),
+                                            util::Parameters());
+      }
+      return arrays[0];
+    }
+    while (level.size() > 1) {
+      ContentPtrVec next;
+      for (size_t i = 0;  i + 1 < level.size();  i += 2) {
+        next.push_back(merge_two_shards(level[i], level[i + 1]));
+      }
+      if (level.size() % 2 == 1) {
+        next.push_back(level.back());
+      }
+      level = next;
+    }
+    return level[0];
+  }
+}
@@ -21,7 +21,6 @@ namespace awkward {
                                                      offsets,
                                                      content,
                                                      encoding);
-    out.get()->setthat(out);
     return out;
   }
 
@@ -56,6 +55,12 @@ namespace awkward {
     content_.clear();
   }
 
+  void
+  StringBuilder::shrink_to_fit() {
+    offsets_.shrink_to_fit();
+    content_.shrink_to_fit();
+  }
+
   const ContentPtr
   StringBuilder::snapshot() const {
     util::Parameters char_parameters;
@@ -99,28 +104,28 @@ namespace awkward {
 
   const BuilderPtr
   StringBuilder::null() {
-    BuilderPtr out = OptionBuilder::fromvalids(options_, that_);
+    BuilderPtr out = OptionBuilder::fromvalids(options_, shared_from_this());
     out.get()->null();
     return out;
   }
 
   const BuilderPtr
   StringBuilder::boolean(bool x) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->boolean(x);
     return out;
   }
 
   const BuilderPtr
   StringBuilder::integer(int64_t x) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->integer(x);
     return out;
   }
 
   const BuilderPtr
   StringBuilder::real(double x) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->real(x);
     return out;
   }
@@ -138,12 +143,12 @@ namespace awkward {
       }
     }
     offsets_.append(content_.length());
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   StringBuilder::beginlist() {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->beginlist();
     return out;
   }
@@ -156,7 +161,7 @@ namespace awkward {
 
   const BuilderPtr
   StringBuilder::begintuple(int64_t numfields) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->begintuple(numfields);
     return out;
   }
@@ -175,7 +180,7 @@ namespace awkward {
 
   const BuilderPtr
   StringBuilder::beginrecord(const char* name, bool check) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->beginrecord(name, check);
     return out;
   }
@@ -194,7 +199,7 @@ namespace awkward {
 
   const BuilderPtr
   StringBuilder::append(const ContentPtr& array, int64_t at) {
-    BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+    BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
     out.get()->append(array, at);
     return out;
   }
@@ -21,7 +21,6 @@ namespace awkward {
                                                     -1,
                                                     false,
                                                     -1);
-    out.get()->setthat(out);
     return out;
   }
 
@@ -61,6 +60,13 @@ namespace awkward {
     nextindex_ = -1;
   }
 
+  void
+  TupleBuilder::shrink_to_fit() {
+    for (auto x : contents_) {
+      x.get()->shrink_to_fit();
+    }
+  }
+
   const ContentPtr
   TupleBuilder::snapshot() const {
     if (length_ == -1) {
@@ -86,7 +92,7 @@ namespace awkward {
   const BuilderPtr
   TupleBuilder::null() {
     if (!begun_) {
-      BuilderPtr out = OptionBuilder::fromvalids(options_, that_);
+      BuilderPtr out = OptionBuilder::fromvalids(options_, shared_from_this());
       out.get()->null();
       return out;
     }
@@ -101,13 +107,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->null();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   TupleBuilder::boolean(bool x) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->boolean(x);
       return out;
     }
@@ -122,13 +128,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->boolean(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   TupleBuilder::integer(int64_t x) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->integer(x);
       return out;
     }
@@ -143,13 +149,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->integer(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   TupleBuilder::real(double x) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->real(x);
       return out;
     }
@@ -164,13 +170,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->real(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   TupleBuilder::string(const char* x, int64_t length, const char* encoding) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->string(x, length, encoding);
       return out;
     }
@@ -188,13 +194,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->string(x, length, encoding);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   TupleBuilder::beginlist() {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->beginlist();
       return out;
     }
@@ -210,7 +216,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->beginlist();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -227,7 +233,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->endlist();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -244,7 +250,7 @@ namespace awkward {
       nextindex_ = -1;
     }
     else if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->begintuple(numfields);
       return out;
     }
@@ -260,7 +266,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->begintuple(numfields);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -276,7 +282,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->index(index);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -303,13 +309,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->endtuple();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   TupleBuilder::beginrecord(const char* name, bool check) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->beginrecord(name, check);
       return out;
     }
@@ -326,7 +332,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->beginrecord(name, check);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -343,7 +349,7 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->field(key, check);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -360,13 +366,13 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->endrecord();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
   TupleBuilder::append(const ContentPtr& array, int64_t at) {
     if (!begun_) {
-      BuilderPtr out = UnionBuilder::fromsingle(options_, that_);
+      BuilderPtr out = UnionBuilder::fromsingle(options_, shared_from_this());
       out.get()->append(array, at);
       return out;
     }
@@ -382,12 +388,12 @@ namespace awkward {
     else {
       contents_[(size_t)nextindex_].get()->append(array, at);
     }
-    return that_;
+    return nullptr;
   }
 
   void
   TupleBuilder::maybeupdate(int64_t i, const BuilderPtr& tmp) {
-    if (tmp.get() != contents_[(size_t)i].get()) {
+    if (tmp.get() != nullptr) {
       contents_[(size_t)i] = tmp;
     }
   }
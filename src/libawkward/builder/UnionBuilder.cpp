@@ -31,7 +31,6 @@ namespace awkward {
                                                     types,
                                                     offsets,
                                                     contents);
-    out.get()->setthat(out);
     return out;
   }
 
@@ -64,6 +63,15 @@ namespace awkward {
     }
   }
 
+  void
+  UnionBuilder::shrink_to_fit() {
+    types_.shrink_to_fit();
+    offsets_.shrink_to_fit();
+    for (auto x : contents_) {
+      x.get()->shrink_to_fit();
+    }
+  }
+
   const ContentPtr
   UnionBuilder::snapshot() const {
     Index8 tags(types_.ptr(), 0, types_.length());
@@ -87,13 +95,13 @@ namespace awkward {
   const BuilderPtr
   UnionBuilder::null() {
     if (current_ == -1) {
-      BuilderPtr out = OptionBuilder::fromvalids(options_, that_);
+      BuilderPtr out = OptionBuilder::fromvalids(options_, shared_from_this());
       out.get()->null();
       return out;
     }
     else {
       contents_[(size_t)current_].get()->null();
-      return that_;
+      return nullptr;
     }
   }
 
@@ -121,7 +129,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->boolean(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -148,7 +156,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->integer(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -191,7 +199,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->real(x);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -220,7 +228,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->string(x, length, encoding);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -245,7 +253,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->beginlist();
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -263,7 +271,7 @@ namespace awkward {
         current_ = -1;
       }
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -290,7 +298,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->begintuple(numfields);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -302,7 +310,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->index(index);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -320,7 +328,7 @@ namespace awkward {
         current_ = -1;
       }
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -349,7 +357,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->beginrecord(name, check);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -361,7 +369,7 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->field(key, check);
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -380,7 +388,7 @@ namespace awkward {
         current_ = -1;
       }
     }
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -445,6 +453,6 @@ namespace awkward {
     else {
       contents_[(size_t)current_].get()->append(array, at);
     }
-    return that_;
+    return nullptr;
   }
 }
@@ -23,7 +23,6 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::fromempty(const ArrayBuilderOptions& options) {
     BuilderPtr out = std::make_shared<UnknownBuilder>(options, 0);
-    out.get()->setthat(out);
     return out;
   }
 
@@ -47,6 +46,9 @@ namespace awkward {
     nullcount_ = 0;
   }
 
+  void
+  UnknownBuilder::shrink_to_fit() { }
+
   const ContentPtr
   UnknownBuilder::snapshot() const {
     if (nullcount_ == 0) {
@@ -77,7 +79,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::null() {
     nullcount_++;
-    return that_;
+    return nullptr;
   }
 
   const BuilderPtr
@@ -0,0 +1,827 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#ifndef _MSC_VER
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "awkward/Allocator.h"
+#include "awkward/Index.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/BitMaskedArray.h"
+#include "awkward/array/UnmaskedArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/UnionArray.h"
+
+#include "awkward/io/binary.h"
+
+namespace awkward {
+  namespace {
+    // File layout: a fixed preamble, the node tree, a table of (offset,
+    // nbytes) for every buffer, and then the buffers themselves.
+    const char kBinaryMagic[8] = {'a', 'w', 'k', 'w', 'a', 'r', 'd', '1'};
+    const uint32_t kBinaryVersion = 1;
+    const uint32_t kBinaryByteOrder = 0x01020304;
+
+    enum class BinaryNode: uint8_t {
+      empty = 0,
+      numpy = 1,
+      regular = 2,
+      list = 3,
+      listoffset = 4,
+      indexed = 5,
+      indexedoption = 6,
+      bytemasked = 7,
+      bitmasked = 8,
+      unmasked = 9,
+      record = 10,
+      union_ = 11
+    };
+
+    enum class BinaryIndex: uint8_t {
+      i8 = 0,
+      u8 = 1,
+      i32 = 2,
+      u32 = 3,
+      i64 = 4
+    };
+
+    // Deeper files are rejected rather than overflow the stack in node().
+    const int64_t kBinaryMaxDepth = 1000;
+
+    template <typename T>
+    BinaryIndex binary_index_type();
+    template <>
+    BinaryIndex binary_index_type<int8_t>() { return BinaryIndex::i8; }
+    template <>
+    BinaryIndex binary_index_type<uint8_t>() { return BinaryIndex::u8; }
+    template <>
+    BinaryIndex binary_index_type<int32_t>() { return BinaryIndex::i32; }
+    template <>
+    BinaryIndex binary_index_type<uint32_t>() { return BinaryIndex::u32; }
+    template <>
+    BinaryIndex binary_index_type<int64_t>() { return BinaryIndex::i64; }
+  }
+
+  ////////// writing
+
+  namespace {
+    class BinaryWriter {
+    public:
+      template <typename T>
+      void
+        scalar(T x) {
+        header_.append(reinterpret_cast<const char*>(&x), sizeof(T));
+      }
+
+      void
+        string(const std::string& x) {
+        scalar<uint64_t>((uint64_t)x.length());
+        header_.append(x);
+      }
+
+      void
+        parameters(const util::Parameters& parameters) {
+        scalar<uint64_t>((uint64_t)parameters.size());
+        for (auto pair : parameters) {
+          string(pair.first);
+          string(pair.second);
+        }
+      }
+
+      void
+        buffer(const std::shared_ptr<void>& keepalive,
+               const void* ptr,
+               int64_t nbytes) {
+        scalar<uint64_t>((uint64_t)buffers_.size());
+        buffers_.push_back(Buffer({ keepalive, ptr, nbytes }));
+      }
+
+      template <typename T>
+      void
+        index(const IndexOf<T>& index) {
+        scalar<uint8_t>((uint8_t)binary_index_type<T>());
+        scalar<int64_t>(index.length());
+        buffer(index.ptr(),
+               index.ptr().get() + index.offset(),
+               index.length() * (int64_t)sizeof(T));
+      }
+
+      void
+        node(const ContentPtr& layout);
+
+      void
+        write(FILE* file) const;
+
+    private:
+      struct Buffer {
+        std::shared_ptr<void> keepalive;
+        const void* ptr;
+        int64_t nbytes;
+      };
+
+      std::string header_;
+      std::vector<Buffer> buffers_;
+    };
+
+    template <typename T>
+    bool
+    binary_write_list(BinaryWriter& writer, const ContentPtr& layout) {
+      if (ListArrayOf<T>* raw =
+          dynamic_cast<ListArrayOf<T>*>(layout.get())) {
+        writer.scalar<uint8_t>((uint8_t)BinaryNode::list);
+        writer.parameters(raw->parameters());
+        writer.index<T>(raw->starts());
+        writer.index<T>(raw->stops());
+        writer.node(raw->content());
+        return true;
+      }
+      else if (ListOffsetArrayOf<T>* raw =
+               dynamic_cast<ListOffsetArrayOf<T>*>(layout.get())) {
+        writer.scalar<uint8_t>((uint8_t)BinaryNode::listoffset);
+        writer.parameters(raw->parameters());
+        writer.index<T>(raw->offsets());
+        writer.node(raw->content());
+        return true;
+      }
+      else if (IndexedArrayOf<T, false>* raw =
+               dynamic_cast<IndexedArrayOf<T, false>*>(layout.get())) {
+        writer.scalar<uint8_t>((uint8_t)BinaryNode::indexed);
+        writer.parameters(raw->parameters());
+        writer.index<T>(raw->index());
+        writer.node(raw->content());
+        return true;
+      }
+      else if (UnionArrayOf<int8_t, T>* raw =
+               dynamic_cast<UnionArrayOf<int8_t, T>*>(layout.get())) {
+        writer.scalar<uint8_t>((uint8_t)BinaryNode::union_);
+        writer.parameters(raw->parameters());
+        writer.index<int8_t>(raw->tags());
+        writer.index<T>(raw->index());
+        writer.scalar<int64_t>(raw->numcontents());
+        for (auto content : raw->contents()) {
+          writer.node(content);
+        }
+        return true;
+      }
+      return false;
+    }
+
+    template <typename T>
+    bool
+    binary_write_option(BinaryWriter& writer, const ContentPtr& layout) {
+      if (IndexedArrayOf<T, true>* raw =
+          dynamic_cast<IndexedArrayOf<T, true>*>(layout.get())) {
+        writer.scalar<uint8_t>((uint8_t)BinaryNode::indexedoption);
+        writer.parameters(raw->parameters());
+        writer.index<T>(raw->index());
+        writer.node(raw->content());
+        return true;
+      }
+      return false;
+    }
+
+    void
+    BinaryWriter::node(const ContentPtr& layout) {
+      if (EmptyArray* raw = dynamic_cast<EmptyArray*>(layout.get())) {
+        scalar<uint8_t>((uint8_t)BinaryNode::empty);
+        parameters(raw->parameters());
+      }
+      else if (NumpyArray* raw = dynamic_cast<NumpyArray*>(layout.get())) {
+        NumpyArray contiguous = raw->contiguous();
+        scalar<uint8_t>((uint8_t)BinaryNode::numpy);
+        parameters(raw->parameters());
+        string(contiguous.format());
+        scalar<int64_t>((int64_t)contiguous.itemsize());
+        scalar<int64_t>((int64_t)contiguous.ndim());
+        for (auto x : contiguous.shape()) {
+          scalar<int64_t>((int64_t)x);
+        }
+        buffer(contiguous.ptr(),
+               contiguous.byteptr(),
+               (int64_t)contiguous.bytelength());
+      }
+      else if (RegularArray* raw = dynamic_cast<RegularArray*>(layout.get())) {
+        scalar<uint8_t>((uint8_t)BinaryNode::regular);
+        parameters(raw->parameters());
+        scalar<int64_t>(raw->size());
+        node(raw->content());
+      }
+      else if (ByteMaskedArray* raw =
+               dynamic_cast<ByteMaskedArray*>(layout.get())) {
+        scalar<uint8_t>((uint8_t)BinaryNode::bytemasked);
+        parameters(raw->parameters());
+        index<int8_t>(raw->mask());
+        scalar<uint8_t>((uint8_t)raw->validwhen());
+        node(raw->content());
+      }
+      else if (BitMaskedArray* raw =
+               dynamic_cast<BitMaskedArray*>(layout.get())) {
+        scalar<uint8_t>((uint8_t)BinaryNode::bitmasked);
+        parameters(raw->parameters());
+        index<uint8_t>(raw->mask());
+        scalar<uint8_t>((uint8_t)raw->validwhen());
+        scalar<int64_t>(raw->length());
+        scalar<uint8_t>((uint8_t)raw->lsb_order());
+        node(raw->content());
+      }
+      else if (UnmaskedArray* raw =
+               dynamic_cast<UnmaskedArray*>(layout.get())) {
+        scalar<uint8_t>((uint8_t)BinaryNode::unmasked);
+        parameters(raw->parameters());
+        node(raw->content());
+      }
+      else if (RecordArray* raw = dynamic_cast<RecordArray*>(layout.get())) {
+        scalar<uint8_t>((uint8_t)BinaryNode::record);
+        parameters(raw->parameters());
+        scalar<int64_t>(raw->length());
+        scalar<int64_t>(raw->numfields());
+        scalar<uint8_t>((uint8_t)raw->istuple());
+        if (!raw->istuple()) {
+          for (auto key : *raw->recordlookup().get()) {
+            string(key);
+          }
+        }
+        for (auto content : raw->contents()) {
+          node(content);
+        }
+      }
+      else if (binary_write_list<int32_t>(*this, layout)  ||
+               binary_write_list<uint32_t>(*this, layout)  ||
+               binary_write_list<int64_t>(*this, layout)  ||
+               binary_write_option<int32_t>(*this, layout)  ||
+               binary_write_option<int64_t>(*this, layout)) { }
+      else {
+        throw std::invalid_argument(
+          std::string("cannot write ") + layout.get()->classname()
+          + std::string(" to the binary format"));
+      }
+    }
+
+    int64_t
+    binary_aligned(int64_t position) {
+      return ((position + kBinaryAlignment - 1) / kBinaryAlignment)
+             * kBinaryAlignment;
+    }
+
+    void
+    binary_fwrite(FILE* file, const void* ptr, size_t nbytes) {
+      if (nbytes != 0  &&  fwrite(ptr, 1, nbytes, file) != nbytes) {
+        throw std::runtime_error("could not write to binary file");
+      }
+    }
+
+    void
+    BinaryWriter::write(FILE* file) const {
+      uint64_t headerlength = (uint64_t)header_.length();
+      uint64_t numbuffers = (uint64_t)buffers_.size();
+      int64_t position = (int64_t)(sizeof(kBinaryMagic)
+                                   + 2*sizeof(uint32_t)
+                                   + 2*sizeof(uint64_t)
+                                   + header_.length()
+                                   + 2*sizeof(uint64_t)*buffers_.size());
+      std::vector<uint64_t> table;
+      for (auto buffer : buffers_) {
+        position = binary_aligned(position);
+        table.push_back((uint64_t)position);
+        table.push_back((uint64_t)buffer.nbytes);
+        position += buffer.nbytes;
+      }
+
+      binary_fwrite(file, kBinaryMagic, sizeof(kBinaryMagic));
+      binary_fwrite(file, &kBinaryVersion, sizeof(uint32_t));
+      binary_fwrite(file, &kBinaryByteOrder, sizeof(uint32_t));
+      binary_fwrite(file, &headerlength, sizeof(uint64_t));
+      binary_fwrite(file, &numbuffers, sizeof(uint64_t));
+      binary_fwrite(file, header_.data(), header_.length());
+      binary_fwrite(file, table.data(), sizeof(uint64_t)*table.size());
+
+      position = (int64_t)(sizeof(kBinaryMagic)
+                           + 2*sizeof(uint32_t)
+                           + 2*sizeof(uint64_t)
+                           + header_.length()
+                           + 2*sizeof(uint64_t)*buffers_.size());
+      const char zeros[kBinaryAlignment] = { };
+      for (size_t i = 0;  i < buffers_.size();  i++) {
+        int64_t start = (int64_t)table[2*i];
+        binary_fwrite(file, zeros, (size_t)(start - position));
+        binary_fwrite(file, buffers_[i].ptr, (size_t)buffers_[i].nbytes);
+        position = start + buffers_[i].nbytes;
+      }
+    }
+  }
+
+  void
+  ToBinaryFile(const ContentPtr& layout, const std::string& path) {
+    BinaryWriter writer;
+    writer.node(layout);
+#ifdef _MSC_VER
+    FILE* file;
+    if (fopen_s(&file, path.c_str(), "wb") != 0) {
+#else
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+#endif
+      throw std::invalid_argument(
+        std::string("file \"") + path
+        + std::string("\" could not be opened for writing"));
+    }
+    try {
+      writer.write(file);
+    }
+    catch (...) {
+      fclose(file);
+      throw;
+    }
+    if (fclose(file) != 0) {
+      throw std::runtime_error(
+        std::string("file \"") + path
+        + std::string("\" could not be closed after writing"));
+    }
+  }
+
+  ////////// reading
+
+  namespace {
+    // The itemsize of a NumpyArray format that awkward interprets, or 0 for
+    // any other format, whose items are only copied.
+    int64_t
+    binary_format_itemsize(const std::string& format) {
+      if (format == "?"  ||  format == "b"  ||  format == "B"  ||
+          format == "c") {
+        return 1;
+      }
+      else if (format == "h"  ||  format == "H") {
+        return 2;
+      }
+      else if (format == "i"  ||  format == "I"  ||  format == "f") {
+        return 4;
+      }
+      else if (format == "l"  ||  format == "L") {
+        return (int64_t)sizeof(long);
+      }
+      else if (format == "q"  ||  format == "Q"  ||  format == "d") {
+        return 8;
+      }
+      return 0;
+    }
+
+    class BinaryReader {
+    public:
+      BinaryReader(const std::shared_ptr<uint8_t>& data, int64_t length)
+          : data_(data)
+          , length_(length)
+          , position_(0)
+          , depth_(0) { }
+
+      template <typename T>
+      T
+        scalar() {
+        check(position_, (int64_t)sizeof(T));
+        T out;
+        std::memcpy(&out, data_.get() + position_, sizeof(T));
+        position_ += (int64_t)sizeof(T);
+        return out;
+      }
+
+      const std::string
+        string() {
+        int64_t length = (int64_t)scalar<uint64_t>();
+        check(position_, length);
+        std::string out(reinterpret_cast<const char*>(data_.get() + position_),
+                        (size_t)length);
+        position_ += length;
+        return out;
+      }
+
+      const util::Parameters
+        parameters() {
+        util::Parameters out;
+        uint64_t size = scalar<uint64_t>();
+        for (uint64_t i = 0;  i < size;  i++) {
+          std::string key = string();
+          out[key] = string();
+        }
+        return out;
+      }
+
+      // Returns a pointer into the data for buffer number id, which must have
+      // at least nbytes.
+      template <typename T>
+      const std::shared_ptr<T>
+        buffer(int64_t nbytes) {
+        uint64_t id = scalar<uint64_t>();
+        if (id >= (uint64_t)offsets_.size()) {
+          throw std::invalid_argument("binary file refers to a missing buffer");
+        }
+        if (nbytes > sizes_[(size_t)id]) {
+          throw std::invalid_argument("binary file has a buffer that is too "
+                                      "short for its array");
+        }
+        int64_t offset = offsets_[(size_t)id];
+        return std::shared_ptr<T>(
+          data_, reinterpret_cast<T*>(data_.get() + offset));
+      }
+
+      template <typename T>
+      const IndexOf<T>
+        index() {
+        if (scalar<uint8_t>() != (uint8_t)binary_index_type<T>()) {
+          throw std::invalid_argument("binary file has an Index of the "
+                                      "wrong type");
+        }
+        int64_t length = scalar<int64_t>();
+        if (length < 0) {
+          throw std::invalid_argument("binary file has a negative length");
+        }
+        if (length > kMaxInt64 / (int64_t)sizeof(T)) {
+          throw std::invalid_argument("binary file has an Index that is too "
+                                      "large");
+        }
+        std::shared_ptr<T> ptr = buffer<T>(length * (int64_t)sizeof(T));
+        return IndexOf<T>(ptr, 0, length);
+      }
+
+      void
+        preamble();
+
+      const ContentPtr
+        node();
+
+    private:
+      const ContentPtr
+        node_part();
+
+      void
+        check(int64_t start, int64_t nbytes) const {
+        if (start < 0  ||  start > length_  ||
+            nbytes < 0  ||  nbytes > length_ - start) {
+          throw std::invalid_argument("binary file is truncated or corrupted");
+        }
+      }
+
+      template <typename T>
+      const ContentPtr
+        list(BinaryNode kind, const util::Parameters& parameters);
+
+      const std::shared_ptr<uint8_t> data_;
+      const int64_t length_;
+      int64_t position_;
+      int64_t depth_;
+      std::vector<int64_t> offsets_;
+      std::vector<int64_t> sizes_;
+    };
+
+    void
+    BinaryReader::preamble() {
+      check(0, (int64_t)sizeof(kBinaryMagic));
+      if (std::memcmp(data_.get(), kBinaryMagic, sizeof(kBinaryMagic)) != 0) {
+        throw std::invalid_argument("not an awkward binary file");
+      }
+      position_ = (int64_t)sizeof(kBinaryMagic);
+      uint32_t version = scalar<uint32_t>();
+      if (version != kBinaryVersion) {
+        throw std::invalid_argument(
+          std::string("unsupported awkward binary file version ")
+          + std::to_string(version));
+      }
+      if (scalar<uint32_t>() != kBinaryByteOrder) {
+        throw std::invalid_argument(
+          "awkward binary file was written with a different byte order");
+      }
+      int64_t headerlength = (int64_t)scalar<uint64_t>();
+      int64_t numbuffers = (int64_t)scalar<uint64_t>();
+      check(position_, headerlength);
+      int64_t tablestart = position_ + headerlength;
+      if (numbuffers < 0  ||
+          numbuffers > length_ / (2*(int64_t)sizeof(uint64_t))) {
+        throw std::invalid_argument("binary file is truncated or corrupted");
+      }
+      check(tablestart, 2*(int64_t)sizeof(uint64_t)*numbuffers);
+      for (int64_t i = 0;  i < numbuffers;  i++) {
+        uint64_t pair[2];
+        std::memcpy(pair,
+                    data_.get() + tablestart + 2*sizeof(uint64_t)*i,
+                    sizeof(pair));
+        int64_t offset = (int64_t)pair[0];
+        int64_t nbytes = (int64_t)pair[1];
+        if (offset % kBinaryAlignment != 0) {
+          throw std::invalid_argument("binary file has a misaligned buffer");
+        }
+        check(offset, nbytes);
+        offsets_.push_back(offset);
+        sizes_.push_back(nbytes);
+      }
+    }
+
+    template <typename T>
+    const ContentPtr
+    BinaryReader::list(BinaryNode kind, const util::Parameters& parameters) {
+      if (kind == BinaryNode::list) {
+        IndexOf<T> starts = index<T>();
+        IndexOf<T> stops = index<T>();
+        ContentPtr content = node();
+        return std::make_shared<ListArrayOf<T>>(Identities::none(),
+                                                parameters,
+                                                starts,
+                                                stops,
+                                                content);
+      }
+      else if (kind == BinaryNode::listoffset) {
+        IndexOf<T> offsets = index<T>();
+        ContentPtr content = node();
+        return std::make_shared<ListOffsetArrayOf<T>>(Identities::none(),
+                                                      parameters,
+                                                      offsets,
+                                                      content);
+      }
+      else if (kind == BinaryNode::indexed) {
+        IndexOf<T> index = this->index<T>();
+        ContentPtr content = node();
+        return std::make_shared<IndexedArrayOf<T, false>>(Identities::none(),
+                                                          parameters,
+                                                          index,
+                                                          content);
+      }
+      else {
+        IndexOf<int8_t> tags = index<int8_t>();
+        IndexOf<T> index = this->index<T>();
+        int64_t numcontents = scalar<int64_t>();
+        ContentPtrVec contents;
+        for (int64_t i = 0;  i < numcontents;  i++) {
+          contents.push_back(node());
+        }
+        return std::make_shared<UnionArrayOf<int8_t, T>>(Identities::none(),
+                                                         parameters,
+                                                         tags,
+                                                         index,
+                                                         contents);
+      }
+    }
+
+    const ContentPtr
+    BinaryReader::node() {
+      if (depth_ >= kBinaryMaxDepth) {
+        throw std::invalid_argument("binary file has nodes nested too deeply");
+      }
+      depth_++;
+      ContentPtr out = node_part();
+      depth_--;
+      return out;
+    }
+
+    const ContentPtr
+    BinaryReader::node_part() {
+      BinaryNode kind = (BinaryNode)scalar<uint8_t>();
+      util::Parameters parameters = this->parameters();
+      switch (kind) {
+      case BinaryNode::empty:
+        return std::make_shared<EmptyArray>(Identities::none(), parameters);
+
+      case BinaryNode::numpy: {
+        std::string format = string();
+        int64_t itemsize = scalar<int64_t>();
+        int64_t ndim = scalar<int64_t>();
+        if (itemsize <= 0  ||  ndim <= 0) {
+          throw std::invalid_argument("binary file has an invalid NumpyArray");
+        }
+        int64_t expected = binary_format_itemsize(format);
+        if (expected != 0  &&  expected != itemsize) {
+          throw std::invalid_argument(
+            std::string("binary file has a NumpyArray of format \"") + format
+            + std::string("\" with itemsize ") + std::to_string(itemsize));
+        }
+        std::vector<ssize_t> shape;
+        int64_t nbytes = itemsize;
+        for (int64_t i = 0;  i < ndim;  i++) {
+          int64_t x = scalar<int64_t>();
+          if (x < 0) {
+            throw std::invalid_argument("binary file has a negative length");
+          }
+          if (x != 0  &&  nbytes > kMaxInt64 / x) {
+            throw std::invalid_argument("binary file has a NumpyArray that is "
+                                        "too large");
+          }
+          shape.push_back((ssize_t)x);
+          nbytes *= x;
+        }
+        std::vector<ssize_t> strides(shape.size(), (ssize_t)itemsize);
+        for (int64_t i = ndim - 1;  i > 0;  i--) {
+          strides[(size_t)i - 1] = strides[(size_t)i] * shape[(size_t)i];
+        }
+        std::shared_ptr<void> ptr = buffer<uint8_t>(nbytes);
+        return std::make_shared<NumpyArray>(Identities::none(),
+                                            parameters,
+                                            ptr,
+                                            shape,
+                                            strides,
+                                            0,
+                                            (ssize_t)itemsize,
+                                            format);
+      }
+
+      case BinaryNode::regular: {
+        int64_t size = scalar<int64_t>();
+        ContentPtr content = node();
+        return std::make_shared<RegularArray>(Identities::none(),
+                                              parameters,
+                                              content,
+                                              size);
+      }
+
+      case BinaryNode::list:
+      case BinaryNode::listoffset:
+      case BinaryNode::indexed:
+      case BinaryNode::indexedoption:
+      case BinaryNode::union_: {
+        // The type of the index is only known when it is read, so peek.
+        int64_t start = position_;
+        if (kind == BinaryNode::union_) {
+          index<int8_t>();
+        }
+        BinaryIndex indextype = (BinaryIndex)scalar<uint8_t>();
+        position_ = start;
+        if (kind == BinaryNode::indexedoption) {
+          if (indextype == BinaryIndex::i32) {
+            IndexOf<int32_t> index = this->index<int32_t>();
+            return std::make_shared<IndexedOptionArray32>(
+              Identities::none(), parameters, index, node());
+          }
+          else if (indextype == BinaryIndex::i64) {
+            IndexOf<int64_t> index = this->index<int64_t>();
+            return std::make_shared<IndexedOptionArray64>(
+              Identities::none(), parameters, index, node());
+          }
+        }
+        else if (indextype == BinaryIndex::i32) {
+          return list<int32_t>(kind, parameters);
+        }
+        else if (indextype == BinaryIndex::u32) {
+          return list<uint32_t>(kind, parameters);
+        }
+        else if (indextype == BinaryIndex::i64) {
+          return list<int64_t>(kind, parameters);
+        }
+        throw std::invalid_argument("binary file has an Index of the "
+                                    "wrong type");
+      }
+
+      case BinaryNode::bytemasked: {
+        Index8 mask = index<int8_t>();
+        bool validwhen = (scalar<uint8_t>() != 0);
+        ContentPtr content = node();
+        return std::make_shared<ByteMaskedArray>(Identities::none(),
+                                                 parameters,
+                                                 mask,
+                                                 content,
+                                                 validwhen);
+      }
+
+      case BinaryNode::bitmasked: {
+        IndexU8 mask = index<uint8_t>();
+        bool validwhen = (scalar<uint8_t>() != 0);
+        int64_t length = scalar<int64_t>();
+        bool lsb_order = (scalar<uint8_t>() != 0);
+        ContentPtr content = node();
+        return std::make_shared<BitMaskedArray>(Identities::none(),
+                                                parameters,
+                                                mask,
+                                                content,
+                                                validwhen,
+                                                length,
+                                                lsb_order);
+      }
+
+      case BinaryNode::unmasked: {
+        ContentPtr content = node();
+        return std::make_shared<UnmaskedArray>(Identities::none(),
+                                               parameters,
+                                               content);
+      }
+
+      case BinaryNode::record: {
+        int64_t length = scalar<int64_t>();
+        int64_t numfields = scalar<int64_t>();
+        bool istuple = (scalar<uint8_t>() != 0);
+        util::RecordLookupPtr recordlookup(nullptr);
+        if (!istuple) {
+          recordlookup = std::make_shared<util::RecordLookup>();
+          for (int64_t i = 0;  i < numfields;  i++) {
+            recordlookup.get()->push_back(string());
+          }
+        }
+        ContentPtrVec contents;
+        for (int64_t i = 0;  i < numfields;  i++) {
+          contents.push_back(node());
+        }
+        return std::make_shared<RecordArray>(Identities::none(),
+                                             parameters,
+                                             contents,
+                                             recordlookup,
+                                             length);
+      }
+
+      default:
+        throw std::invalid_argument("binary file has an unrecognized node");
+      }
+    }
+
+    const std::shared_ptr<uint8_t>
+    binary_readall(const std::string& path, int64_t& length) {
+  #ifdef _MSC_VER
+      FILE* file;
+      if (fopen_s(&file, path.c_str(), "rb") != 0) {
+  #else
+      FILE* file = fopen(path.c_str(), "rb");
+      if (file == nullptr) {
+  #endif
+        throw std::invalid_argument(
+          std::string("file \"") + path
+          + std::string("\" could not be opened for reading"));
+      }
+      fseek(file, 0, SEEK_END);
+      length = (int64_t)ftell(file);
+      fseek(file, 0, SEEK_SET);
+      std::shared_ptr<uint8_t> out(allocate_array<uint8_t>(length + 1));
+      size_t count = fread(out.get(), 1, (size_t)length, file);
+      fclose(file);
+      if (count != (size_t)length) {
+        throw std::runtime_error(
+          std::string("file \"") + path
+          + std::string("\" could not be read"));
+      }
+      return out;
+    }
+  }
+
+  const ContentPtr
+  FromBinaryFile(const std::string& path, bool mmap) {
+    std::shared_ptr<uint8_t> data(nullptr);
+    int64_t length = 0;
+#ifndef _MSC_VER
+    if (mmap) {
+      int fd = open(path.c_str(), O_RDONLY);
+      if (fd < 0) {
+        throw std::invalid_argument(
+          std::string("file \"") + path
+          + std::string("\" could not be opened for reading"));
+      }
+      struct stat info;
+      if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::invalid_argument(
+          std::string("file \"") + path
+          + std::string("\" could not be inspected"));
+      }
+      length = (int64_t)info.st_size;
+      if (length == 0) {
+        close(fd);
+        throw std::invalid_argument("not an awkward binary file");
+      }
+      // Private, writable pages: arrays may be modified in place without
+      // changing the file.
+      void* mapping = ::mmap(nullptr,
+                             (size_t)length,
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE,
+                             fd,
+                             0);
+      close(fd);
+      if (mapping == MAP_FAILED) {
+        throw std::runtime_error(
+          std::string("file \"") + path
+          + std::string("\" could not be memory-mapped"));
+      }
+      size_t maplength = (size_t)length;
+      data = std::shared_ptr<uint8_t>(
+        reinterpret_cast<uint8_t*>(mapping),
+        [maplength](uint8_t* ptr) -> void { munmap(ptr, maplength); });
+    }
+#endif
+    if (data.get() == nullptr) {
+      data = binary_readall(path, length);
+    }
+    BinaryReader reader(data, length);
+    reader.preamble();
+    ContentPtr out = reader.node();
+    std::string err = out.get()->validityerror(std::string("layout"));
+    if (!err.empty()) {
+      throw std::invalid_argument(
+        std::string("binary file has an invalid layout: ") + err);
+    }
+    return out;
+  }
+}
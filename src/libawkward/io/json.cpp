@@ -1,5 +1,9 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
 #include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
 #include "rapidjson/prettywriter.h"
@@ -7,8 +11,25 @@
 #include "rapidjson/filereadstream.h"
 #include "rapidjson/filewritestream.h"
 #include "rapidjson/error/en.h"
+#include "rapidjson/internal/dtoa.h"
+#include "rapidjson/internal/itoa.h"
 
+#include "awkward/Allocator.h"
 #include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/GrowableBuffer.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/type/ArrayType.h"
+#include "awkward/type/ListType.h"
+#include "awkward/type/OptionType.h"
+#include "awkward/type/PrimitiveType.h"
+#include "awkward/type/RecordType.h"
+#include "awkward/type/RegularType.h"
+#include "awkward/type/UnknownType.h"
 #include "awkward/Content.h"
 
 #include "awkward/io/json.h"
@@ -18,11 +39,201 @@ namespace rj = rapidjson;
 namespace awkward {
   ////////// writing to JSON
 
+  template <typename T>
+  void
+  tojson_integers(ToJson& builder,
+                  const T* x,
+                  int64_t length,
+                  int64_t stride) {
+    const char* bytes = reinterpret_cast<const char*>(x);
+    builder.beginlist();
+    for (int64_t i = 0;  i < length;  i++) {
+      builder.integer((int64_t)*reinterpret_cast<const T*>(bytes + i*stride));
+    }
+    builder.endlist();
+  }
+
+  template <typename T>
+  void
+  tojson_reals(ToJson& builder,
+               const T* x,
+               int64_t length,
+               int64_t stride) {
+    const char* bytes = reinterpret_cast<const char*>(x);
+    builder.beginlist();
+    for (int64_t i = 0;  i < length;  i++) {
+      builder.real((double)*reinterpret_cast<const T*>(bytes + i*stride));
+    }
+    builder.endlist();
+  }
+
+  void
+  ToJson::boolean_array(const bool* x, int64_t length, int64_t stride) {
+    const char* bytes = reinterpret_cast<const char*>(x);
+    beginlist();
+    for (int64_t i = 0;  i < length;  i++) {
+      boolean(*reinterpret_cast<const bool*>(bytes + i*stride));
+    }
+    endlist();
+  }
+
+  void
+  ToJson::integer_array(const int8_t* x, int64_t length, int64_t stride) {
+    tojson_integers<int8_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::integer_array(const uint8_t* x, int64_t length, int64_t stride) {
+    tojson_integers<uint8_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::integer_array(const int16_t* x, int64_t length, int64_t stride) {
+    tojson_integers<int16_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::integer_array(const uint16_t* x, int64_t length, int64_t stride) {
+    tojson_integers<uint16_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::integer_array(const int32_t* x, int64_t length, int64_t stride) {
+    tojson_integers<int32_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::integer_array(const uint32_t* x, int64_t length, int64_t stride) {
+    tojson_integers<uint32_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::integer_array(const int64_t* x, int64_t length, int64_t stride) {
+    tojson_integers<int64_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::integer_array(const uint64_t* x, int64_t length, int64_t stride) {
+    tojson_integers<uint64_t>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::real_array(const float* x, int64_t length, int64_t stride) {
+    tojson_reals<float>(*this, x, length, stride);
+  }
+
+  void
+  ToJson::real_array(const double* x, int64_t length, int64_t stride) {
+    tojson_reals<double>(*this, x, length, stride);
+  }
+
+  // Bulk writing puts each number directly into the output stream's memory:
+  // Push reserves the widest possible number and Pop returns what was not
+  // used, which is how rj::Writer writes a single number. The numbers are
+  // formatted with the same (Grisu2) routines as rj::Writer, so the output
+  // is identical to the scalar methods.
+  const size_t kMaxJsonNumber = 26;   // comma and 25 characters
+
+  inline char*
+  tojson_number(char* buffer, bool x, int) {
+    if (x) {
+      std::memcpy(buffer, "true", 4);
+      return buffer + 4;
+    }
+    else {
+      std::memcpy(buffer, "false", 5);
+      return buffer + 5;
+    }
+  }
+
+  inline char*
+  tojson_number(char* buffer, int64_t x, int) {
+    return rj::internal::i64toa(x, buffer);
+  }
+
+  inline char*
+  tojson_number(char* buffer, double x, int maxdecimals) {
+    return rj::internal::dtoa(x, buffer, maxdecimals);
+  }
+
+  // Non-finite values are not valid JSON; rj::Writer refuses to write them,
+  // so the bulk methods fall back to the scalar methods for such arrays.
+  template <typename T>
+  bool
+  tojson_finite(const T* x, int64_t length, int64_t stride) {
+    const char* bytes = reinterpret_cast<const char*>(x);
+    for (int64_t i = 0;  i < length;  i++) {
+      if (!std::isfinite(*reinterpret_cast<const T*>(bytes + i*stride))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename V, typename T, typename STREAM>
+  void
+  tojson_bulk(STREAM& stream,
+              const T* x,
+              int64_t length,
+              int64_t stride,
+              int maxdecimals) {
+    const char* bytes = reinterpret_cast<const char*>(x);
+    for (int64_t i = 0;  i < length;  i++) {
+      char* start = stream.Push(kMaxJsonNumber);
+      char* end = start;
+      if (i != 0) {
+        *end++ = ',';
+      }
+      end = tojson_number(end,
+                          (V)*reinterpret_cast<const T*>(bytes + i*stride),
+                          maxdecimals);
+      stream.Pop(kMaxJsonNumber - (size_t)(end - start));
+    }
+  }
+
+  // Writes directly to the FILE in the same memory that rj::FileWriteStream
+  // uses (after flushing it), since rj::FileWriteStream has no Push/Pop.
+  // Flush must be called at the end; it throws if the FILE can't be written.
+  class BulkFileStream {
+  public:
+    BulkFileStream(FILE* destination, char* buffer, size_t size)
+        : destination_(destination)
+        , buffer_(buffer)
+        , size_(size)
+        , used_(0) { }
+    char* Push(size_t count) {
+      if (used_ + count > size_) {
+        Flush();
+      }
+      used_ += count;
+      return buffer_ + used_ - count;
+    }
+    void Pop(size_t count) {
+      used_ -= count;
+    }
+    void Flush() {
+      size_t written = std::fwrite(buffer_, 1, used_, destination_);
+      if (written != used_) {
+        throw std::runtime_error("JSON error: file could not be written");
+      }
+      used_ = 0;
+    }
+  private:
+    FILE* destination_;
+    char* buffer_;
+    size_t size_;
+    size_t used_;
+  };
+
   class ToJsonString::Impl {
   public:
-    Impl(int64_t maxdecimals): buffer_(), writer_(buffer_) {
+    Impl(int64_t maxdecimals)
+        : buffer_()
+        , writer_(buffer_)
+        , maxdecimals_(rj::Writer<rj::StringBuffer>::kDefaultMaxDecimalPlaces) {
       if (maxdecimals >= 0) {
         writer_.SetMaxDecimalPlaces((int)maxdecimals);
+        maxdecimals_ = (int)maxdecimals;
       }
     }
     void null() { writer_.Null(); }
@@ -36,12 +247,19 @@ namespace awkward {
     void beginrecord() { writer_.StartObject(); }
     void field(const char* x) { writer_.Key(x); }
     void endrecord() { writer_.EndObject(); }
+    template <typename V, typename T>
+    void bulk(const T* x, int64_t length, int64_t stride) {
+      writer_.StartArray();
+      tojson_bulk<V, T>(buffer_, x, length, stride, maxdecimals_);
+      writer_.EndArray();
+    }
     const std::string tostring() {
       return std::string(buffer_.GetString());
     }
   private:
     rj::StringBuffer buffer_;
     rj::Writer<rj::StringBuffer> writer_;
+    int maxdecimals_;
   };
 
   ToJsonString::ToJsonString(int64_t maxdecimals)
@@ -101,6 +319,71 @@ namespace awkward {
     impl_->endrecord();
   }
 
+  void
+  ToJsonString::boolean_array(const bool* x, int64_t length, int64_t stride) {
+    impl_->bulk<bool, bool>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const int8_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int8_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const uint8_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint8_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const int16_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int16_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const uint16_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint16_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const int32_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int32_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const uint32_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint32_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const int64_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int64_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::integer_array(const uint64_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint64_t>(x, length, stride);
+  }
+
+  void
+  ToJsonString::real_array(const float* x, int64_t length, int64_t stride) {
+    if (tojson_finite<float>(x, length, stride)) {
+      impl_->bulk<double, float>(x, length, stride);
+    }
+    else {
+      ToJson::real_array(x, length, stride);
+    }
+  }
+
+  void
+  ToJsonString::real_array(const double* x, int64_t length, int64_t stride) {
+    if (tojson_finite<double>(x, length, stride)) {
+      impl_->bulk<double, double>(x, length, stride);
+    }
+    else {
+      ToJson::real_array(x, length, stride);
+    }
+  }
+
   const std::string
   ToJsonString::tostring() {
     return impl_->tostring();
@@ -198,13 +481,16 @@ namespace awkward {
   class ToJsonFile::Impl {
   public:
     Impl(FILE* destination, int64_t maxdecimals, int64_t buffersize)
-        : buffer_(new char[(size_t)buffersize], util::array_deleter<char>())
-        , stream_(destination,
-                  buffer_.get(),
-                  ((size_t)buffersize)*sizeof(char))
-        , writer_(stream_) {
+        : destination_(destination)
+        , buffersize_(std::max((size_t)buffersize, kMaxJsonNumber))
+        , buffer_(allocate_array<char>(buffersize_))
+        , stream_(destination, buffer_.get(), buffersize_*sizeof(char))
+        , writer_(stream_)
+        , maxdecimals_(
+            rj::Writer<rj::FileWriteStream>::kDefaultMaxDecimalPlaces) {
       if (maxdecimals >= 0) {
         writer_.SetMaxDecimalPlaces((int)maxdecimals);
+        maxdecimals_ = (int)maxdecimals;
       }
     }
     void null() { writer_.Null(); }
@@ -218,10 +504,24 @@ namespace awkward {
     void beginrecord() { writer_.StartObject(); }
     void field(const char* x) { writer_.Key(x); }
     void endrecord() { writer_.EndObject(); }
+    template <typename V, typename T>
+    void bulk(const T* x, int64_t length, int64_t stride) {
+      writer_.StartArray();
+      stream_.Flush();
+      {
+        BulkFileStream bulkstream(destination_, buffer_.get(), buffersize_);
+        tojson_bulk<V, T>(bulkstream, x, length, stride, maxdecimals_);
+        bulkstream.Flush();
+      }
+      writer_.EndArray();
+    }
   private:
+    FILE* destination_;
+    size_t buffersize_;
     std::shared_ptr<char> buffer_;
     rj::FileWriteStream stream_;
     rj::Writer<rj::FileWriteStream> writer_ ;
+    int maxdecimals_;
   };
 
   ToJsonFile::ToJsonFile(FILE* destination,
@@ -283,10 +583,75 @@ namespace awkward {
     impl_->endrecord();
   }
 
+  void
+  ToJsonFile::boolean_array(const bool* x, int64_t length, int64_t stride) {
+    impl_->bulk<bool, bool>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const int8_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int8_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const uint8_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint8_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const int16_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int16_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const uint16_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint16_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const int32_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int32_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const uint32_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint32_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const int64_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, int64_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::integer_array(const uint64_t* x, int64_t length, int64_t stride) {
+    impl_->bulk<int64_t, uint64_t>(x, length, stride);
+  }
+
+  void
+  ToJsonFile::real_array(const float* x, int64_t length, int64_t stride) {
+    if (tojson_finite<float>(x, length, stride)) {
+      impl_->bulk<double, float>(x, length, stride);
+    }
+    else {
+      ToJson::real_array(x, length, stride);
+    }
+  }
+
+  void
+  ToJsonFile::real_array(const double* x, int64_t length, int64_t stride) {
+    if (tojson_finite<double>(x, length, stride)) {
+      impl_->bulk<double, double>(x, length, stride);
+    }
+    else {
+      ToJson::real_array(x, length, stride);
+    }
+  }
+
   class ToJsonPrettyFile::Impl {
   public:
     Impl(FILE* destination, int64_t maxdecimals, int64_t buffersize)
-        : buffer_(new char[(size_t)buffersize], util::array_deleter<char>())
+        : buffer_(allocate_array<char>(buffersize))
         , stream_(destination,
                   buffer_.get(),
                   ((size_t)buffersize)*sizeof(char))
@@ -381,10 +746,21 @@ namespace awkward {
         : builder_(options)
         , depth_(0) { }
 
+    // In JSON-lines mode, every top-level value is one item of the output,
+    // as though the values were all in one top-level array.
+    Handler(const ArrayBuilderOptions& options, bool lines)
+        : builder_(options)
+        , depth_(lines ? 1 : 0) { }
+
     const ContentPtr snapshot() const {
       return builder_.snapshot();
     }
 
+    // Hands the buffers over to the output and clears the builder.
+    const ContentPtr finish() {
+      return builder_.finish(true);
+    }
+
     bool Null()               { builder_.null();              return true; }
     bool Bool(bool x)         { builder_.boolean(x);          return true; }
     bool Int(int x)           { builder_.integer((int64_t)x); return true; }
@@ -454,7 +830,7 @@ namespace awkward {
     rj::Reader reader;
     rj::StringStream stream(source);
     if (reader.Parse(stream, handler)) {
-      return handler.snapshot();
+      return handler.finish();
     }
     else {
       throw std::invalid_argument(
@@ -470,13 +846,12 @@ namespace awkward {
                int64_t buffersize) {
     Handler handler(options);
     rj::Reader reader;
-    std::shared_ptr<char> buffer(new char[(size_t)buffersize],
-                                 util::array_deleter<char>());
+    std::shared_ptr<char> buffer(allocate_array<char>(buffersize));
     rj::FileReadStream stream(source,
                               buffer.get(),
                               ((size_t)buffersize)*sizeof(char));
     if (reader.Parse(stream, handler)) {
-      return handler.snapshot();
+      return handler.finish();
     }
     else {
       throw std::invalid_argument(
@@ -484,6 +859,956 @@ namespace awkward {
         + std::to_string(reader.GetErrorOffset()) + std::string(": ")
         + std::string(rj::GetParseError_En(reader.GetParseErrorCode())));
     }
-    return handler.snapshot();
+    return handler.finish();
+  }
+
+  ////////// reading JSON with a known type
+
+  namespace {
+    // Each node of the type gets a filler that appends values directly to its
+    // own typed buffers; the handler only routes values to fillers, so there
+    // is no type discovery and no union simplification at the end.
+    class JsonFiller {
+    public:
+      enum Kind {
+        kNull,
+        kBool,
+        kInt,
+        kReal,
+        kString,
+        kList,
+        kRecord
+      };
+
+      JsonFiller(const TypePtr& type, bool nullfill)
+          : type_(type)
+          , nullfill_(nullfill) { }
+
+      virtual ~JsonFiller() { }
+
+      virtual int64_t
+        length() const = 0;
+
+      virtual const ContentPtr
+        snapshot() const = 0;
+
+      virtual bool
+        accepts(Kind kind) const = 0;
+
+      // Returns the filler that takes a value of this kind, or nullptr if the
+      // value does not match. Option-type fillers fill nulls (and, with
+      // nullfill, mismatched values) themselves and set filled.
+      virtual JsonFiller*
+        accept(Kind kind, bool& filled) {
+        filled = false;
+        return accepts(kind) ? this : nullptr;
+      }
+
+      virtual void
+        boolean(bool) { }
+      virtual void
+        integer(int64_t) { }
+      virtual void
+        real(double) { }
+      virtual void
+        string(const char*, int64_t) { }
+
+      // Lists, tuples, and records: begin and end an item. The filler for
+      // each value inside it is child(), which is nullptr if the value should
+      // be skipped. The end and field methods return an error message or "".
+      virtual void
+        begin() { }
+      virtual const std::string
+        end() { return std::string(""); }
+      virtual JsonFiller*
+        child() { return nullptr; }
+      virtual const std::string
+        field(const char*) { return std::string("unexpected field"); }
+
+      const TypePtr
+        type() const {
+        return type_;
+      }
+
+    protected:
+      const TypePtr type_;
+      const bool nullfill_;
+    };
+
+    using JsonFillerPtr = std::shared_ptr<JsonFiller>;
+
+    const JsonFillerPtr
+      json_filler(const TypePtr& type,
+                  const ArrayBuilderOptions& options,
+                  bool nullfill,
+                  int64_t reserve);
+
+    template <typename T>
+    class JsonNumberFiller: public JsonFiller {
+    public:
+      JsonNumberFiller(const TypePtr& type,
+                       bool nullfill,
+                       const GrowableBuffer<T>& buffer,
+                       const std::string& format,
+                       bool isbool,
+                       bool isreal)
+          : JsonFiller(type, nullfill)
+          , buffer_(buffer)
+          , format_(format)
+          , isbool_(isbool)
+          , isreal_(isreal) { }
+
+      int64_t
+        length() const override {
+        return buffer_.length();
+      }
+
+      const ContentPtr
+        snapshot() const override {
+        std::vector<ssize_t> shape = { (ssize_t)buffer_.length() };
+        std::vector<ssize_t> strides = { (ssize_t)sizeof(T) };
+        return std::make_shared<NumpyArray>(Identities::none(),
+                                            type_.get()->parameters(),
+                                            buffer_.ptr(),
+                                            shape,
+                                            strides,
+                                            0,
+                                            sizeof(T),
+                                            format_);
+      }
+
+      bool
+        accepts(Kind kind) const override {
+        if (isbool_) {
+          return kind == kBool;
+        }
+        else {
+          return kind == kInt  ||  (isreal_  &&  kind == kReal);
+        }
+      }
+
+      void
+        boolean(bool x) override {
+        buffer_.append((T)x);
+      }
+
+      void
+        integer(int64_t x) override {
+        buffer_.append((T)x);
+      }
+
+      void
+        real(double x) override {
+        buffer_.append((T)x);
+      }
+
+    private:
+      GrowableBuffer<T> buffer_;
+      const std::string format_;
+      const bool isbool_;
+      const bool isreal_;
+    };
+
+    class JsonStringFiller: public JsonFiller {
+    public:
+      JsonStringFiller(const TypePtr& type,
+                       bool nullfill,
+                       const ArrayBuilderOptions& options,
+                       int64_t reserve)
+          : JsonFiller(type, nullfill)
+          , offsets_(GrowableBuffer<int64_t>::empty(options, reserve + 1))
+          , content_(GrowableBuffer<uint8_t>::empty(options)) {
+        offsets_.append(0);
+      }
+
+      int64_t
+        length() const override {
+        return offsets_.length() - 1;
+      }
+
+      const ContentPtr
+        snapshot() const override {
+        Index64 offsets(offsets_.ptr(), 0, offsets_.length());
+        std::vector<ssize_t> shape = { (ssize_t)content_.length() };
+        std::vector<ssize_t> strides = { (ssize_t)sizeof(uint8_t) };
+        ListType* list = dynamic_cast<ListType*>(type_.get());
+        ContentPtr content = std::make_shared<NumpyArray>(
+          Identities::none(),
+          list->type().get()->parameters(),
+          content_.ptr(),
+          shape,
+          strides,
+          0,
+          sizeof(uint8_t),
+          "B");
+        return std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                   type_.get()->parameters(),
+                                                   offsets,
+                                                   content);
+      }
+
+      bool
+        accepts(Kind kind) const override {
+        return kind == kString;
+      }
+
+      void
+        string(const char* x, int64_t length) override {
+        for (int64_t i = 0;  i < length;  i++) {
+          content_.append((uint8_t)x[i]);
+        }
+        offsets_.append(content_.length());
+      }
+
+    private:
+      GrowableBuffer<int64_t> offsets_;
+      GrowableBuffer<uint8_t> content_;
+    };
+
+    class JsonListFiller: public JsonFiller {
+    public:
+      JsonListFiller(const TypePtr& type,
+                     bool nullfill,
+                     const ArrayBuilderOptions& options,
+                     int64_t reserve,
+                     const JsonFillerPtr& content)
+          : JsonFiller(type, nullfill)
+          , offsets_(GrowableBuffer<int64_t>::empty(options, reserve + 1))
+          , content_(content) {
+        offsets_.append(0);
+      }
+
+      int64_t
+        length() const override {
+        return offsets_.length() - 1;
+      }
+
+      const ContentPtr
+        snapshot() const override {
+        Index64 offsets(offsets_.ptr(), 0, offsets_.length());
+        return std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                   type_.get()->parameters(),
+                                                   offsets,
+                                                   content_.get()->snapshot());
+      }
+
+      bool
+        accepts(Kind kind) const override {
+        return kind == kList;
+      }
+
+      const std::string
+        end() override {
+        offsets_.append(content_.get()->length());
+        return std::string("");
+      }
+
+      JsonFiller*
+        child() override {
+        return content_.get();
+      }
+
+    private:
+      GrowableBuffer<int64_t> offsets_;
+      const JsonFillerPtr content_;
+    };
+
+    class JsonRegularFiller: public JsonFiller {
+    public:
+      JsonRegularFiller(const TypePtr& type,
+                        bool nullfill,
+                        int64_t size,
+                        const JsonFillerPtr& content)
+          : JsonFiller(type, nullfill)
+          , size_(size)
+          , content_(content)
+          , length_(0)
+          , count_(0) { }
+
+      int64_t
+        length() const override {
+        return length_;
+      }
+
+      const ContentPtr
+        snapshot() const override {
+        return std::make_shared<RegularArray>(Identities::none(),
+                                              type_.get()->parameters(),
+                                              content_.get()->snapshot(),
+                                              size_);
+      }
+
+      bool
+        accepts(Kind kind) const override {
+        return kind == kList;
+      }
+
+      void
+        begin() override {
+        count_ = 0;
+      }
+
+      const std::string
+        end() override {
+        if (count_ != size_) {
+          return std::string("expected ") + std::to_string(size_)
+                 + std::string(" items in a list of type ")
+                 + type_.get()->tostring() + std::string(", found ")
+                 + std::to_string(count_);
+        }
+        length_++;
+        return std::string("");
+      }
+
+      JsonFiller*
+        child() override {
+        count_++;
+        return content_.get();
+      }
+
+    private:
+      const int64_t size_;
+      const JsonFillerPtr content_;
+      int64_t length_;
+      int64_t count_;
+    };
+
+    // Records are read from JSON objects and tuples from JSON arrays.
+    class JsonRecordFiller: public JsonFiller {
+    public:
+      JsonRecordFiller(const TypePtr& type,
+                       bool nullfill,
+                       const std::vector<JsonFillerPtr>& contents)
+          : JsonFiller(type, nullfill)
+          , contents_(contents)
+          , recordlookup_(
+              dynamic_cast<RecordType*>(type.get())->recordlookup())
+          , seen_(contents.size(), false)
+          , current_(-1)
+          , count_(0)
+          , length_(0) { }
+
+      int64_t
+        length() const override {
+        return length_;
+      }
+
+      const ContentPtr
+        snapshot() const override {
+        ContentPtrVec contents;
+        for (auto content : contents_) {
+          contents.push_back(content.get()->snapshot());
+        }
+        return std::make_shared<RecordArray>(Identities::none(),
+                                             type_.get()->parameters(),
+                                             contents,
+                                             recordlookup_,
+                                             length_);
+      }
+
+      bool
+        accepts(Kind kind) const override {
+        return kind == (recordlookup_.get() == nullptr ? kList : kRecord);
+      }
+
+      void
+        begin() override {
+        std::fill(seen_.begin(), seen_.end(), false);
+        current_ = -1;
+        count_ = 0;
+      }
+
+      const std::string
+        end() override {
+        int64_t numfields = (int64_t)contents_.size();
+        if (count_ > numfields  &&  !nullfill_) {
+          return std::string("expected ") + std::to_string(numfields)
+                 + std::string(" items in a tuple of type ")
+                 + type_.get()->tostring() + std::string(", found ")
+                 + std::to_string(count_);
+        }
+        for (int64_t i = 0;  i < numfields;  i++) {
+          if (!seen_[(size_t)i]) {
+            bool filled;
+            if (contents_[(size_t)i].get()->accept(kNull, filled) == nullptr) {
+              return std::string("missing ")
+                     + (recordlookup_.get() == nullptr
+                          ? std::string("item ") + std::to_string(i)
+                          : std::string("field ")
+                            + util::quote(recordlookup_.get()->at((size_t)i),
+                                          true))
+                     + std::string(" of type ")
+                     + contents_[(size_t)i].get()->type().get()->tostring();
+            }
+          }
+        }
+        length_++;
+        return std::string("");
+      }
+
+      JsonFiller*
+        child() override {
+        if (recordlookup_.get() == nullptr) {
+          current_ = count_;
+          count_++;
+          if (current_ >= (int64_t)contents_.size()) {
+            return nullptr;
+          }
+          seen_[(size_t)current_] = true;
+        }
+        return current_ < 0 ? nullptr : contents_[(size_t)current_].get();
+      }
+
+      const std::string
+        field(const char* key) override {
+        // Fields are usually in the same order as in the type.
+        int64_t numfields = (int64_t)contents_.size();
+        int64_t start = current_ + 1;
+        current_ = -1;
+        for (int64_t j = 0;  j < numfields;  j++) {
+          int64_t i = (start + j) % numfields;
+          if (recordlookup_.get()->at((size_t)i).compare(key) == 0) {
+            current_ = i;
+            break;
+          }
+        }
+        if (current_ < 0) {
+          if (nullfill_) {
+            return std::string("");
+          }
+          return std::string("unexpected field ")
+                 + util::quote(key, true) + std::string(" in a record of type ")
+                 + type_.get()->tostring();
+        }
+        if (seen_[(size_t)current_]) {
+          return std::string("duplicate field ") + util::quote(key, true);
+        }
+        seen_[(size_t)current_] = true;
+        return std::string("");
+      }
+
+    private:
+      const std::vector<JsonFillerPtr> contents_;
+      const util::RecordLookupPtr recordlookup_;
+      std::vector<bool> seen_;
+      int64_t current_;
+      int64_t count_;
+      int64_t length_;
+    };
+
+    class JsonOptionFiller: public JsonFiller {
+    public:
+      JsonOptionFiller(const TypePtr& type,
+                       bool nullfill,
+                       const ArrayBuilderOptions& options,
+                       int64_t reserve,
+                       const JsonFillerPtr& content)
+          : JsonFiller(type, nullfill)
+          , index_(GrowableBuffer<int64_t>::empty(options, reserve))
+          , content_(content) { }
+
+      int64_t
+        length() const override {
+        return index_.length();
+      }
+
+      const ContentPtr
+        snapshot() const override {
+        Index64 index(index_.ptr(), 0, index_.length());
+        return std::make_shared<IndexedOptionArray64>(
+          Identities::none(),
+          type_.get()->parameters(),
+          index,
+          content_.get()->snapshot());
+      }
+
+      bool
+        accepts(Kind kind) const override {
+        return kind == kNull  ||  content_.get()->accepts(kind);
+      }
+
+      JsonFiller*
+        accept(Kind kind, bool& filled) override {
+        if (kind != kNull) {
+          int64_t at = content_.get()->length();
+          JsonFiller* out = content_.get()->accept(kind, filled);
+          if (out != nullptr) {
+            index_.append(at);
+            return out;
+          }
+          if (!nullfill_) {
+            return nullptr;
+          }
+        }
+        index_.append(-1);
+        filled = true;
+        return this;
+      }
+
+    private:
+      GrowableBuffer<int64_t> index_;
+      const JsonFillerPtr content_;
+    };
+
+    class JsonUnknownFiller: public JsonFiller {
+    public:
+      JsonUnknownFiller(const TypePtr& type, bool nullfill)
+          : JsonFiller(type, nullfill) { }
+
+      int64_t
+        length() const override {
+        return 0;
+      }
+
+      const ContentPtr
+        snapshot() const override {
+        return std::make_shared<EmptyArray>(Identities::none(),
+                                            type_.get()->parameters());
+      }
+
+      bool
+        accepts(Kind) const override {
+        return false;
+      }
+    };
+
+    template <typename T>
+    const JsonFillerPtr
+    json_number_filler(const TypePtr& type,
+                       const ArrayBuilderOptions& options,
+                       bool nullfill,
+                       int64_t reserve,
+                       const std::string& format,
+                       bool isbool,
+                       bool isreal) {
+      return std::make_shared<JsonNumberFiller<T>>(
+        type,
+        nullfill,
+        GrowableBuffer<T>::empty(options, reserve),
+        format,
+        isbool,
+        isreal);
+    }
+
+    const JsonFillerPtr
+    json_filler(const TypePtr& type,
+                const ArrayBuilderOptions& options,
+                bool nullfill,
+                int64_t reserve) {
+      if (PrimitiveType* raw = dynamic_cast<PrimitiveType*>(type.get())) {
+        std::string format = PrimitiveType::format(raw->dtype());
+        switch (raw->dtype()) {
+          case PrimitiveType::boolean:
+            return json_number_filler<bool>(
+              type, options, nullfill, reserve, format, true, false);
+          case PrimitiveType::int8:
+            return json_number_filler<int8_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::uint8:
+            return json_number_filler<uint8_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::int16:
+            return json_number_filler<int16_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::uint16:
+            return json_number_filler<uint16_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::int32:
+            return json_number_filler<int32_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::uint32:
+            return json_number_filler<uint32_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::int64:
+            return json_number_filler<int64_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::uint64:
+            return json_number_filler<uint64_t>(
+              type, options, nullfill, reserve, format, false, false);
+          case PrimitiveType::float32:
+            return json_number_filler<float>(
+              type, options, nullfill, reserve, format, false, true);
+          case PrimitiveType::float64:
+            return json_number_filler<double>(
+              type, options, nullfill, reserve, format, false, true);
+          default:
+            throw std::runtime_error(
+              std::string("unexpected dtype: ") + std::to_string(raw->dtype()));
+        }
+      }
+      else if (ListType* raw = dynamic_cast<ListType*>(type.get())) {
+        if (type.get()->parameter_equals("__array__", "\"string\"")  ||
+            type.get()->parameter_equals("__array__", "\"bytestring\"")) {
+          return std::make_shared<JsonStringFiller>(
+            type, nullfill, options, reserve);
+        }
+        return std::make_shared<JsonListFiller>(
+          type,
+          nullfill,
+          options,
+          reserve,
+          json_filler(raw->type(), options, nullfill, 0));
+      }
+      else if (RegularType* raw = dynamic_cast<RegularType*>(type.get())) {
+        return std::make_shared<JsonRegularFiller>(
+          type,
+          nullfill,
+          raw->size(),
+          json_filler(raw->type(), options, nullfill, reserve*raw->size()));
+      }
+      else if (RecordType* raw = dynamic_cast<RecordType*>(type.get())) {
+        std::vector<JsonFillerPtr> contents;
+        for (auto x : raw->types()) {
+          contents.push_back(json_filler(x, options, nullfill, reserve));
+        }
+        return std::make_shared<JsonRecordFiller>(type, nullfill, contents);
+      }
+      else if (OptionType* raw = dynamic_cast<OptionType*>(type.get())) {
+        return std::make_shared<JsonOptionFiller>(
+          type,
+          nullfill,
+          options,
+          reserve,
+          json_filler(raw->type(), options, nullfill, reserve));
+      }
+      else if (dynamic_cast<UnknownType*>(type.get())) {
+        return std::make_shared<JsonUnknownFiller>(type, nullfill);
+      }
+      else {
+        throw std::invalid_argument(
+          std::string("cannot read JSON as type ") + type.get()->tostring()
+          + std::string(": union types are not supported"));
+      }
+    }
+
+    // As with Handler, the items of a top-level JSON array are the items of
+    // the output; any other top-level value is a single item.
+    class TypedHandler: public rj::BaseReaderHandler<rj::UTF8<>, TypedHandler> {
+    public:
+      TypedHandler(const TypePtr& type,
+                   const ArrayBuilderOptions& options,
+                   bool nullfill)
+          : first_(true)
+          , skipping_(0) {
+        if (ArrayType* raw = dynamic_cast<ArrayType*>(type.get())) {
+          root_ = json_filler(raw->type(), options, nullfill, raw->length());
+        }
+        else {
+          root_ = json_filler(type, options, nullfill, 0);
+        }
+      }
+
+      const ContentPtr snapshot() const {
+        return root_.get()->snapshot();
+      }
+
+      const std::string error() const {
+        return error_;
+      }
+
+      bool Null() {
+        JsonFiller* out;
+        return skipping_ > 0  ||  target(JsonFiller::kNull, out);
+      }
+
+      bool Bool(bool x) {
+        JsonFiller* out;
+        if (skipping_ > 0) {
+          return true;
+        }
+        if (!target(JsonFiller::kBool, out)) {
+          return false;
+        }
+        if (out != nullptr) {
+          out->boolean(x);
+        }
+        return true;
+      }
+
+      bool Int(int x)           { return Int64((int64_t)x); }
+      bool Uint(unsigned int x) { return Int64((int64_t)x); }
+      bool Uint64(uint64_t x)   { return Int64((int64_t)x); }
+
+      bool Int64(int64_t x) {
+        JsonFiller* out;
+        if (skipping_ > 0) {
+          return true;
+        }
+        if (!target(JsonFiller::kInt, out)) {
+          return false;
+        }
+        if (out != nullptr) {
+          out->integer(x);
+        }
+        return true;
+      }
+
+      bool Double(double x) {
+        JsonFiller* out;
+        if (skipping_ > 0) {
+          return true;
+        }
+        if (!target(JsonFiller::kReal, out)) {
+          return false;
+        }
+        if (out != nullptr) {
+          out->real(x);
+        }
+        return true;
+      }
+
+      bool
+      String(const char* str, rj::SizeType length, bool) {
+        JsonFiller* out;
+        if (skipping_ > 0) {
+          return true;
+        }
+        if (!target(JsonFiller::kString, out)) {
+          return false;
+        }
+        if (out != nullptr) {
+          out->string(str, (int64_t)length);
+        }
+        return true;
+      }
+
+      bool
+      StartArray() {
+        if (first_) {
+          first_ = false;
+          return true;
+        }
+        return start(JsonFiller::kList);
+      }
+
+      bool
+      EndArray(rj::SizeType) {
+        return stop();
+      }
+
+      bool
+      StartObject() {
+        return start(JsonFiller::kRecord);
+      }
+
+      bool
+      EndObject(rj::SizeType) {
+        return stop();
+      }
+
+      bool
+      Key(const char* str, rj::SizeType, bool) {
+        if (skipping_ > 0) {
+          return true;
+        }
+        error_ = stack_.back()->field(str);
+        return error_.empty();
+      }
+
+    private:
+      // Finds the filler for the next value (nullptr if it is to be skipped)
+      // or returns false if the value does not match the type.
+      bool
+      target(JsonFiller::Kind kind, JsonFiller*& out) {
+        JsonFiller* next = stack_.empty() ? root_.get()
+                                          : stack_.back()->child();
+        first_ = false;
+        out = nullptr;
+        if (next == nullptr) {
+          return true;
+        }
+        bool filled;
+        out = next->accept(kind, filled);
+        if (out == nullptr) {
+          error_ = std::string("expected a value of type ")
+                   + next->type().get()->tostring()
+                   + std::string(", found ") + kindname(kind);
+          return false;
+        }
+        if (filled) {
+          out = nullptr;
+        }
+        return true;
+      }
+
+      bool
+      start(JsonFiller::Kind kind) {
+        JsonFiller* out;
+        if (skipping_ > 0) {
+          skipping_++;
+          return true;
+        }
+        if (!target(kind, out)) {
+          return false;
+        }
+        if (out == nullptr) {
+          skipping_ = 1;
+        }
+        else {
+          out->begin();
+          stack_.push_back(out);
+        }
+        return true;
+      }
+
+      bool
+      stop() {
+        if (skipping_ > 0) {
+          skipping_--;
+          return true;
+        }
+        if (stack_.empty()) {
+          return true;   // end of the top-level array
+        }
+        error_ = stack_.back()->end();
+        stack_.pop_back();
+        return error_.empty();
+      }
+
+      static const std::string
+      kindname(JsonFiller::Kind kind) {
+        switch (kind) {
+          case JsonFiller::kNull:   return std::string("null");
+          case JsonFiller::kBool:   return std::string("a boolean");
+          case JsonFiller::kInt:    return std::string("an integer");
+          case JsonFiller::kReal:   return std::string("a real number");
+          case JsonFiller::kString: return std::string("a string");
+          case JsonFiller::kList:   return std::string("a list");
+          default:                  return std::string("a record");
+        }
+      }
+
+      JsonFillerPtr root_;
+      std::vector<JsonFiller*> stack_;
+      bool first_;
+      int64_t skipping_;
+      std::string error_;
+    };
+
+    template <typename STREAM>
+    const ContentPtr
+    json_typed_parse(STREAM& stream,
+                     const TypePtr& type,
+                     const ArrayBuilderOptions& options,
+                     bool nullfill) {
+      TypedHandler handler(type, options, nullfill);
+      rj::Reader reader;
+      if (reader.Parse(stream, handler)) {
+        return handler.snapshot();
+      }
+      else if (!handler.error().empty()) {
+        throw std::invalid_argument(
+          std::string("JSON does not match type at char ")
+          + std::to_string(reader.GetErrorOffset()) + std::string(": ")
+          + handler.error());
+      }
+      else {
+        throw std::invalid_argument(
+          std::string("JSON error at char ")
+          + std::to_string(reader.GetErrorOffset()) + std::string(": ")
+          + std::string(rj::GetParseError_En(reader.GetParseErrorCode())));
+      }
+    }
+  }
+
+  const ContentPtr
+  FromJsonString(const char* source,
+                 const TypePtr& type,
+                 const ArrayBuilderOptions& options,
+                 bool nullfill) {
+    rj::StringStream stream(source);
+    return json_typed_parse(stream, type, options, nullfill);
+  }
+
+  const ContentPtr
+  FromJsonFile(FILE* source,
+               const TypePtr& type,
+               const ArrayBuilderOptions& options,
+               int64_t buffersize,
+               bool nullfill) {
+    std::shared_ptr<char> buffer(allocate_array<char>(buffersize));
+    rj::FileReadStream stream(source,
+                              buffer.get(),
+                              ((size_t)buffersize)*sizeof(char));
+    return json_typed_parse(stream, type, options, nullfill);
+  }
+
+  class FromJsonLinesFile::Impl {
+  public:
+    Impl(FILE* source,
+         const ArrayBuilderOptions& options,
+         int64_t buffersize,
+         int64_t maxrecords,
+         int64_t maxbytes)
+        : handler_(options, true)
+        , buffer_(allocate_array<char>(buffersize))
+        , stream_(source, buffer_.get(), ((size_t)buffersize)*sizeof(char))
+        , maxrecords_(maxrecords)
+        , maxbytes_(maxbytes)
+        , line_(0) { }
+
+    const ContentPtr
+    next() {
+      size_t start = stream_.Tell();
+      int64_t records = 0;
+      while (true) {
+        char c = stream_.Peek();
+        while (c == ' '  ||  c == '\n'  ||  c == '\r'  ||  c == '\t') {
+          stream_.Take();
+          c = stream_.Peek();
+        }
+        if (c == '\0') {
+          break;
+        }
+        if (!reader_.Parse<rj::kParseStopWhenDoneFlag>(stream_, handler_)) {
+          throw std::invalid_argument(
+            std::string("JSON error in value ") + std::to_string(line_)
+            + std::string(" at char ")
+            + std::to_string(reader_.GetErrorOffset()) + std::string(": ")
+            + std::string(rj::GetParseError_En(
+                            reader_.GetParseErrorCode())));
+        }
+        line_++;
+        records++;
+        if ((maxrecords_ > 0  &&  records >= maxrecords_)  ||
+            (maxbytes_ > 0  &&
+             (int64_t)(stream_.Tell() - start) >= maxbytes_)) {
+          break;
+        }
+      }
+      if (records == 0) {
+        return ContentPtr(nullptr);
+      }
+      return handler_.finish();
+    }
+
+  private:
+    Handler handler_;
+    rj::Reader reader_;
+    std::shared_ptr<char> buffer_;
+    rj::FileReadStream stream_;
+    const int64_t maxrecords_;
+    const int64_t maxbytes_;
+    int64_t line_;
+  };
+
+  FromJsonLinesFile::FromJsonLinesFile(FILE* source,
+                                       const ArrayBuilderOptions& options,
+                                       int64_t buffersize,
+                                       int64_t maxrecords,
+                                       int64_t maxbytes)
+      : impl_(new FromJsonLinesFile::Impl(source,
+                                          options,
+                                          buffersize,
+                                          maxrecords,
+                                          maxbytes)) { }
+
+  FromJsonLinesFile::~FromJsonLinesFile() {
+    delete impl_;
+  }
+
+  const ContentPtr
+  FromJsonLinesFile::next() {
+    return impl_->next();
   }
 }
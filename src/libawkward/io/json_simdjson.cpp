@@ -0,0 +1,158 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifdef AWKWARD_SIMDJSON
+#include "simdjson.h"
+#include "simdjson.cpp"
+#endif
+
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/Content.h"
+
+#include "awkward/io/json.h"
+
+namespace awkward {
+#ifdef AWKWARD_SIMDJSON
+  namespace sj = simdjson;
+
+  // Walks the parsed tape, calling the ArrayBuilder for each value; there is
+  // no intermediate handler between the parser and the builder.
+  void
+  simdjson_walk(ArrayBuilder& builder, const sj::dom::element& element) {
+    switch (element.type()) {
+      case sj::dom::element_type::ARRAY: {
+        sj::dom::array array = element.get_array().value_unsafe();
+        builder.beginlist();
+        for (sj::dom::element item : array) {
+          simdjson_walk(builder, item);
+        }
+        builder.endlist();
+        break;
+      }
+      case sj::dom::element_type::OBJECT: {
+        sj::dom::object object = element.get_object().value_unsafe();
+        builder.beginrecord();
+        for (sj::dom::key_value_pair field : object) {
+          // Keys in simdjson's string buffer are null-terminated.
+          builder.field_check(field.key.data());
+          simdjson_walk(builder, field.value);
+        }
+        builder.endrecord();
+        break;
+      }
+      case sj::dom::element_type::INT64:
+        builder.integer(element.get_int64().value_unsafe());
+        break;
+      case sj::dom::element_type::UINT64:
+        builder.integer((int64_t)element.get_uint64().value_unsafe());
+        break;
+      case sj::dom::element_type::DOUBLE:
+        builder.real(element.get_double().value_unsafe());
+        break;
+      case sj::dom::element_type::STRING: {
+        std::string_view x = element.get_string().value_unsafe();
+        builder.string(x.data(), (int64_t)x.size());
+        break;
+      }
+      case sj::dom::element_type::BOOL:
+        builder.boolean(element.get_bool().value_unsafe());
+        break;
+      case sj::dom::element_type::NULL_VALUE:
+        builder.null();
+        break;
+    }
+  }
+
+  // Same top-level conventions as the rapidjson Handler: the items of a
+  // top-level array are the items of the output and a top-level record is
+  // wrapped in a list.
+  const ContentPtr
+  simdjson_build(sj::dom::parser& parser,
+                 const char* source,
+                 size_t length,
+                 bool realloc_if_needed,
+                 const ArrayBuilderOptions& options) {
+    sj::dom::element document;
+    sj::error_code error =
+      parser.parse(source, length, realloc_if_needed).get(document);
+    if (error) {
+      throw std::invalid_argument(
+        std::string("JSON error: ") + std::string(sj::error_message(error)));
+    }
+    ArrayBuilder builder(options);
+    if (document.type() == sj::dom::element_type::ARRAY) {
+      sj::dom::array array = document.get_array().value_unsafe();
+      for (sj::dom::element item : array) {
+        simdjson_walk(builder, item);
+      }
+    }
+    else if (document.type() == sj::dom::element_type::OBJECT) {
+      builder.beginlist();
+      simdjson_walk(builder, document);
+      builder.endlist();
+    }
+    else {
+      simdjson_walk(builder, document);
+    }
+    return builder.finish(true);
+  }
+
+  bool
+  SimdJsonAvailable() {
+    return true;
+  }
+
+  const ContentPtr
+  FromJsonStringSimd(const char* source, const ArrayBuilderOptions& options) {
+    sj::dom::parser parser;
+    return simdjson_build(parser, source, strlen(source), true, options);
+  }
+
+  const ContentPtr
+  FromJsonFileSimd(FILE* source,
+                   const ArrayBuilderOptions& options,
+                   int64_t buffersize) {
+    // simdjson parses a whole document at once, so the file is read into
+    // one buffer, which is then padded (with zeros, since simdjson reads
+    // the padding) so that simdjson does not need to copy it.
+    std::string data;
+    std::string buffer((size_t)buffersize, '\0');
+    size_t count;
+    while ((count = fread(&buffer[0], 1, buffer.size(), source)) > 0) {
+      data.append(buffer.data(), count);
+    }
+    if (ferror(source)) {
+      throw std::invalid_argument("JSON error: file could not be read");
+    }
+    size_t length = data.size();
+    data.resize(length + sj::SIMDJSON_PADDING, '\0');
+    sj::dom::parser parser;
+    return simdjson_build(parser, data.data(), length, false, options);
+  }
+
+#else
+
+  bool
+  SimdJsonAvailable() {
+    return false;
+  }
+
+  const ContentPtr
+  FromJsonStringSimd(const char*, const ArrayBuilderOptions&) {
+    throw std::runtime_error(
+      "awkward was compiled without simdjson (configure with "
+      "-DAWKWARD_SIMDJSON=ON)");
+  }
+
+  const ContentPtr
+  FromJsonFileSimd(FILE*, const ArrayBuilderOptions&, int64_t) {
+    throw std::runtime_error(
+      "awkward was compiled without simdjson (configure with "
+      "-DAWKWARD_SIMDJSON=ON)");
+  }
+
+#endif
+}
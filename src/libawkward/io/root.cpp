@@ -1,50 +1,159 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <algorithm>
 #include <cstring>
+#include <stdexcept>
 
+#include "awkward/cpu-kernels/parallel.h"
+#include "awkward/Allocator.h"
 #include "awkward/Content.h"
 #include "awkward/Identities.h"
 #include "awkward/array/ListOffsetArray.h"
-#include "awkward/builder/GrowableBuffer.h"
 
 #include "awkward/io/root.h"
 
 namespace awkward {
-  void
-  FromROOT_nestedvector_fill(std::vector<GrowableBuffer<int64_t>>& levels,
-                             GrowableBuffer<int64_t>& bytepos_tocopy,
-                             int64_t& bytepos,
-                             const NumpyArray& rawdata,
-                             int64_t whichlevel,
-                             int64_t itemsize) {
-    if (whichlevel == levels.size()) {
-      bytepos_tocopy.append(bytepos);
-      bytepos += itemsize;
-    }
-
-    else {
-      uint32_t bigendian =
-        *reinterpret_cast<uint32_t*>(rawdata.byteptr((ssize_t)bytepos));
-
-      // FIXME: check native endianness
-      uint32_t length =
-        ((bigendian >> 24) & 0xff)     |  // move byte 3 to byte 0
-        ((bigendian <<  8) & 0xff0000) |  // move byte 1 to byte 2
-        ((bigendian >>  8) & 0xff00)   |  // move byte 2 to byte 1
-        ((bigendian << 24) & 0xff000000); // byte 0 to byte 3
-
-      bytepos += sizeof(int32_t);
-      for (uint32_t i = 0;  i < length;  i++) {
-        FromROOT_nestedvector_fill(levels,
-                                   bytepos_tocopy,
-                                   bytepos,
-                                   rawdata,
-                                   whichlevel + 1,
-                                   itemsize);
+  namespace {
+    // ROOT serializes each std::vector as a big-endian uint32 length followed
+    // by its items; at the innermost level, the items are the leaf values,
+    // packed without padding.
+
+    inline uint32_t
+    FromROOT_bigendian32(const uint8_t* ptr) {
+      // Compiles to a single load and bswap, without alignment assumptions.
+      return ((uint32_t)ptr[0] << 24)  |
+             ((uint32_t)ptr[1] << 16)  |
+             ((uint32_t)ptr[2] <<  8)  |
+              (uint32_t)ptr[3];
+    }
+
+    bool
+    FromROOT_native_bigendian() {
+      uint32_t one = 1;
+      return *reinterpret_cast<uint8_t*>(&one) == 0;
+    }
+
+    // First pass: counts[whichlevel + 1] += the number of items in this list,
+    // recursively. Returns false if the list runs past datalength.
+    bool
+    FromROOT_nestedvector_count(const uint8_t* data,
+                                int64_t datalength,
+                                int64_t& bytepos,
+                                int64_t whichlevel,
+                                int64_t depth,
+                                int64_t itemsize,
+                                std::vector<int64_t>& counts) {
+      if (bytepos < 0  ||  bytepos + 4 > datalength) {
+        return false;
+      }
+      int64_t length = (int64_t)FromROOT_bigendian32(&data[bytepos]);
+      bytepos += 4;
+      counts[(size_t)whichlevel + 1] += length;
+      if (whichlevel + 1 == depth) {
+        bytepos += length*itemsize;
+        return bytepos <= datalength;
+      }
+      for (int64_t i = 0;  i < length;  i++) {
+        if (!FromROOT_nestedvector_count(data,
+                                         datalength,
+                                         bytepos,
+                                         whichlevel + 1,
+                                         depth,
+                                         itemsize,
+                                         counts)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // Second pass: positions[k] is the number of lists (or, at k == depth,
+    // leaf items) before this one at each level, so every chunk of entries
+    // writes its own disjoint ranges of offsets and payload.
+    void
+    FromROOT_nestedvector_fill(const uint8_t* data,
+                               int64_t& bytepos,
+                               int64_t whichlevel,
+                               int64_t depth,
+                               int64_t itemsize,
+                               const std::vector<int64_t*>& offsets,
+                               std::vector<int64_t>& positions,
+                               uint8_t* payload) {
+      int64_t length = (int64_t)FromROOT_bigendian32(&data[bytepos]);
+      bytepos += 4;
+      if (whichlevel + 1 == depth) {
+        std::memcpy(&payload[positions[(size_t)depth]*itemsize],
+                    &data[bytepos],
+                    (size_t)(length*itemsize));
+        bytepos += length*itemsize;
+        positions[(size_t)depth] += length;
+      }
+      else {
+        for (int64_t i = 0;  i < length;  i++) {
+          FromROOT_nestedvector_fill(data,
+                                     bytepos,
+                                     whichlevel + 1,
+                                     depth,
+                                     itemsize,
+                                     offsets,
+                                     positions,
+                                     payload);
+        }
+      }
+      int64_t& position = positions[(size_t)whichlevel];
+      offsets[(size_t)whichlevel][position + 1] =
+        positions[(size_t)whichlevel + 1];
+      position++;
+    }
+
+    // Plain loops over fixed-width words: compilers recognize the shifts as
+    // byte swaps and vectorize them.
+    void
+    FromROOT_byteswap(uint8_t* data, int64_t length, int64_t itemsize) {
+      switch (itemsize) {
+      case 1:
+        break;
+      case 2: {
+        uint16_t* x = reinterpret_cast<uint16_t*>(data);
+        for (int64_t i = 0;  i < length;  i++) {
+          x[i] = (uint16_t)((x[i] >> 8) | (x[i] << 8));
+        }
+        break;
+      }
+      case 4: {
+        uint32_t* x = reinterpret_cast<uint32_t*>(data);
+        for (int64_t i = 0;  i < length;  i++) {
+          uint32_t y = x[i];
+          x[i] = ((y >> 24) & 0x000000ffu)  |
+                 ((y >>  8) & 0x0000ff00u)  |
+                 ((y <<  8) & 0x00ff0000u)  |
+                 ((y << 24) & 0xff000000u);
+        }
+        break;
+      }
+      case 8: {
+        uint64_t* x = reinterpret_cast<uint64_t*>(data);
+        for (int64_t i = 0;  i < length;  i++) {
+          uint64_t y = x[i];
+          x[i] = ((y >> 56) & 0x00000000000000ffull)  |
+                 ((y >> 40) & 0x000000000000ff00ull)  |
+                 ((y >> 24) & 0x0000000000ff0000ull)  |
+                 ((y >>  8) & 0x00000000ff000000ull)  |
+                 ((y <<  8) & 0x000000ff00000000ull)  |
+                 ((y << 24) & 0x0000ff0000000000ull)  |
+                 ((y << 40) & 0x00ff000000000000ull)  |
+                 ((y << 56) & 0xff00000000000000ull);
+        }
+        break;
+      }
+      default:
+        for (int64_t i = 0;  i < length;  i++) {
+          uint8_t* x = &data[i*itemsize];
+          for (int64_t j = 0;  j < itemsize / 2;  j++) {
+            std::swap(x[j], x[itemsize - 1 - j]);
+          }
+        }
       }
-      int64_t previous = levels[(unsigned int)whichlevel].getitem_at_nowrap(
-        levels[(unsigned int)whichlevel].length() - 1);
-      levels[(unsigned int)whichlevel].append(previous + length);
     }
   }
 
@@ -54,50 +163,115 @@ namespace awkward {
                         int64_t depth,
                         int64_t itemsize,
                         std::string format,
-                        const ArrayBuilderOptions& options) {
+                        const ArrayBuilderOptions&) {
     if (depth <= 0) {
       throw std::runtime_error("FromROOT_nestedvector: depth <= 0");
     }
     if (rawdata.ndim() != 1) {
       throw std::runtime_error("FromROOT_nestedvector: rawdata.ndim() != 1");
     }
+    if (itemsize <= 0) {
+      throw std::runtime_error("FromROOT_nestedvector: itemsize <= 0");
+    }
+    if (!rawdata.iscontiguous()) {
+      throw std::runtime_error(
+        "FromROOT_nestedvector: rawdata is not contiguous");
+    }
 
-    Index64 level0(byteoffsets.length());
-    level0.setitem_at_nowrap(0, 0);
-
-    std::vector<GrowableBuffer<int64_t>> levels;
-    for (int64_t i = 0;  i < depth;  i++) {
-      levels.push_back(GrowableBuffer<int64_t>(options));
-      levels[(size_t)i].append(0);
+    // The payload is returned in native byte order.
+    bool byteswap = false;
+    if (!format.empty()  &&  (format[0] == '>'  ||  format[0] == '!')) {
+      byteswap = !FromROOT_native_bigendian();
+      format = format.substr(1);
+    }
+    else if (!format.empty()  &&  format[0] == '<') {
+      byteswap = FromROOT_native_bigendian();
+      format = format.substr(1);
     }
 
-    GrowableBuffer<int64_t> bytepos_tocopy(options);
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(rawdata.byteptr());
+    int64_t datalength = rawdata.length()*rawdata.itemsize();
+    int64_t numentries = byteoffsets.length() - 1;
+    if (numentries < 0) {
+      numentries = 0;
+    }
 
-    for (int64_t i = 0;  i < byteoffsets.length() - 1;  i++) {
-      int64_t bytepos = byteoffsets.getitem_at_nowrap(i);
-      FromROOT_nestedvector_fill(levels,
-                                 bytepos_tocopy,
-                                 bytepos,
-                                 rawdata,
-                                 0,
-                                 itemsize);
-      level0.setitem_at_nowrap(i + 1, levels[0].length());
+    // Entries are split into the same contiguous chunks in both passes.
+    int64_t numchunks = awkward_parallel_numchunks(numentries);
+    std::vector<std::vector<int64_t>> starts((size_t)numchunks + 1,
+                                             std::vector<int64_t>(
+                                               (size_t)depth + 1, 0));
+    std::vector<int64_t> failures((size_t)numchunks, -1);
+    awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+      int64_t start = (numentries * chunk) / numchunks;
+      int64_t stop = (numentries * (chunk + 1)) / numchunks;
+      std::vector<int64_t>& counts = starts[(size_t)chunk + 1];
+      counts[0] = stop - start;
+      for (int64_t i = start;  i < stop;  i++) {
+        int64_t bytepos = byteoffsets.getitem_at_nowrap(i);
+        if (!FromROOT_nestedvector_count(data,
+                                         datalength,
+                                         bytepos,
+                                         0,
+                                         depth,
+                                         itemsize,
+                                         counts)) {
+          failures[(size_t)chunk] = i;
+          return;
+        }
+      }
+    });
+    for (auto i : failures) {
+      if (i >= 0) {
+        throw std::invalid_argument(
+          std::string("FromROOT_nestedvector: entry ") + std::to_string(i)
+          + std::string(" runs past the end of rawdata"));
+      }
     }
+    for (int64_t chunk = 0;  chunk < numchunks;  chunk++) {
+      for (int64_t k = 0;  k <= depth;  k++) {
+        starts[(size_t)chunk + 1][(size_t)k] +=
+          starts[(size_t)chunk][(size_t)k];
+      }
+    }
+    const std::vector<int64_t>& totals = starts[(size_t)numchunks];
 
+    // Exact sizes are known, so nothing is grown or copied twice.
+    std::vector<Index64> levels;
+    std::vector<int64_t*> offsets;
+    for (int64_t k = 0;  k < depth;  k++) {
+      levels.push_back(Index64(totals[(size_t)k] + 1));
+      offsets.push_back(levels.back().ptr().get());
+      offsets.back()[0] = 0;
+    }
     std::shared_ptr<void> ptr(
-      new uint8_t[(size_t)(bytepos_tocopy.length()*itemsize)],
-      util::array_deleter<uint8_t>());
-    ssize_t offset = rawdata.byteoffset();
-    uint8_t* toptr = reinterpret_cast<uint8_t*>(ptr.get());
-    uint8_t* fromptr = reinterpret_cast<uint8_t*>(rawdata.ptr().get());
-    for (int64_t i = 0;  i < bytepos_tocopy.length();  i++) {
-      ssize_t bytepos = (ssize_t)bytepos_tocopy.getitem_at_nowrap(i);
-      std::memcpy(&toptr[(ssize_t)(i*itemsize)],
-                  &fromptr[offset + bytepos],
-                  (size_t)itemsize);
-    }
-
-    std::vector<ssize_t> shape = { (ssize_t)bytepos_tocopy.length() };
+      allocate_array<uint8_t>(totals[(size_t)depth]*itemsize));
+    uint8_t* payload = reinterpret_cast<uint8_t*>(ptr.get());
+
+    awkward_parallel_run(numchunks, [&](int64_t chunk) -> void {
+      int64_t start = (numentries * chunk) / numchunks;
+      int64_t stop = (numentries * (chunk + 1)) / numchunks;
+      std::vector<int64_t> positions = starts[(size_t)chunk];
+      for (int64_t i = start;  i < stop;  i++) {
+        int64_t bytepos = byteoffsets.getitem_at_nowrap(i);
+        FromROOT_nestedvector_fill(data,
+                                   bytepos,
+                                   0,
+                                   depth,
+                                   itemsize,
+                                   offsets,
+                                   positions,
+                                   payload);
+      }
+      if (byteswap) {
+        int64_t leafstart = starts[(size_t)chunk][(size_t)depth];
+        FromROOT_byteswap(&payload[leafstart*itemsize],
+                          positions[(size_t)depth] - leafstart,
+                          itemsize);
+      }
+    });
+
+    std::vector<ssize_t> shape = { (ssize_t)totals[(size_t)depth] };
     std::vector<ssize_t> strides = { (ssize_t)itemsize };
     ContentPtr out = std::make_shared<NumpyArray>(Identities::none(),
                                                   util::Parameters(),
@@ -108,11 +282,10 @@ namespace awkward {
                                                   (ssize_t)itemsize,
                                                   format);
 
-    for (int64_t i = depth - 1;  i >= 0;  i--) {
-      Index64 index(levels[(size_t)i].ptr(), 0, levels[(size_t)i].length());
+    for (int64_t k = depth - 1;  k >= 0;  k--) {
       out = std::make_shared<ListOffsetArray64>(Identities::none(),
                                                 util::Parameters(),
-                                                index,
+                                                levels[(size_t)k],
                                                 out);
     }
     return out;
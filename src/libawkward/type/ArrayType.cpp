@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <string>
 
 #include "awkward/type/ArrayType.h"
@@ -32,6 +33,9 @@ namespace awkward {
 
   bool
   ArrayType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (ArrayType* t = dynamic_cast<ArrayType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -44,6 +48,26 @@ namespace awkward {
     }
   }
 
+  bool
+  ArrayType::identical(const TypePtr& other) const {
+    if (ArrayType* t = dynamic_cast<ArrayType*>(other.get())) {
+      return (identical_parameters(*t)  &&
+              length_ == t->length_  &&
+              (type_.get() == t->type_.get()  ||
+               type_.get()->identical(t->type_)));
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  ArrayType::hash_part() const {
+    size_t out = hash_parameters(std::hash<std::string>()("ArrayType"));
+    out = hash_combine(out, std::hash<int64_t>()(length_));
+    return hash_combine(out, type_.get()->hash());
+  }
+
   int64_t
   ArrayType::numfields() const {
     return type_.get()->numfields();
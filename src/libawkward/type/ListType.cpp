@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <string>
 #include <sstream>
 
@@ -45,6 +46,9 @@ namespace awkward {
 
   bool
   ListType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (ListType* t = dynamic_cast<ListType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -56,6 +60,24 @@ namespace awkward {
     }
   }
 
+  bool
+  ListType::identical(const TypePtr& other) const {
+    if (ListType* t = dynamic_cast<ListType*>(other.get())) {
+      return (identical_parameters(*t)  &&
+              (type_.get() == t->type_.get()  ||
+               type_.get()->identical(t->type_)));
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  ListType::hash_part() const {
+    size_t out = hash_parameters(std::hash<std::string>()("ListType"));
+    return hash_combine(out, type_.get()->hash());
+  }
+
   int64_t
   ListType::numfields() const {
     return type_.get()->numfields();
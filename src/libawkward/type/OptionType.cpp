@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <string>
 #include <sstream>
 
@@ -54,6 +55,9 @@ namespace awkward {
 
   bool
   OptionType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (OptionType* t = dynamic_cast<OptionType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -65,6 +69,24 @@ namespace awkward {
     }
   }
 
+  bool
+  OptionType::identical(const TypePtr& other) const {
+    if (OptionType* t = dynamic_cast<OptionType*>(other.get())) {
+      return (identical_parameters(*t)  &&
+              (type_.get() == t->type_.get()  ||
+               type_.get()->identical(t->type_)));
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  OptionType::hash_part() const {
+    size_t out = hash_parameters(std::hash<std::string>()("OptionType"));
+    return hash_combine(out, type_.get()->hash());
+  }
+
   int64_t
   OptionType::numfields() const {
     return type_.get()->numfields();
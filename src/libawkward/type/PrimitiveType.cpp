@@ -1,7 +1,9 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <sstream>
 
+#include "awkward/Allocator.h"
 #include "awkward/array/NumpyArray.h"
 #include "awkward/type/UnknownType.h"
 #include "awkward/type/OptionType.h"
@@ -15,6 +17,51 @@ namespace awkward {
       : Type(parameters, typestr)
       , dtype_(dtype) { }
 
+  const std::string
+  PrimitiveType::format(DType dtype) {
+    switch (dtype) {
+      case boolean: return "?";
+      case int8:    return "b";
+      case uint8:   return "B";
+      case int16:   return "h";
+      case uint16:  return "H";
+#if defined _MSC_VER || defined __i386__
+      case int32:   return "l";
+      case uint32:  return "L";
+      case int64:   return "q";
+      case uint64:  return "Q";
+#else
+      case int32:   return "i";
+      case uint32:  return "I";
+      case int64:   return "l";
+      case uint64:  return "L";
+#endif
+      case float32: return "f";
+      case float64: return "d";
+      default: throw std::runtime_error(
+                 std::string("unexpected dtype: ") + std::to_string(dtype));
+    }
+  }
+
+  int64_t
+  PrimitiveType::itemsize(DType dtype) {
+    switch (dtype) {
+      case boolean: return 1;
+      case int8:    return 1;
+      case uint8:   return 1;
+      case int16:   return 2;
+      case uint16:  return 2;
+      case int32:   return 4;
+      case uint32:  return 4;
+      case int64:   return 8;
+      case uint64:  return 8;
+      case float32: return 4;
+      case float64: return 8;
+      default: throw std::runtime_error(
+                 std::string("unexpected dtype: ") + std::to_string(dtype));
+    }
+  }
+
   std::string
   PrimitiveType::tostring_part(const std::string& indent,
                                const std::string& pre,
@@ -56,6 +103,9 @@ namespace awkward {
 
   bool
   PrimitiveType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (PrimitiveType* t = dynamic_cast<PrimitiveType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -67,6 +117,22 @@ namespace awkward {
     }
   }
 
+  bool
+  PrimitiveType::identical(const TypePtr& other) const {
+    if (PrimitiveType* t = dynamic_cast<PrimitiveType*>(other.get())) {
+      return identical_parameters(*t)  &&  dtype_ == t->dtype_;
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  PrimitiveType::hash_part() const {
+    size_t out = hash_parameters(std::hash<std::string>()("PrimitiveType"));
+    return hash_combine(out, (size_t)dtype_);
+  }
+
   int64_t
   PrimitiveType::numfields() const {
     return -1;
@@ -94,41 +160,17 @@ namespace awkward {
 
   const ContentPtr
   PrimitiveType::empty() const {
-    std::shared_ptr<void> ptr(new uint8_t[0], util::array_deleter<uint8_t>());
+    std::shared_ptr<void> ptr(allocate_array<uint8_t>(0));
     std::vector<ssize_t> shape({ 0 });
     std::vector<ssize_t> strides({ 0 });
-    ssize_t itemsize;
-    std::string format;
-    switch (dtype_) {
-      case boolean: itemsize = 1; format = "?"; break;
-      case int8:    itemsize = 1; format = "b"; break;
-      case uint8:   itemsize = 1; format = "B"; break;
-      case int16:   itemsize = 2; format = "h"; break;
-      case uint16:  itemsize = 2; format = "H"; break;
-#if defined _MSC_VER || defined __i386__
-      case int32:   itemsize = 4; format = "l"; break;
-      case uint32:  itemsize = 4; format = "L"; break;
-      case int64:   itemsize = 8; format = "q"; break;
-      case uint64:  itemsize = 8; format = "Q"; break;
-#else
-      case int32:   itemsize = 4; format = "i"; break;
-      case uint32:  itemsize = 4; format = "I"; break;
-      case int64:   itemsize = 8; format = "l"; break;
-      case uint64:  itemsize = 8; format = "L"; break;
-#endif
-      case float32: itemsize = 4; format = "f"; break;
-      case float64: itemsize = 8; format = "d"; break;
-      default: throw std::runtime_error(
-                 std::string("unexpected dtype: ") + std::to_string(dtype_));
-    }
     return std::make_shared<NumpyArray>(Identities::none(),
                                         parameters_,
                                         ptr,
                                         shape,
                                         strides,
                                         0,
-                                        itemsize,
-                                        format);
+                                        (ssize_t)itemsize(dtype_),
+                                        format(dtype_));
   }
 
   const PrimitiveType::DType
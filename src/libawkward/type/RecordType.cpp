@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <string>
 #include <sstream>
 
@@ -121,6 +122,9 @@ namespace awkward {
 
   bool
   RecordType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (RecordType* t = dynamic_cast<RecordType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -159,6 +163,47 @@ namespace awkward {
     }
   }
 
+  bool
+  RecordType::identical(const TypePtr& other) const {
+    if (RecordType* t = dynamic_cast<RecordType*>(other.get())) {
+      if (!identical_parameters(*t)  ||  types_.size() != t->types_.size()) {
+        return false;
+      }
+      if (istuple() != t->istuple()) {
+        return false;
+      }
+      if (!istuple()  &&
+          recordlookup_.get() != t->recordlookup_.get()  &&
+          *recordlookup_.get() != *t->recordlookup_.get()) {
+        return false;
+      }
+      for (size_t i = 0;  i < types_.size();  i++) {
+        if (types_[i].get() != t->types_[i].get()  &&
+            !types_[i].get()->identical(t->types_[i])) {
+          return false;
+        }
+      }
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  RecordType::hash_part() const {
+    size_t out = hash_parameters(std::hash<std::string>()("RecordType"));
+    if (!istuple()) {
+      for (auto key : *recordlookup_.get()) {
+        out = hash_combine(out, std::hash<std::string>()(key));
+      }
+    }
+    for (auto type : types_) {
+      out = hash_combine(out, type.get()->hash());
+    }
+    return out;
+  }
+
   int64_t
   RecordType::numfields() const {
     return (int64_t)types_.size();
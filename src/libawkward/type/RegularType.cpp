@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <string>
 #include <sstream>
 
@@ -47,6 +48,9 @@ namespace awkward {
 
   bool
   RegularType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (RegularType* t = dynamic_cast<RegularType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -59,6 +63,26 @@ namespace awkward {
     }
   }
 
+  bool
+  RegularType::identical(const TypePtr& other) const {
+    if (RegularType* t = dynamic_cast<RegularType*>(other.get())) {
+      return (identical_parameters(*t)  &&
+              size_ == t->size_  &&
+              (type_.get() == t->type_.get()  ||
+               type_.get()->identical(t->type_)));
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  RegularType::hash_part() const {
+    size_t out = hash_parameters(std::hash<std::string>()("RegularType"));
+    out = hash_combine(out, std::hash<int64_t>()(size_));
+    return hash_combine(out, type_.get()->hash());
+  }
+
   int64_t
   RegularType::numfields() const {
     return type_.get()->numfields();
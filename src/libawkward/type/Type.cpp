@@ -1,7 +1,12 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 
 #include "rapidjson/document.h"
 
@@ -17,9 +22,63 @@ namespace awkward {
     return TypePtr(nullptr);
   }
 
+  const TypePtr
+  Type::intern(const TypePtr& type) {
+    if (type.get() == nullptr) {
+      return type;
+    }
+    // Function-local, so that they exist before any static Type is made.
+    static std::mutex mutex;
+    static std::unordered_multimap<size_t, std::weak_ptr<Type>> interned;
+    static size_t nextsweep = 1024;
+
+    size_t hash = type.get()->hash();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = interned.equal_range(hash);
+    for (auto it = range.first;  it != range.second;  ) {
+      TypePtr existing = it->second.lock();
+      if (existing.get() == nullptr) {
+        it = interned.erase(it);
+      }
+      else if (existing.get() == type.get()  ||
+               existing.get()->identical(type)) {
+        return existing;
+      }
+      else {
+        ++it;
+      }
+    }
+    type.get()->interned_ = true;
+    type.get()->hash_ = hash;
+    interned.emplace(hash, type);
+
+    // Entries for types that have since been deleted are only found by
+    // hash, so sweep them all whenever the table has doubled.
+    if (interned.size() >= nextsweep) {
+      for (auto it = interned.begin();  it != interned.end();  ) {
+        if (it->second.expired()) {
+          it = interned.erase(it);
+        }
+        else {
+          ++it;
+        }
+      }
+      nextsweep = std::max((size_t)1024, 2*interned.size());
+    }
+    return type;
+  }
+
   Type::Type(const util::Parameters& parameters, const std::string& typestr)
       : parameters_(parameters)
-      , typestr_(typestr) { }
+      , typestr_(typestr)
+      , interned_(false)
+      , hash_(0) { }
+
+  Type::Type(const Type& other)
+      : parameters_(other.parameters_)
+      , typestr_(other.typestr_)
+      , interned_(false)
+      , hash_(0) { }
 
   Type::~Type() { }
 
@@ -33,8 +92,17 @@ namespace awkward {
     return typestr_;
   }
 
+  size_t
+  Type::hash() const {
+    return interned_ ? hash_ : hash_part();
+  }
+
   void
   Type::setparameters(const util::Parameters& parameters) {
+    if (interned_) {
+      throw std::runtime_error(
+        "cannot modify an interned type in place; modify a copy instead");
+    }
     parameters_ = parameters;
   }
 
@@ -49,6 +117,10 @@ namespace awkward {
 
   void
   Type::setparameter(const std::string& key, const std::string& value) {
+    if (interned_) {
+      throw std::runtime_error(
+        "cannot modify an interned type in place; modify a copy instead");
+    }
     parameters_[key] = value;
   }
 
@@ -85,6 +157,28 @@ namespace awkward {
     }
   }
 
+  size_t
+  Type::hash_parameters(size_t seed) const {
+    seed = hash_combine(seed, std::hash<std::string>()(typestr_));
+    for (auto pair : parameters_) {
+      seed = hash_combine(seed, std::hash<std::string>()(pair.first));
+      seed = hash_combine(seed, std::hash<std::string>()(pair.second));
+    }
+    return seed;
+  }
+
+  bool
+  Type::identical_parameters(const Type& other) const {
+    // exact JSON strings, not JSON equality as in parameters_equal
+    return typestr_ == other.typestr_  &&  parameters_ == other.parameters_;
+  }
+
+  size_t
+  Type::hash_combine(size_t seed, size_t value) {
+    return seed ^ (value + (size_t)0x9e3779b97f4a7c15ull
+                   + (seed << 6) + (seed >> 2));
+  }
+
   const std::string
   Type::string_parameters() const {
     std::stringstream out;
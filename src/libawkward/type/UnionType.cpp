@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <string>
 #include <sstream>
 
@@ -47,6 +48,9 @@ namespace awkward {
 
   bool
   UnionType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (UnionType* t = dynamic_cast<UnionType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -66,6 +70,34 @@ namespace awkward {
     }
   }
 
+  bool
+  UnionType::identical(const TypePtr& other) const {
+    if (UnionType* t = dynamic_cast<UnionType*>(other.get())) {
+      if (!identical_parameters(*t)  ||  types_.size() != t->types_.size()) {
+        return false;
+      }
+      for (size_t i = 0;  i < types_.size();  i++) {
+        if (types_[i].get() != t->types_[i].get()  &&
+            !types_[i].get()->identical(t->types_[i])) {
+          return false;
+        }
+      }
+      return true;
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  UnionType::hash_part() const {
+    size_t out = hash_parameters(std::hash<std::string>()("UnionType"));
+    for (auto type : types_) {
+      out = hash_combine(out, type.get()->hash());
+    }
+    return out;
+  }
+
   int64_t
   UnionType::numtypes() const {
     return (int64_t)types_.size();
@@ -1,5 +1,6 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <functional>
 #include <string>
 #include <sstream>
 
@@ -37,6 +38,9 @@ namespace awkward {
 
   bool
   UnknownType::equal(const TypePtr& other, bool check_parameters) const {
+    if (other.get() == this) {
+      return true;
+    }
     if (UnknownType* t = dynamic_cast<UnknownType*>(other.get())) {
       if (check_parameters  &&  !parameters_equal(other.get()->parameters())) {
         return false;
@@ -48,6 +52,21 @@ namespace awkward {
     }
   }
 
+  bool
+  UnknownType::identical(const TypePtr& other) const {
+    if (UnknownType* t = dynamic_cast<UnknownType*>(other.get())) {
+      return identical_parameters(*t);
+    }
+    else {
+      return false;
+    }
+  }
+
+  size_t
+  UnknownType::hash_part() const {
+    return hash_parameters(std::hash<std::string>()("UnknownType"));
+  }
+
   int64_t
   UnknownType::numfields() const {
     return -1;
@@ -10,6 +10,8 @@
 #include "awkward/builder/ArrayBuilderOptions.h"
 #include "awkward/io/json.h"
 #include "awkward/io/root.h"
+#include "awkward/io/binary.h"
+#include "awkward/type/Type.h"
 
 namespace py = pybind11;
 namespace ak = awkward;
@@ -22,7 +24,19 @@ make_fromjson(py::module& m, const std::string& name) {
         [](const std::string& source,
            int64_t initial,
            double resize,
-           int64_t buffersize) -> std::shared_ptr<ak::Content> {
+           int64_t buffersize,
+           bool simdjson,
+           const py::object& type,
+           bool nullfill) -> std::shared_ptr<ak::Content> {
+    std::shared_ptr<ak::Type> knowntype(nullptr);
+    if (!type.is(py::none())) {
+      knowntype = type.cast<std::shared_ptr<ak::Type>>();
+      if (simdjson) {
+        throw std::invalid_argument(
+          "reading with a known type is not supported by the simdjson parser");
+      }
+    }
+    py::gil_scoped_release release;
     bool isarray = false;
     for (char const &x: source) {
       if (x != 9  &&  x != 10  &&  x != 13  &&  x != 32) {  // whitespace
@@ -33,6 +47,16 @@ make_fromjson(py::module& m, const std::string& name) {
       }
     }
     if (isarray) {
+      if (knowntype.get() != nullptr) {
+        return ak::FromJsonString(source.c_str(),
+                                  knowntype,
+                                  ak::ArrayBuilderOptions(initial, resize),
+                                  nullfill);
+      }
+      if (simdjson) {
+        return ak::FromJsonStringSimd(
+          source.c_str(), ak::ArrayBuilderOptions(initial, resize));
+      }
       return ak::FromJsonString(
         source.c_str(), ak::ArrayBuilderOptions(initial, resize));
     }
@@ -50,9 +74,23 @@ make_fromjson(py::module& m, const std::string& name) {
       }
       std::shared_ptr<ak::Content> out(nullptr);
       try {
-        out = FromJsonFile(file,
-                           ak::ArrayBuilderOptions(initial, resize),
-                           buffersize);
+        if (knowntype.get() != nullptr) {
+          out = ak::FromJsonFile(file,
+                                 knowntype,
+                                 ak::ArrayBuilderOptions(initial, resize),
+                                 buffersize,
+                                 nullfill);
+        }
+        else if (simdjson) {
+          out = ak::FromJsonFileSimd(file,
+                                     ak::ArrayBuilderOptions(initial, resize),
+                                     buffersize);
+        }
+        else {
+          out = ak::FromJsonFile(file,
+                                 ak::ArrayBuilderOptions(initial, resize),
+                                 buffersize);
+        }
       }
       catch (...) {
         fclose(file);
@@ -64,7 +102,100 @@ make_fromjson(py::module& m, const std::string& name) {
   }, py::arg("source"),
       py::arg("initial") = 1024,
       py::arg("resize") = 2.0,
-      py::arg("buffersize") = 65536);
+      py::arg("buffersize") = 65536,
+      py::arg("simdjson") = false,
+      py::arg("type") = py::none(),
+      py::arg("nullfill") = false);
+
+  m.def("simdjson_available", &ak::SimdJsonAvailable);
+}
+
+////////// fromjsonlines
+
+class JsonLinesFile {
+public:
+  JsonLinesFile(const std::string& source,
+                const ak::ArrayBuilderOptions& options,
+                int64_t buffersize,
+                int64_t maxrecords,
+                int64_t maxbytes) {
+#ifdef _MSC_VER
+    if (fopen_s(&file_, source.c_str(), "rb") != 0) {
+#else
+    file_ = fopen(source.c_str(), "rb");
+    if (file_ == nullptr) {
+#endif
+      throw std::invalid_argument(
+        std::string("file \"") + source
+        + std::string("\" could not be opened for reading"));
+    }
+    try {
+      reader_ = std::make_shared<ak::FromJsonLinesFile>(file_,
+                                                        options,
+                                                        buffersize,
+                                                        maxrecords,
+                                                        maxbytes);
+    }
+    catch (...) {
+      fclose(file_);
+      throw;
+    }
+  }
+
+  // It owns the FILE, so a copy would close it twice.
+  JsonLinesFile(const JsonLinesFile&) = delete;
+  JsonLinesFile&
+  operator=(const JsonLinesFile&) = delete;
+
+  ~JsonLinesFile() {
+    reader_.reset();
+    fclose(file_);
+  }
+
+  const std::shared_ptr<ak::Content>
+  next() {
+    return reader_.get()->next();
+  }
+
+private:
+  FILE* file_;
+  std::shared_ptr<ak::FromJsonLinesFile> reader_;
+};
+
+void
+make_fromjsonlines(py::module& m, const std::string& name) {
+  auto next = [](JsonLinesFile& self) -> std::shared_ptr<ak::Content> {
+    // Not thread-safe, so this keeps the GIL.
+    std::shared_ptr<ak::Content> out = self.next();
+    if (out.get() == nullptr) {
+      throw py::stop_iteration();
+    }
+    return out;
+  };
+
+  py::class_<JsonLinesFile, std::shared_ptr<JsonLinesFile>>(m, name.c_str())
+      .def(py::init([](const std::string& source,
+                       int64_t maxrecords,
+                       int64_t maxbytes,
+                       int64_t initial,
+                       double resize,
+                       int64_t buffersize) -> std::shared_ptr<JsonLinesFile> {
+        return std::make_shared<JsonLinesFile>(
+          source,
+          ak::ArrayBuilderOptions(initial, resize),
+          buffersize,
+          maxrecords,
+          maxbytes);
+      }), py::arg("source"),
+          py::arg("maxrecords") = 65536,
+          py::arg("maxbytes") = 0,
+          py::arg("initial") = 1024,
+          py::arg("resize") = 2.0,
+          py::arg("buffersize") = 65536)
+      .def("__next__", next)
+      .def("next", next)
+      .def("__iter__",
+           [](const py::object& self) -> py::object { return self; });
 }
 
 ////////// fromroot
@@ -79,6 +210,7 @@ make_fromroot_nestedvector(py::module& m, const std::string& name) {
            const std::string& format,
            int64_t initial,
            double resize) -> std::shared_ptr<ak::Content> {
+      py::gil_scoped_release release;
       return FromROOT_nestedvector(byteoffsets,
                                    rawdata,
                                    depth,
@@ -94,6 +226,30 @@ make_fromroot_nestedvector(py::module& m, const std::string& name) {
      py::arg("resize") = 2.0);
 }
 
+////////// binary
+
+void
+make_tobinary(py::module& m, const std::string& name) {
+  m.def(name.c_str(),
+        [](const std::shared_ptr<ak::Content>& layout,
+           const std::string& destination) -> void {
+    py::gil_scoped_release release;
+    ak::ToBinaryFile(layout, destination);
+  }, py::arg("layout"),
+     py::arg("destination"));
+}
+
+void
+make_frombinary(py::module& m, const std::string& name) {
+  m.def(name.c_str(),
+        [](const std::string& source,
+           bool mmap) -> std::shared_ptr<ak::Content> {
+    py::gil_scoped_release release;
+    return ak::FromBinaryFile(source, mmap);
+  }, py::arg("source"),
+     py::arg("mmap") = true);
+}
+
 ////////// module
 
 namespace py = pybind11;
@@ -105,5 +261,8 @@ PYBIND11_MODULE(_io, m) {
 #endif
 
   make_fromjson(m, "fromjson");
+  make_fromjsonlines(m, "fromjsonlines");
   make_fromroot_nestedvector(m, "fromroot_nestedvector");
+  make_tobinary(m, "tobinary");
+  make_frombinary(m, "frombinary");
 }
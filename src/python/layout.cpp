@@ -68,4 +68,12 @@ PYBIND11_MODULE(layout, m) {
   m.def("_slice_tostring", [](py::object obj) -> std::string {
     return toslice(obj).tostring();
   });
+
+  m.def("reduce_multi",
+        &reduce_multi,
+        py::arg("arrays"),
+        py::arg("reducers"),
+        py::arg("axis") = -1,
+        py::arg("mask") = false,
+        py::arg("keepdims") = false);
 }
@@ -1,5 +1,7 @@
 // BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
 
+#include <type_traits>
+
 #include <pybind11/numpy.h>
 
 #include "awkward/python/identities.h"
@@ -136,6 +138,11 @@ box(const std::shared_ptr<ak::Identities>& identities) {
            dynamic_cast<ak::Identities64*>(identities.get())) {
     return py::cast(*raw);
   }
+  else if (ak::EncodedIdentities* raw =
+           dynamic_cast<ak::EncodedIdentities*>(identities.get())) {
+    // materialized now, because they have been asked for
+    return box(raw->to64());
+  }
   else {
     throw std::runtime_error("missing boxer for Identities subtype");
   }
@@ -564,6 +571,86 @@ toslice(py::object obj) {
   return out;
 }
 
+ak::ReducerPtr
+toreducer(const std::string& name) {
+  if (name == "count") {
+    return std::make_shared<ak::ReducerCount>();
+  }
+  else if (name == "count_nonzero") {
+    return std::make_shared<ak::ReducerCountNonzero>();
+  }
+  else if (name == "sum") {
+    return std::make_shared<ak::ReducerSum>();
+  }
+  else if (name == "prod") {
+    return std::make_shared<ak::ReducerProd>();
+  }
+  else if (name == "any") {
+    return std::make_shared<ak::ReducerAny>();
+  }
+  else if (name == "all") {
+    return std::make_shared<ak::ReducerAll>();
+  }
+  else if (name == "min") {
+    return std::make_shared<ak::ReducerMin>();
+  }
+  else if (name == "max") {
+    return std::make_shared<ak::ReducerMax>();
+  }
+  else if (name == "argmin") {
+    return std::make_shared<ak::ReducerArgmin>();
+  }
+  else if (name == "argmax") {
+    return std::make_shared<ak::ReducerArgmax>();
+  }
+  else {
+    throw std::invalid_argument(
+      std::string("unrecognized reducer: ") + ak::util::quote(name, true));
+  }
+}
+
+py::list
+reduce_multi(const py::iterable& arrays,
+             const std::vector<std::string>& reducers,
+             int64_t axis,
+             bool mask,
+             bool keepdims) {
+  ak::ContentPtrVec contents;
+  for (auto x : arrays) {
+    contents.push_back(unbox_content(x));
+  }
+  ak::ReducerPtrVec reducerptrs;
+  for (auto name : reducers) {
+    reducerptrs.push_back(toreducer(name));
+  }
+  ak::ContentPtrVec results;
+  {
+    py::gil_scoped_release release;
+    results = ak::Content::reduce_multi(contents,
+                                        reducerptrs,
+                                        axis,
+                                        mask,
+                                        keepdims);
+  }
+  py::list out;
+  for (auto x : results) {
+    out.append(box(x));
+  }
+  return out;
+}
+
+template <typename T, typename R>
+py::object
+reduce(const T& self, int64_t axis, bool mask, bool keepdims) {
+  R reducer;
+  ak::ContentPtr out;
+  {
+    py::gil_scoped_release release;
+    out = self.reduce(reducer, axis, mask, keepdims);
+  }
+  return box(out);
+}
+
 template <typename T>
 py::object
 getitem(const T& self, const py::object& obj) {
@@ -608,7 +695,17 @@ getitem(const T& self, const py::object& obj) {
     }
     // control flow can pass through here; don't make the last line an 'else'!
   }
-  return box(self.getitem(toslice(obj)));
+  ak::Slice slice = toslice(obj);
+  // An ArrayBuilder is not thread-safe, so the GIL must serialize its use.
+  if (std::is_same<T, ak::ArrayBuilder>::value) {
+    return box(self.getitem(slice));
+  }
+  ak::ContentPtr out;
+  {
+    py::gil_scoped_release release;
+    out = self.getitem(slice);
+  }
+  return box(out);
 }
 
 ////////// ArrayBuilder
@@ -693,9 +790,13 @@ builder_fromiter(ak::ArrayBuilder& self, const py::handle& obj) {
 py::class_<ak::ArrayBuilder>
 make_ArrayBuilder(const py::handle& m, const std::string& name) {
   return (py::class_<ak::ArrayBuilder>(m, name.c_str())
-      .def(py::init([](int64_t initial, double resize) -> ak::ArrayBuilder {
-        return ak::ArrayBuilder(ak::ArrayBuilderOptions(initial, resize));
-      }), py::arg("initial") = 1024, py::arg("resize") = 2.0)
+      .def(py::init([](int64_t initial, double resize, bool reallocate)
+                    -> ak::ArrayBuilder {
+        return ak::ArrayBuilder(ak::ArrayBuilderOptions(initial,
+                                                        resize,
+                                                        reallocate));
+      }), py::arg("initial") = 1024, py::arg("resize") = 2.0,
+          py::arg("reallocate") = false)
       .def_property_readonly("_ptr",
                              [](const ak::ArrayBuilder* self) -> size_t {
         return reinterpret_cast<size_t>(self);
@@ -707,6 +808,9 @@ make_ArrayBuilder(const py::handle& m, const std::string& name) {
       .def("snapshot", [](const ak::ArrayBuilder& self) -> py::object {
         return box(self.snapshot());
       })
+      .def("finish", [](ak::ArrayBuilder& self, bool shrink) -> py::object {
+        return box(self.finish(shrink));
+      }, py::arg("shrink") = true)
       .def("__getitem__", &getitem<ak::ArrayBuilder>)
       .def("__iter__", [](const ak::ArrayBuilder& self) -> ak::Iterator {
         return ak::Iterator(self.snapshot());
@@ -935,6 +1039,10 @@ purelist_parameter(const T& self, const std::string& key) {
   return py::module::import("json").attr("loads")(pyvalue);
 }
 
+// The setters modify the layout in place, so they are only safe on one that
+// is not shared yet, such as one that was just constructed: a shared layout
+// is part of other arrays, which would all change. withparameters,
+// withparameter, and withidentities return modified copies instead.
 template <typename T>
 void
 setparameters(T& self, const py::object& parameters) {
@@ -948,6 +1056,19 @@ setparameter(T& self, const std::string& key, const py::object& value) {
   self.setparameter(key, valuestr.cast<std::string>());
 }
 
+template <typename T>
+py::object
+withparameters(const T& self, const py::object& parameters) {
+  return box(self.withparameters(dict2parameters(parameters)));
+}
+
+template <typename T>
+py::object
+withparameter(const T& self, const std::string& key, const py::object& value) {
+  py::object valuestr = py::module::import("json").attr("dumps")(value);
+  return box(self.withparameter(key, valuestr.cast<std::string>()));
+}
+
 int64_t
 check_maxdecimals(const py::object& maxdecimals) {
   if (maxdecimals.is(py::none())) {
@@ -964,7 +1085,9 @@ check_maxdecimals(const py::object& maxdecimals) {
 template <typename T>
 std::string
 tojson_string(const T& self, bool pretty, const py::object& maxdecimals) {
-  return self.tojson(pretty, check_maxdecimals(maxdecimals));
+  int64_t decimals = check_maxdecimals(maxdecimals);
+  py::gil_scoped_release release;
+  return self.tojson(pretty, decimals);
 }
 
 template <typename T>
@@ -985,8 +1108,10 @@ tojson_file(const T& self,
       std::string("file \"") + destination
       + std::string("\" could not be opened for writing"));
   }
+  int64_t decimals = check_maxdecimals(maxdecimals);
   try {
-    self.tojson(file, pretty, check_maxdecimals(maxdecimals), buffersize);
+    py::gil_scoped_release release;
+    self.tojson(file, pretty, decimals, buffersize);
   }
   catch (...) {
     fclose(file);
@@ -1014,15 +1139,29 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
           .def("setidentities", [](T& self) -> void {
             self.setidentities();
           })
+          .def("setvirtualidentities", [](T& self) -> void {
+            self.setvirtualidentities();
+          })
+          .def("setcompressedidentities", [](T& self) -> void {
+            self.setcompressedidentities();
+          })
+          .def("withidentities",
+               [](const T& self, const py::object& identities) -> py::object {
+            return box(self.withidentities(unbox_identities_none(identities)));
+          })
           .def_property("parameters", &getparameters<T>, &setparameters<T>)
           .def("setparameter", &setparameter<T>)
+          .def("withparameters", &withparameters<T>)
+          .def("withparameter", &withparameter<T>)
           .def("parameter", &parameter<T>)
           .def("purelist_parameter", &purelist_parameter<T>)
           .def("type",
                [](const T& self,
                   const std::map<std::string,
                   std::string>& typestrs) -> std::shared_ptr<ak::Type> {
-            return self.type(typestrs);
+            // The type itself is interned and read-only; a copy may be
+            // modified, though the types it contains are still shared.
+            return self.type(typestrs).get()->shallow_copy();
           })
           .def("__len__", &len<T>)
           .def("__getitem__", &getitem<T>)
@@ -1076,26 +1215,49 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
             return box(self.fillna(unbox_content(value)));
           })
           .def("num", [](const T& self, int64_t axis) -> py::object {
-            return box(self.num(axis, 0));
+            ak::ContentPtr out;
+            {
+              py::gil_scoped_release release;
+              out = self.num(axis, 0);
+            }
+            return box(out);
           }, py::arg("axis") = 1)
           .def("flatten", [](const T& self, int64_t axis) -> py::object {
-            std::pair<ak::Index64, std::shared_ptr<ak::Content>> pair =
-              self.offsets_and_flattened(axis, 0);
+            std::pair<ak::Index64, std::shared_ptr<ak::Content>> pair(
+              ak::Index64(0), nullptr);
+            {
+              py::gil_scoped_release release;
+              pair = self.offsets_and_flattened(axis, 0);
+            }
             return box(pair.second);
           }, py::arg("axis") = 1)
           .def("offsets_and_flatten",
                [](const T& self, int64_t axis) -> py::object {
-            std::pair<ak::Index64, std::shared_ptr<ak::Content>> pair =
-              self.offsets_and_flattened(axis, 0);
+            std::pair<ak::Index64, std::shared_ptr<ak::Content>> pair(
+              ak::Index64(0), nullptr);
+            {
+              py::gil_scoped_release release;
+              pair = self.offsets_and_flattened(axis, 0);
+            }
             return py::make_tuple(py::cast(pair.first), box(pair.second));
           }, py::arg("axis") = 1)
           .def("rpad",
                [](const T&self, int64_t length, int64_t axis) -> py::object {
-            return box(self.rpad(length, axis, 0));
+            ak::ContentPtr out;
+            {
+              py::gil_scoped_release release;
+              out = self.rpad(length, axis, 0);
+            }
+            return box(out);
           })
           .def("rpad_and_clip",
                [](const T&self, int64_t length, int64_t axis) -> py::object {
-            return box(self.rpad_and_clip(length, axis, 0));
+            ak::ContentPtr out;
+            {
+              py::gil_scoped_release release;
+              out = self.rpad_and_clip(length, axis, 0);
+            }
+            return box(out);
           })
           .def("mergeable",
                [](const T& self, const py::object& other, bool mergebool)
@@ -1111,87 +1273,62 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
             return box(self.merge_as_union(unbox_content(other)));
           })
           .def("count",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerCount reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = false,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerCount>,
+               py::arg("axis") = -1,
+               py::arg("mask") = false,
+               py::arg("keepdims") = false)
           .def("count_nonzero",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerCountNonzero reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = false,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerCountNonzero>,
+               py::arg("axis") = -1,
+               py::arg("mask") = false,
+               py::arg("keepdims") = false)
           .def("sum",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerSum reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = false,
+               &reduce<T, ak::ReducerSum>,
+               py::arg("axis") = -1,
+               py::arg("mask") = false,
                py::arg("keepdims") = false)
           .def("prod",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerProd reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = false,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerProd>,
+               py::arg("axis") = -1,
+               py::arg("mask") = false,
+               py::arg("keepdims") = false)
           .def("any",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerAny reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = false,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerAny>,
+               py::arg("axis") = -1,
+               py::arg("mask") = false,
+               py::arg("keepdims") = false)
           .def("all",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerAll reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = false,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerAll>,
+               py::arg("axis") = -1,
+               py::arg("mask") = false,
+               py::arg("keepdims") = false)
           .def("min",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerMin reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = true,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerMin>,
+               py::arg("axis") = -1,
+               py::arg("mask") = true,
+               py::arg("keepdims") = false)
           .def("max",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerMax reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = true,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerMax>,
+               py::arg("axis") = -1,
+               py::arg("mask") = true,
+               py::arg("keepdims") = false)
           .def("argmin",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerArgmin reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = true,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerArgmin>,
+               py::arg("axis") = -1,
+               py::arg("mask") = true,
+               py::arg("keepdims") = false)
           .def("argmax",
-               [](const T& self, int64_t axis, bool mask, bool keepdims)
-               -> py::object {
-            ak::ReducerArgmax reducer;
-            return box(self.reduce(reducer, axis, mask, keepdims));
-          }, py::arg("axis") = -1,
-             py::arg("mask") = true,
-             py::arg("keepdims") = false)
+               &reduce<T, ak::ReducerArgmax>,
+               py::arg("axis") = -1,
+               py::arg("mask") = true,
+               py::arg("keepdims") = false)
           .def("localindex", [](const T& self, int64_t axis) -> py::object {
-            return box(self.localindex(axis, 0));
+            ak::ContentPtr out;
+            {
+              py::gil_scoped_release release;
+              out = self.localindex(axis, 0);
+            }
+            return box(out);
           }, py::arg("axis") = 1)
           .def("choose",
                [](const T& self,
@@ -1211,12 +1348,13 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
                   "if provided, the length of 'keys' must be 'n'");
               }
             }
-            return box(self.choose(n,
-                                   diagonal,
-                                   recordlookup,
-                                   dict2parameters(parameters),
-                                   axis,
-                                   0));
+            ak::util::Parameters params = dict2parameters(parameters);
+            ak::ContentPtr out;
+            {
+              py::gil_scoped_release release;
+              out = self.choose(n, diagonal, recordlookup, params, axis, 0);
+            }
+            return box(out);
           }, py::arg("n"),
              py::arg("diagonal") = false,
              py::arg("keys") = py::none(),
@@ -1646,11 +1784,13 @@ make_Record(const py::handle& m, const std::string& name) {
       .def("type", [](const ak::Record& self,
                       const std::map<std::string,
                       std::string>& typestrs) -> std::shared_ptr<ak::Type> {
-        return self.type(typestrs);
+        return self.type(typestrs).get()->shallow_copy();
       })
       .def_property("parameters",
                     &getparameters<ak::Record>, &setparameters<ak::Record>)
       .def("setparameter", &setparameter<ak::Record>)
+      .def("withparameters", &withparameters<ak::Record>)
+      .def("withparameter", &withparameter<ak::Record>)
       .def("parameter", &parameter<ak::Record>)
       .def("purelist_parameter", &purelist_parameter<ak::Record>)
       .def("tojson",
@@ -1813,6 +1953,7 @@ make_RecordArray(const py::handle& m, const std::string& name) {
         }
       })
       .def_property_readonly("istuple", &ak::RecordArray::istuple)
+      .def_property_readonly("islazy", &ak::RecordArray::islazy)
       .def_property_readonly("contents", &ak::RecordArray::contents)
       .def("setitem_field",
            [](const ak::RecordArray& self,
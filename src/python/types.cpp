@@ -101,11 +101,11 @@ make_Type(const py::handle& m, const std::string& name) {
   return (py::class_<ak::Type, std::shared_ptr<ak::Type>>(m, name.c_str())
       .def("__eq__", [](const std::shared_ptr<ak::Type>& self,
                         const std::shared_ptr<ak::Type>& other) -> bool {
-        return self.get()->equal(other, true);
+        return self.get() == other.get()  ||  self.get()->equal(other, true);
       })
       .def("__ne__", [](const std::shared_ptr<ak::Type>& self,
                         const std::shared_ptr<ak::Type>& other) -> bool {
-        return !self.get()->equal(other, true);
+        return self.get() != other.get()  &&  !self.get()->equal(other, true);
       })
   );
 }
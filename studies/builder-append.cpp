@@ -0,0 +1,63 @@
+// g++ -O3 -std=c++11 -Iinclude studies/builder-append.cpp -L. -lawkward -lawkward-cpu-kernels -o builder-append && ./builder-append
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+
+namespace ak = awkward;
+
+// Appends integers and then floats to an ArrayBuilder (100M of each by
+// default, or argv[1]) and reports the time per append. The builder is
+// cleared every million appends, so memory stays bounded.
+
+const int64_t kBatch = 1000000;
+
+int main(int argc, char** argv)
+{
+  int64_t total = 100000000;
+  if (argc > 1) {
+    total = (int64_t)atoll(argv[1]);
+  }
+  ak::ArrayBuilder builder(ak::ArrayBuilderOptions(1024, 2.0));
+
+  int64_t appended = 0;
+  auto start = std::chrono::steady_clock::now();
+  while (appended < total) {
+    int64_t batch = std::min(kBatch, total - appended);
+    builder.clear();
+    for (int64_t i = 0;  i < batch;  i++) {
+      builder.integer(i);
+    }
+    appended += batch;
+  }
+  auto middle = std::chrono::steady_clock::now();
+
+  ak::ArrayBuilder floats(ak::ArrayBuilderOptions(1024, 2.0));
+  appended = 0;
+  auto middle2 = std::chrono::steady_clock::now();
+  while (appended < total) {
+    int64_t batch = std::min(kBatch, total - appended);
+    floats.clear();
+    for (int64_t i = 0;  i < batch;  i++) {
+      floats.real(0.5*i);
+    }
+    appended += batch;
+  }
+  auto stop = std::chrono::steady_clock::now();
+  if (appended == 0) {return 0;}
+
+  double integers = std::chrono::duration<double, std::nano>(
+                      middle - start).count() / appended;
+  double reals = std::chrono::duration<double, std::nano>(
+                   stop - middle2).count() / appended;
+  std::cout << "ArrayBuilder.integer: " << integers << " ns/append"
+            << std::endl;
+  std::cout << "ArrayBuilder.real:    " << reals << " ns/append"
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+// g++ -O3 -std=c++11 -Iawkward-1.0/include chep2019-studies-4.cpp -L. -lawkward -lawkward-cpu-kernels -pthread -o chep2019-studies-4 && ./chep2019-studies-4
+//
+// Times FromROOT_nestedvector on baskets serialized the way write_ttree.cpp
+// writes sample-jagged{1,2,3}.root (uncompressed, 10 MB baskets, a mean of
+// 8 items per list at every level), at several thread counts.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "awkward/cpu-kernels/parallel.h"
+#include "awkward/Identities.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/io/root.h"
+
+#define LENCONTENT 67108864
+#define BASKETSIZE 10485760
+
+namespace ak = awkward;
+
+struct Basket {
+  std::vector<uint8_t> rawdata;
+  std::vector<int64_t> byteoffsets;
+  int64_t numfloats;
+};
+
+void appendbigendian(std::vector<uint8_t>& raw, uint32_t x) {
+  raw.push_back((uint8_t)(x >> 24));
+  raw.push_back((uint8_t)(x >> 16));
+  raw.push_back((uint8_t)(x >> 8));
+  raw.push_back((uint8_t)x);
+}
+
+void appendlist(Basket& basket, std::mt19937& rng, int64_t depth) {
+  uint32_t length = std::uniform_int_distribution<uint32_t>(0, 16)(rng);
+  appendbigendian(basket.rawdata, length);
+  for (uint32_t i = 0;  i < length;  i++) {
+    if (depth == 1) {
+      float x = std::uniform_real_distribution<float>(0.0f, 1.0f)(rng);
+      uint32_t bits;
+      std::memcpy(&bits, &x, sizeof(float));
+      appendbigendian(basket.rawdata, bits);
+      basket.numfloats++;
+    }
+    else {
+      appendlist(basket, rng, depth - 1);
+    }
+  }
+}
+
+std::vector<Basket> makebaskets(int64_t depth) {
+  std::mt19937 rng(12345);
+  std::vector<Basket> out;
+  int64_t total = 0;
+  while (total < LENCONTENT) {
+    Basket basket;
+    basket.byteoffsets.push_back(0);
+    basket.numfloats = 0;
+    while (basket.rawdata.size() < BASKETSIZE) {
+      appendlist(basket, rng, depth);
+      basket.byteoffsets.push_back((int64_t)basket.rawdata.size());
+    }
+    total += basket.numfloats;
+    out.push_back(basket);
+  }
+  return out;
+}
+
+double readbaskets(const std::vector<Basket>& baskets, int64_t depth) {
+  std::vector<ak::NumpyArray> rawdatas;
+  std::vector<ak::Index64> byteoffsets;
+  for (auto& basket : baskets) {
+    ssize_t length = (ssize_t)basket.rawdata.size();
+    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)length],
+                                 ak::util::array_deleter<uint8_t>());
+    std::memcpy(ptr.get(), basket.rawdata.data(), (size_t)length);
+    rawdatas.push_back(ak::NumpyArray(ak::Identities::none(),
+                                      ak::util::Parameters(),
+                                      ptr,
+                                      std::vector<ssize_t>({ length }),
+                                      std::vector<ssize_t>({ 1 }),
+                                      0,
+                                      1,
+                                      "B"));
+    ak::Index64 index((int64_t)basket.byteoffsets.size());
+    std::memcpy(index.ptr().get(),
+                basket.byteoffsets.data(),
+                basket.byteoffsets.size()*sizeof(int64_t));
+    byteoffsets.push_back(index);
+  }
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0;  i < baskets.size();  i++) {
+    ak::ContentPtr result =
+      ak::FromROOT_nestedvector(byteoffsets[i],
+                                rawdatas[i],
+                                depth,
+                                4,
+                                ">f",
+                                ak::ArrayBuilderOptions(1024, 2.0));
+  }
+  auto stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int, char**) {
+  int64_t maxthreads = (int64_t)std::thread::hardware_concurrency();
+  for (int64_t depth = 1;  depth <= 3;  depth++) {
+    std::vector<Basket> baskets = makebaskets(depth);
+    int64_t numfloats = 0;
+    for (auto& basket : baskets) {
+      numfloats += basket.numfloats;
+    }
+    for (int64_t numthreads = 1;  numthreads <= maxthreads;  numthreads *= 2) {
+      awkward_parallel_set_numthreads(numthreads);
+      double walltime = readbaskets(baskets, depth);
+      printf("TTree NEW jagged%lld\t%lld threads\t%g sec;\t%g million floats/sec\n",
+             (long long)depth,
+             (long long)numthreads,
+             walltime,
+             numfloats/walltime/1e6);
+    }
+  }
+  awkward_parallel_set_numthreads(1);
+  return 0;
+}
@@ -0,0 +1,48 @@
+# Compares the rapidjson and simdjson parse paths of awkward1.fromjson on the
+# numerical JSON corpus: first run make-numerical-json.py (in studies) and
+# read-numerical-json.py to make studies/sample-jagged{0,1,2,3}.json. The
+# simdjson path requires awkward1 to be compiled with AWKWARD_SIMDJSON=1.
+
+import os
+import sys
+import time
+
+import awkward1
+
+os.chdir(os.path.join(os.path.dirname(os.path.abspath(__file__)), "../.."))
+
+if not awkward1._io.simdjson_available():
+    sys.exit("awkward1 was compiled without simdjson (AWKWARD_SIMDJSON=1 python setup.py build)")
+
+REPS = 3
+MAXBYTES = 1024**3   # simdjson parses whole documents in memory
+
+def bench(source, size, simdjson):
+    fromfile = not source.startswith("[")
+    starttime = time.time()
+    for i in range(REPS):
+        q = awkward1.fromjson(source, highlevel=False, simdjson=simdjson)
+    walltime = (time.time() - starttime) / REPS
+    print("{0:5s} {1:9s} {2:8.3f} sec; {3:7.3f} GB/s".format(
+          "file" if fromfile else "str",
+          "simdjson" if simdjson else "rapidjson",
+          walltime,
+          size / walltime / 1e9))
+    return q
+
+for depth in range(4):
+    filename = "studies/sample-jagged{0}.json".format(depth)
+    size = os.stat(filename).st_size
+    print("{0} ({1:.3f} GB)".format(filename, size / 1e9))
+    if size > MAXBYTES:
+        print("    skipping: larger than MAXBYTES")
+        continue
+
+    one = bench(filename, size, False)
+    two = bench(filename, size, True)
+    assert len(one) == len(two)
+
+    with open(filename) as file:
+        string = file.read()
+    bench(string, size, False)
+    bench(string, size, True)
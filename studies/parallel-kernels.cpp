@@ -0,0 +1,59 @@
+// g++ -O3 -std=c++11 -Iinclude studies/parallel-kernels.cpp src/cpu-kernels/*.cpp -pthread -o parallel-kernels && ./parallel-kernels
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/cpu-kernels/parallel.h"
+
+#define LENGTH 50000000
+
+template <typename F>
+double timeit(const F& f) {
+  auto start = std::chrono::high_resolution_clock::now();
+  f();
+  auto stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int, char**) {
+  std::vector<int64_t> fromindex(LENGTH);
+  std::vector<int64_t> carry(LENGTH);
+  std::vector<int64_t> toindex(LENGTH);
+  std::vector<int64_t> starts(LENGTH);
+  std::vector<int64_t> stops(LENGTH);
+  std::vector<int64_t> offsets(LENGTH + 1);
+  std::vector<double> todouble(LENGTH);
+  uint64_t state = 12345;
+  for (int64_t i = 0;  i < LENGTH;  i++) {
+    state = state*6364136223846793005ULL + 1442695040888963407ULL;
+    fromindex[i] = i;
+    carry[i] = (int64_t)((state >> 33) % LENGTH);
+    starts[i] = i;
+    stops[i] = i + (int64_t)((state >> 20) % 5);
+  }
+
+  unsigned int maxthreads = std::thread::hardware_concurrency();
+  printf("threads  index_carry  compact_offsets  fill_todouble\n");
+  for (int64_t numthreads = 1;  numthreads <= maxthreads;  numthreads *= 2) {
+    awkward_parallel_set_numthreads(numthreads);
+    double t1 = timeit([&]() -> void {
+      awkward_index64_carry_64(toindex.data(), fromindex.data(),
+                               carry.data(), 0, LENGTH, LENGTH);
+    });
+    double t2 = timeit([&]() -> void {
+      awkward_listarray64_compact_offsets64(offsets.data(), starts.data(),
+                                            stops.data(), 0, 0, LENGTH);
+    });
+    double t3 = timeit([&]() -> void {
+      awkward_numpyarray_fill_todouble_from64(todouble.data(), 0,
+                                              fromindex.data(), 0, LENGTH);
+    });
+    printf("%7" PRId64 "  %11.3f  %15.3f  %13.3f\n", numthreads, t1, t2, t3);
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+// g++ -O3 -std=c++11 -Iinclude studies/typed-builder.cpp -L. -lawkward -lawkward-cpu-kernels -o typed-builder && ./typed-builder
+//
+// Fills [{"x": i, "y": [0.0, 1.1, ...(i % 4 numbers)], "z": "i % 10" or None}]
+// with ArrayBuilder and with the equivalent TypedBuilder.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/TypedBuilder.h"
+
+#define LENGTH 10000000
+
+namespace ak = awkward;
+
+using Builder =
+  ak::TypedListBuilder<
+    ak::TypedRecordBuilder<
+      ak::TypedNumpyBuilder<int64_t>,
+      ak::TypedListBuilder<ak::TypedNumpyBuilder<double>>,
+      ak::TypedOptionBuilder<ak::TypedStringBuilder>>>;
+
+template <typename F>
+double timeit(const F& f) {
+  auto start = std::chrono::high_resolution_clock::now();
+  f();
+  auto stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int, char**) {
+  ak::ArrayBuilderOptions options(1024, 2.0);
+  ak::ContentPtr expected;
+
+  double dynamic_time = timeit([&]() -> void {
+    ak::ArrayBuilder builder(options);
+    builder.beginlist();
+    for (int64_t i = 0;  i < LENGTH;  i++) {
+      builder.beginrecord();
+      builder.field_check("x");
+      builder.integer(i);
+      builder.field_check("y");
+      builder.beginlist();
+      for (int64_t j = 0;  j < i % 4;  j++) {
+        builder.real(1.1*j);
+      }
+      builder.endlist();
+      builder.field_check("z");
+      if (i % 3 == 0) {
+        builder.null();
+      }
+      else {
+        builder.string(std::to_string(i % 10));
+      }
+      builder.endrecord();
+    }
+    builder.endlist();
+    expected = builder.snapshot();
+  });
+
+  ak::TypePtr type = expected.get()->type(ak::util::TypeStrs());
+  double typed_time = timeit([&]() -> void {
+    Builder builder(options, type);
+    auto& record = builder.begin_list();
+    for (int64_t i = 0;  i < LENGTH;  i++) {
+      record.field<0>().append(i);
+      auto& y = record.field<1>().begin_list();
+      for (int64_t j = 0;  j < i % 4;  j++) {
+        y.append(1.1*j);
+      }
+      record.field<1>().end_list();
+      if (i % 3 == 0) {
+        record.field<2>().null();
+      }
+      else {
+        record.field<2>().valid().append(std::to_string(i % 10));
+      }
+      record.end_record();
+    }
+    builder.end_list();
+    builder.finish();
+  });
+
+  printf("ArrayBuilder  %g sec\n", dynamic_time);
+  printf("TypedBuilder  %g sec (%.1fx)\n",
+         typed_time,
+         dynamic_time / typed_time);
+  return 0;
+}
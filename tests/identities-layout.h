@@ -0,0 +1,107 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+// Shared by the tests of the alternative Identities representations, which
+// compare them with the materialized Identities of the same layout.
+
+#ifndef AWKWARD_TESTS_IDENTITIES_LAYOUT_H_
+#define AWKWARD_TESTS_IDENTITIES_LAYOUT_H_
+
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/Identities.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+
+namespace ak = awkward;
+
+// Record i is {"x": i % 4 lists of j items, "y": i or null, "z": i or [i]},
+// which makes ListOffsetArrays, an option type, and a UnionArray.
+inline ak::ContentPtr
+makelayout(int64_t length) {
+  ak::ArrayBuilder builder(ak::ArrayBuilderOptions(1024, 2.0));
+  for (int64_t i = 0;  i < length;  i++) {
+    builder.beginrecord();
+    builder.field_check("x");
+    builder.beginlist();
+    for (int64_t j = 0;  j < i % 4;  j++) {
+      builder.beginlist();
+      for (int64_t k = 0;  k < j;  k++) {
+        builder.real((double)i + 0.1*k);
+      }
+      builder.endlist();
+    }
+    builder.endlist();
+    builder.field_check("y");
+    if (i % 3 == 0) {
+      builder.null();
+    }
+    else {
+      builder.integer(i);
+    }
+    builder.field_check("z");
+    if (i % 2 == 0) {
+      builder.integer(i);
+    }
+    else {
+      builder.beginlist();
+      builder.integer(i);
+      builder.endlist();
+    }
+    builder.endrecord();
+  }
+  return builder.snapshot();
+}
+
+// The other node's identities must be of the given class and agree with the
+// materialized ones, both row by row and once they are materialized.
+inline bool
+sameidentities(const ak::ContentPtr& materialized,
+               const ak::ContentPtr& other,
+               const std::string& classname) {
+  ak::IdentitiesPtr one = materialized.get()->identities();
+  ak::IdentitiesPtr two = other.get()->identities();
+  if (one.get() == nullptr  ||  two.get() == nullptr) {
+    return false;
+  }
+  if (two.get()->classname() != classname) {
+    return false;
+  }
+  if (one.get()->length() != two.get()->length()  ||
+      one.get()->width() != two.get()->width()  ||
+      one.get()->fieldloc() != two.get()->fieldloc()) {
+    return false;
+  }
+  ak::IdentitiesPtr three = two.get()->to64();
+  if (three.get() == nullptr  ||
+      three.get()->length() != one.get()->length()) {
+    return false;
+  }
+  for (int64_t i = 0;  i < one.get()->length();  i++) {
+    if (one.get()->identity_at(i) != two.get()->identity_at(i)) {
+      return false;
+    }
+    for (int64_t j = 0;  j < one.get()->width();  j++) {
+      if (one.get()->value(i, j) != three.get()->value(i, j)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+inline bool
+samefields(const ak::ContentPtr& materialized,
+           const ak::ContentPtr& other,
+           const std::string& classname) {
+  for (auto key : { "x", "y", "z" }) {
+    if (!sameidentities(materialized.get()->getitem_field(key),
+                        other.get()->getitem_field(key),
+                        classname)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#endif // AWKWARD_TESTS_IDENTITIES_LAYOUT_H_
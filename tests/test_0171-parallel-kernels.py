@@ -0,0 +1,70 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+import awkward1._cpu_kernels
+
+@pytest.fixture
+def parallel():
+    numthreads = awkward1._cpu_kernels.parallel_numthreads()
+    threshold = awkward1._cpu_kernels.parallel_threshold()
+    awkward1._cpu_kernels.parallel_set_numthreads(4)
+    awkward1._cpu_kernels.parallel_set_threshold(10)
+    yield
+    awkward1._cpu_kernels.parallel_set_numthreads(numthreads)
+    awkward1._cpu_kernels.parallel_set_threshold(threshold)
+
+def test_settings(parallel):
+    assert awkward1._cpu_kernels.parallel_numthreads() == 4
+    assert awkward1._cpu_kernels.parallel_threshold() == 10
+
+def test_carry(parallel):
+    content = numpy.arange(1000) * 1.1
+    carry = numpy.random.RandomState(12345).randint(0, 1000, 5000)
+    array = awkward1.layout.NumpyArray(content)
+    assert awkward1.tolist(array[carry]) == content[carry].tolist()
+
+    index = awkward1.layout.Index64(numpy.arange(1000, dtype=numpy.int64)[::-1].copy())
+    indexedarray = awkward1.layout.IndexedArray64(index, array)
+    assert awkward1.tolist(indexedarray[carry]) == content[::-1][carry].tolist()
+
+    with pytest.raises(ValueError):
+        array[numpy.concatenate([carry, [1000]])]
+
+def test_compact_offsets(parallel):
+    starts = numpy.random.RandomState(12345).randint(0, 900, 1000)
+    stops = starts + numpy.random.RandomState(54321).randint(0, 100, 1000)
+    content = awkward1.layout.NumpyArray(numpy.arange(1000))
+    listarray = awkward1.layout.ListArray64(awkward1.layout.Index64(starts), awkward1.layout.Index64(stops), content)
+    expected = [list(range(start, stop)) for start, stop in zip(starts, stops)]
+    assert awkward1.tolist(listarray) == expected
+    assert numpy.asarray(listarray.compact_offsets64(True)).tolist() == [0] + numpy.cumsum(stops - starts).tolist()
+
+    stops[500] = starts[500] - 1
+    listarray = awkward1.layout.ListArray64(awkward1.layout.Index64(starts), awkward1.layout.Index64(stops), content)
+    with pytest.raises(ValueError):
+        listarray.compact_offsets64(True)
+
+def test_fill(parallel):
+    one = awkward1.Array(numpy.arange(500, dtype=numpy.int32)).layout
+    two = awkward1.Array(numpy.arange(500) * 1.5).layout
+    assert awkward1.tolist(one.merge(two)) == list(range(500)) + (numpy.arange(500) * 1.5).tolist()
+
+def test_broadcast_tooffsets(parallel):
+    content = awkward1.layout.NumpyArray(numpy.arange(1000))
+    starts = numpy.arange(1000, dtype=numpy.int64)
+    listarray = awkward1.layout.ListArray64(awkward1.layout.Index64(starts), awkward1.layout.Index64(starts + 1), content)
+    offsets = numpy.arange(1001, dtype=numpy.int64)
+    assert awkward1.tolist(listarray.broadcast_tooffsets64(awkward1.layout.Index64(offsets))) == [[i] for i in range(1000)]
+
+    # every list is checked before any are filled, so a later chunk can't
+    # be written past the end
+    offsets[500] = 10**6
+    with pytest.raises(ValueError):
+        listarray.broadcast_tooffsets64(awkward1.layout.Index64(offsets))
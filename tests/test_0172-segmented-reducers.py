@@ -0,0 +1,40 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def lists(dtype):
+    random = numpy.random.RandomState(12345)
+    counts = random.randint(0, 200, 100)
+    content = random.randint(-3, 4, counts.sum()).astype(dtype)
+    offsets = numpy.concatenate([[0], numpy.cumsum(counts)])
+    layout = awkward1.layout.ListOffsetArray64(awkward1.layout.Index64(offsets), awkward1.layout.NumpyArray(content))
+    return awkward1.Array(layout), [content[offsets[i]:offsets[i + 1]] for i in range(len(counts))]
+
+@pytest.mark.parametrize("dtype", [numpy.int8, numpy.uint8, numpy.int16, numpy.int32, numpy.uint32, numpy.int64])
+def test_integers(dtype):
+    array, expected = lists(dtype)
+    assert awkward1.tolist(awkward1.sum(array, axis=-1)) == [x.sum() for x in expected]
+    assert awkward1.tolist(awkward1.prod(array, axis=-1)) == [x.prod() for x in expected]
+    assert awkward1.tolist(awkward1.count_nonzero(array, axis=-1)) == [numpy.count_nonzero(x) for x in expected]
+    assert awkward1.tolist(awkward1.any(array, axis=-1)) == [bool(x.any()) for x in expected]
+    assert awkward1.tolist(awkward1.all(array, axis=-1)) == [bool(x.all()) for x in expected]
+    assert awkward1.tolist(awkward1.min(array, axis=-1)) == [x.min() if len(x) > 0 else None for x in expected]
+    assert awkward1.tolist(awkward1.max(array, axis=-1)) == [x.max() if len(x) > 0 else None for x in expected]
+
+def test_floats_keep_order():
+    array, expected = lists(numpy.float64)
+    array = array * 0.1
+    expected = [x * 0.1 for x in expected]
+    def serial(x):
+        out = 0.0
+        for y in x:
+            out += y
+        return out
+    assert awkward1.tolist(awkward1.sum(array, axis=-1)) == [serial(x) for x in expected]
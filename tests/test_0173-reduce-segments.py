@@ -0,0 +1,40 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_offsets_not_at_zero():
+    content = awkward1.layout.NumpyArray(numpy.array([99, 3, 1, 2, 5, 4, 7, 6, 99], dtype=numpy.int64))
+    offsets = awkward1.layout.Index64(numpy.array([1, 4, 4, 6, 8]))
+    array = awkward1.Array(awkward1.layout.ListOffsetArray64(offsets, content))
+    assert awkward1.tolist(array) == [[3, 1, 2], [], [5, 4], [7, 6]]
+    assert awkward1.tolist(awkward1.count(array, axis=-1)) == [3, 0, 2, 2]
+    assert awkward1.tolist(awkward1.sum(array, axis=-1)) == [6, 0, 9, 13]
+    assert awkward1.tolist(awkward1.min(array, axis=-1)) == [1, None, 4, 6]
+    assert awkward1.tolist(awkward1.argmin(array, axis=-1)) == [1, None, 1, 1]
+    assert awkward1.tolist(awkward1.argmax(array, axis=-1)) == [0, None, 0, 0]
+    assert awkward1.tolist(awkward1.argmax(array[1:], axis=-1)) == [None, 0, 0]
+
+def test_keepdims_and_maskidentity():
+    array = awkward1.Array([[1.5, 2.5], [], [4.0]])
+    assert awkward1.tolist(awkward1.sum(array, axis=-1, keepdims=True)) == [[4.0], [0.0], [4.0]]
+    assert awkward1.tolist(awkward1.sum(array, axis=-1, maskidentity=True)) == [4.0, None, 4.0]
+    assert awkward1.tolist(awkward1.max(array, axis=-1, keepdims=True)) == [[2.5], [None], [4.0]]
+
+def test_nested():
+    array = awkward1.Array([[[1, 2, 3], []], [], [[4, 5], [6]]])
+    assert awkward1.tolist(awkward1.sum(array, axis=-1)) == [[6, 0], [], [9, 6]]
+    assert awkward1.tolist(awkward1.sum(array[1:], axis=-1)) == [[], [9, 6]]
+    assert awkward1.tolist(awkward1.argmax(array[:, ::-1], axis=-1)) == [[None, 2], [], [0, 1]]
+
+def test_bool():
+    array = awkward1.Array([[True, False], [False, False], [], [True, True, True]])
+    assert awkward1.tolist(awkward1.any(array, axis=-1)) == [True, False, False, True]
+    assert awkward1.tolist(awkward1.all(array, axis=-1)) == [False, False, True, True]
+    assert awkward1.tolist(awkward1.argmax(array, axis=-1)) == [0, 0, None, 0]
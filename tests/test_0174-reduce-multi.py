@@ -0,0 +1,56 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_same_structure():
+    x = awkward1.Array([[[1, 2, 3], []], [], [[4, 5], [6]]]).layout
+    y = awkward1.Array([[[2, 2, 2], []], [], [[1, 0], [3]]]).layout
+    for axis in (-1, -2, 0):
+        count, sumx, maxy = awkward1.layout.reduce_multi([x, x, y], ["count", "sum", "max"], axis=axis)
+        assert awkward1.tolist(count) == awkward1.tolist(x.count(axis=axis))
+        assert awkward1.tolist(sumx) == awkward1.tolist(x.sum(axis=axis))
+        assert awkward1.tolist(maxy) == awkward1.tolist(y.max(axis=axis))
+
+def test_different_structure():
+    x = awkward1.Array([[1, 2, 3], [], [4, 5]]).layout
+    y = awkward1.Array([[1], [2, 3], [4, 5, 6]]).layout
+    sumx, sumy = awkward1.layout.reduce_multi([x, y], ["sum", "sum"], axis=-1, keepdims=True)
+    assert awkward1.tolist(sumx) == [[6], [0], [9]]
+    assert awkward1.tolist(sumy) == [[1], [5], [15]]
+
+def test_errors():
+    x = awkward1.Array([[1, 2, 3], [], [4, 5]]).layout
+    y = awkward1.Array([[1], [2, 3]]).layout
+    with pytest.raises(ValueError):
+        awkward1.layout.reduce_multi([x, y], ["sum", "sum"])
+    with pytest.raises(ValueError):
+        awkward1.layout.reduce_multi([x], ["sum", "sum"])
+    with pytest.raises(ValueError):
+        awkward1.layout.reduce_multi([x], ["median"])
+
+def test_moments():
+    x = awkward1.Array([[1.0, 2.0, 4.0], [], [3.0, 5.0]])
+    y = awkward1.Array([[2.0, 4.0, 9.0], [], [1.0, 2.0]])
+    w = awkward1.Array([[1.0, 0.5, 2.0], [], [1.0, 1.0]])
+    def sliced(array, i):
+        return numpy.asarray(awkward1.tolist(array[i]))
+    for i in (0, 2):
+        xi, yi, wi = sliced(x, i), sliced(y, i), sliced(w, i)
+        assert awkward1.mean(x, axis=-1)[i] == pytest.approx(numpy.mean(xi))
+        assert awkward1.mean(x, weight=w, axis=-1)[i] == pytest.approx(numpy.average(xi, weights=wi))
+        assert awkward1.var(x, axis=-1)[i] == pytest.approx(numpy.var(xi))
+        assert awkward1.std(x, ddof=1, axis=-1)[i] == pytest.approx(numpy.std(xi, ddof=1))
+        assert awkward1.covar(x, y, axis=-1)[i] == pytest.approx(numpy.cov(xi, yi, bias=True)[0, 1])
+        assert awkward1.corr(x, y, axis=-1)[i] == pytest.approx(numpy.corrcoef(xi, yi)[0, 1])
+        slope, intercept = numpy.polyfit(xi, yi, 1)
+        fit = awkward1.linearfit(x, y, axis=-1)[i]
+        assert fit["slope"] == pytest.approx(slope)
+        assert fit["intercept"] == pytest.approx(intercept)
+    assert awkward1.mean(x, axis=None) == pytest.approx(3.0)
@@ -0,0 +1,47 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_carry_is_deferred():
+    array = awkward1.Array([{"x": 1, "y": [1.1]}, {"x": 2, "y": []}, {"x": 3, "y": [3.3, 3.3]}]).layout
+    carried = array[numpy.array([2, 0, 0])]
+    assert carried.islazy
+    assert awkward1.tolist(carried.field("x")) == [3, 1, 1]
+    assert carried.islazy
+    assert awkward1.tolist(carried.field("y")) == [[3.3, 3.3], [1.1], [1.1]]
+    assert not carried.islazy
+
+def test_values():
+    array = awkward1.Array([{"x": i, "y": [i] * i} for i in range(10)])
+    mask = numpy.array([i % 3 != 1 for i in range(10)])
+    expected = [{"x": i, "y": [i] * i} for i in range(10) if i % 3 != 1]
+    assert awkward1.tolist(array[mask]) == expected
+    assert awkward1.tolist(array[mask][::-1]) == expected[::-1]
+    assert awkward1.tolist(array[mask][1:4]) == expected[1:4]
+    assert awkward1.tolist(array[mask][[3, 0]]) == [expected[3], expected[0]]
+    assert awkward1.tolist(array[mask].layout.deep_copy()) == expected
+    assert array[mask][2].x == 3
+    assert awkward1.tolist(array[mask].y) == [x["y"] for x in expected]
+
+def test_errors():
+    array = awkward1.Array([{"x": 1}, {"x": 2}, {"x": 3}])
+    with pytest.raises(ValueError):
+        array[[0, 3]]
+    with pytest.raises(ValueError):
+        array[[0, 2]][[2]]
+
+def test_nbytes():
+    array = awkward1.Array([{"x": 1, "y": 1.1}, {"x": 2, "y": 2.2}]).layout
+    carried = array[numpy.array([1, 0, 1])]
+    assert carried.nbytes == 2*8 + 2*8 + 3*8
+    carried.field("x")
+    assert carried.nbytes == 3*8 + 2*8 + 3*8
+    carried.field("y")
+    assert carried.nbytes == 3*8 + 3*8
@@ -0,0 +1,39 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_indexed_of_indexed():
+    content = awkward1.layout.NumpyArray(numpy.array([0.0, 1.1, 2.2, 3.3, 4.4]))
+    inner = awkward1.layout.IndexedArray64(awkward1.layout.Index64(numpy.array([4, 3, 2, 1, 0])), content)
+    outer = awkward1.layout.IndexedArray32(awkward1.layout.Index32(numpy.array([0, 0, 2, 4], dtype=numpy.int32)), inner)
+    assert awkward1.tolist(outer) == [4.4, 4.4, 2.2, 0.0]
+    carried = outer[numpy.array([3, 2, 1])]
+    assert isinstance(carried, awkward1.layout.IndexedArray64)
+    assert isinstance(carried.content, awkward1.layout.NumpyArray)
+    assert awkward1.tolist(carried) == [0.0, 2.2, 4.4]
+    assert awkward1.tolist(carried[[1, 1]]) == [2.2, 2.2]
+
+def test_option():
+    content = awkward1.layout.NumpyArray(numpy.array([0.0, 1.1, 2.2, 3.3]))
+    inner = awkward1.layout.IndexedOptionArray64(awkward1.layout.Index64(numpy.array([3, -1, 1, 0])), content)
+    outer = awkward1.layout.IndexedArray64(awkward1.layout.Index64(numpy.array([1, 2, 3, 0])), inner)
+    carried = outer[numpy.array([0, 1, 3])]
+    assert isinstance(carried, awkward1.layout.IndexedOptionArray64)
+    assert isinstance(carried.content, awkward1.layout.NumpyArray)
+    assert awkward1.tolist(carried) == [None, 1.1, 3.3]
+
+def test_parameters_are_kept():
+    content = awkward1.layout.NumpyArray(numpy.array([0.0, 1.1, 2.2]))
+    inner = awkward1.layout.IndexedArray64(awkward1.layout.Index64(numpy.array([2, 1, 0])), content, parameters={"__array__": "categorical"})
+    outer = awkward1.layout.IndexedArray64(awkward1.layout.Index64(numpy.array([0, 1, 2])), inner)
+    carried = outer[numpy.array([2, 0])]
+    assert isinstance(carried.content, awkward1.layout.IndexedArray64)
+    assert carried.content.parameters == {"__array__": "categorical"}
+    assert awkward1.tolist(carried) == [0.0, 2.2]
@@ -0,0 +1,97 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import os
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_roundtrip(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    array = awkward1.Array([{"x": 1.1, "y": [1]}, {"x": 2.2, "y": []}, None, {"x": 3.3, "y": [1, 2, 3]}])
+    awkward1.tobinary(array, filename)
+    for mmap in (True, False):
+        out = awkward1.frombinary(filename, mmap=mmap)
+        assert awkward1.tolist(out) == awkward1.tolist(array)
+        assert str(awkward1.typeof(out)) == str(awkward1.typeof(array))
+
+def test_parameters_and_unions(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    array = awkward1.Array(["one", "two", "three"])
+    awkward1.tobinary(array, filename)
+    out = awkward1.frombinary(filename)
+    assert awkward1.tolist(out) == ["one", "two", "three"]
+    assert out.layout.parameters == array.layout.parameters
+
+    array = awkward1.Array([1, [2, 3], 4.4, []])
+    awkward1.tobinary(array, filename)
+    assert awkward1.tolist(awkward1.frombinary(filename)) == [1, [2, 3], 4.4, []]
+
+def test_noncontiguous(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    data = numpy.arange(24, dtype=numpy.int32).reshape(4, 6)[::2, 1::2]
+    awkward1.tobinary(awkward1.layout.NumpyArray(data), filename)
+    out = awkward1.frombinary(filename, highlevel=False)
+    assert numpy.asarray(out).tolist() == data.tolist()
+
+def test_errors(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    with open(filename, "wb") as file:
+        file.write(b"not an awkward file")
+    with pytest.raises(ValueError):
+        awkward1.frombinary(filename)
+
+def test_shape_overflow(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    awkward1.tobinary(awkward1.layout.NumpyArray(numpy.arange(6, dtype=numpy.int64)), filename)
+    with open(filename, "rb") as file:
+        data = file.read()
+    # itemsize, ndim, shape: 8 * 2**61 bytes would wrap around to zero
+    header = numpy.array([8, 1, 6], dtype=numpy.int64).tobytes()
+    assert header in data
+    data = data.replace(header, numpy.array([8, 1, 2**61], dtype=numpy.int64).tobytes())
+    with open(filename, "wb") as file:
+        file.write(data)
+    with pytest.raises(ValueError):
+        awkward1.frombinary(filename)
+
+def test_format_itemsize_mismatch(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    awkward1.tobinary(awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3, 4.4])), filename)
+    with open(filename, "rb") as file:
+        data = file.read()
+    header = numpy.array([8, 1, 4], dtype=numpy.int64).tobytes()
+    assert header in data
+    data = data.replace(header, numpy.array([1, 1, 4], dtype=numpy.int64).tobytes())
+    with open(filename, "wb") as file:
+        file.write(data)
+    with pytest.raises(ValueError):
+        awkward1.frombinary(filename)
+
+def test_invalid_layout(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    offsets = awkward1.layout.Index64(numpy.array([0, 2, 4], dtype=numpy.int64))
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3, 4.4]))
+    awkward1.tobinary(awkward1.layout.ListOffsetArray64(offsets, content), filename)
+    with open(filename, "rb") as file:
+        data = file.read()
+    buffer = numpy.array([0, 2, 4], dtype=numpy.int64).tobytes()
+    assert buffer in data
+    data = data.replace(buffer, numpy.array([0, 2, 400], dtype=numpy.int64).tobytes())
+    with open(filename, "wb") as file:
+        file.write(data)
+    with pytest.raises(ValueError):
+        awkward1.frombinary(filename)
+
+def test_too_deep(tmp_path):
+    filename = os.path.join(str(tmp_path), "test.awkward")
+    layout = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3]))
+    for i in range(1500):
+        layout = awkward1.layout.RegularArray(layout, 1)
+    awkward1.tobinary(layout, filename)
+    with pytest.raises(ValueError):
+        awkward1.frombinary(filename)
@@ -0,0 +1,39 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import os
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def write(tmp_path, text):
+    filename = os.path.join(str(tmp_path), "test.jsonl")
+    with open(filename, "w") as file:
+        file.write(text)
+    return filename
+
+def test_chunks(tmp_path):
+    filename = write(tmp_path, "".join('{{"x": {0}, "y": [{0}]}}\n'.format(i) for i in range(10)))
+    chunks = list(awkward1.fromjsonlines(filename, chunksize=4))
+    assert [len(x) for x in chunks] == [4, 4, 2]
+    assert sum((awkward1.tolist(x) for x in chunks), []) == [{"x": i, "y": [i]} for i in range(10)]
+
+def test_chunkbytes(tmp_path):
+    filename = write(tmp_path, "".join("[{0}, {0}]\n".format(i) for i in range(100)))
+    chunks = list(awkward1.fromjsonlines(filename, chunksize=None, chunkbytes=100))
+    assert len(chunks) > 1
+    assert sum((awkward1.tolist(x) for x in chunks), []) == [[i, i] for i in range(100)]
+
+def test_scalars_and_blank_lines(tmp_path):
+    filename = write(tmp_path, "1\n\n2.5\n  null\n\n")
+    assert [awkward1.tolist(x) for x in awkward1.fromjsonlines(filename)] == [[1, 2.5, None]]
+    assert list(awkward1.fromjsonlines(write(tmp_path, "\n"))) == []
+
+def test_error(tmp_path):
+    filename = write(tmp_path, '{"x": 1}\n{"x": \n')
+    with pytest.raises(ValueError):
+        list(awkward1.fromjsonlines(filename))
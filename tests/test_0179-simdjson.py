@@ -0,0 +1,40 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import os
+
+import pytest
+import numpy
+
+import awkward1
+
+pytestmark = pytest.mark.skipif(not awkward1._io.simdjson_available(), reason="awkward1 was compiled without simdjson")
+
+documents = [
+    "[1, 2, 3.5, null, true]",
+    "[[1, 2], [], [3]]",
+    "[[[1.1, 2.2], []], [[3]]]",
+    '[{"x": 1, "y": "hey"}, {"x": 2, "y": "there"}]',
+    '[{"x": 1, "y": [1, 2]}, {"x": 2}, null]',
+    '{"x": 1, "y": [1, 2]}',
+    "[]",
+]
+
+def test_same_as_rapidjson():
+    for document in documents:
+        one = awkward1.fromjson(document)
+        two = awkward1.fromjson(document, simdjson=True)
+        assert awkward1.tolist(one) == awkward1.tolist(two)
+        assert str(awkward1.typeof(one)) == str(awkward1.typeof(two))
+
+def test_file(tmp_path):
+    filename = os.path.join(str(tmp_path), "tmp.json")
+    with open(filename, "w") as file:
+        file.write("[[1.5, 2], [], [3]]")
+    assert awkward1.tolist(awkward1.fromjson(filename, simdjson=True, buffersize=4)) == [[1.5, 2], [], [3]]
+
+def test_error():
+    with pytest.raises(ValueError):
+        awkward1.fromjson("[1, 2", simdjson=True)
@@ -0,0 +1,54 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import os
+import json
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_numpyarray():
+    for dtype in (numpy.int8, numpy.uint8, numpy.int16, numpy.uint16, numpy.int32, numpy.uint32, numpy.int64, numpy.uint64, numpy.float32, numpy.float64):
+        array = numpy.arange(10, dtype=dtype)
+        assert json.loads(awkward1.layout.NumpyArray(array).tojson()) == array.tolist()
+        assert json.loads(awkward1.layout.NumpyArray(array[::3]).tojson()) == array[::3].tolist()
+    array = numpy.array([True, False, True])
+    assert awkward1.layout.NumpyArray(array).tojson() == "[true,false,true]"
+    assert awkward1.layout.NumpyArray(numpy.array([1.25, 0.1, 3.0])).tojson() == "[1.25,0.1,3.0]"
+    assert awkward1.layout.NumpyArray(numpy.array([1.23456, 2.0])).tojson(maxdecimals=2) == "[1.23,2.0]"
+
+def test_listoffsetarray():
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3, 4.4, 5.5, 6.6]))
+    for cls, indexcls, dtype in [(awkward1.layout.ListOffsetArray32, awkward1.layout.Index32, numpy.int32),
+                                 (awkward1.layout.ListOffsetArrayU32, awkward1.layout.IndexU32, numpy.uint32),
+                                 (awkward1.layout.ListOffsetArray64, awkward1.layout.Index64, numpy.int64)]:
+        offsets = indexcls(numpy.array([1, 4, 4, 6], dtype=dtype))
+        array = cls(offsets, content)
+        assert array.tojson() == "[[2.2,3.3,4.4],[],[5.5,6.6]]"
+        assert array[1:].tojson() == "[[],[5.5,6.6]]"
+        assert json.loads(array.tojson(pretty=True)) == awkward1.tolist(array)
+
+    offsets = awkward1.layout.Index64(numpy.array([0, 2, 10]))
+    with pytest.raises(ValueError):
+        awkward1.layout.ListOffsetArray64(offsets, content).tojson()
+
+def test_strings_not_bulk():
+    array = awkward1.Array(["one", "two", "three"]).layout
+    assert array.tojson() == '["one","two","three"]'
+
+def test_file(tmp_path):
+    array = awkward1.Array([[[1.1, 2.2], []], [[3.3]], numpy.arange(1000).reshape(100, 10).tolist()])
+    filename = os.path.join(str(tmp_path), "tmp.json")
+    array.layout.tojson(filename, buffersize=100)
+    with open(filename) as file:
+        assert json.load(file) == [awkward1.tolist(array)]
+
+@pytest.mark.skipif(not os.path.exists("/dev/full"), reason="needs /dev/full")
+def test_file_write_error():
+    array = awkward1.layout.NumpyArray(numpy.arange(100000))
+    with pytest.raises(RuntimeError):
+        array.tojson("/dev/full", buffersize=100)
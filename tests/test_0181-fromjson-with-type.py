@@ -0,0 +1,76 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import os
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_records():
+    t = awkward1.typeof(awkward1.Array([{"x": 1, "y": [1.1], "z": "s"}]))
+    array = awkward1.fromjson('[{"x": 1, "y": [1.1, 2], "z": "hello"}, {"z": "", "y": [], "x": 2}]', type=t)
+    assert awkward1.tolist(array) == [{"x": 1, "y": [1.1, 2.0], "z": "hello"}, {"x": 2, "y": [], "z": ""}]
+    assert str(awkward1.typeof(array)) == "2 * " + str(t.type)
+    with pytest.raises(ValueError):
+        awkward1.fromjson('[{"x": 1, "y": [1.1]}]', type=t)
+    with pytest.raises(ValueError):
+        awkward1.fromjson('[{"x": 1.5, "y": [1.1], "z": "s"}]', type=t)
+    with pytest.raises(ValueError):
+        awkward1.fromjson('[{"x": 1, "y": [1.1], "z": "s", "w": [1, {}]}]', type=t)
+    array = awkward1.fromjson('[{"x": 1, "y": [1.1], "z": "s", "w": [1, {}]}]', type=t, nullfill=True)
+    assert awkward1.tolist(array) == [{"x": 1, "y": [1.1], "z": "s"}]
+
+def test_nullfill():
+    t = awkward1.typeof(awkward1.Array([{"x": 1, "y": None}, {"x": None, "y": [1.1]}, None]))
+    array = awkward1.fromjson('[{"x": 1, "y": null}, null, {"x": "bad", "y": {"q": [1]}}, {}]', type=t, nullfill=True)
+    assert awkward1.tolist(array) == [{"x": 1, "y": None}, None, {"x": None, "y": None}, {"x": None, "y": None}]
+    with pytest.raises(ValueError):
+        awkward1.fromjson('[{"x": "bad"}]', type=t)
+    assert awkward1.tolist(awkward1.fromjson('[{"x": 3}]', type=t)) == [{"x": 3, "y": None}]
+
+def test_fields_with_and_without_nullfill():
+    t = awkward1.typeof(awkward1.Array([{"x": 1, "y": None}, {"x": 2, "y": 2.2}]))
+    for nullfill in (False, True):
+        # a missing field of option type is None either way
+        assert awkward1.tolist(awkward1.fromjson('[{"x": 3}]', type=t, nullfill=nullfill)) == [{"x": 3, "y": None}]
+        # a missing field of any other type is an error either way
+        with pytest.raises(ValueError):
+            awkward1.fromjson('[{"y": 3.3}]', type=t, nullfill=nullfill)
+    # an unknown field is only skipped with nullfill
+    with pytest.raises(ValueError):
+        awkward1.fromjson('[{"x": 3, "z": 1}]', type=t)
+    assert awkward1.tolist(awkward1.fromjson('[{"x": 3, "z": 1}]', type=t, nullfill=True)) == [{"x": 3, "y": None}]
+
+    t = awkward1.typeof(awkward1.Array([(1, None), (2, 2.2)]))
+    assert awkward1.tolist(awkward1.fromjson('[[3]]', type=t)) == [(3, None)]
+    with pytest.raises(ValueError):
+        awkward1.fromjson('[[3, 3.3, "extra"]]', type=t)
+    assert awkward1.tolist(awkward1.fromjson('[[3, 3.3, "extra"]]', type=t, nullfill=True)) == [(3, 3.3)]
+
+def test_nested_and_regular():
+    t = awkward1.typeof(awkward1.Array([[[1.1, 2.2], []], [[3.3]]]))
+    assert awkward1.tolist(awkward1.fromjson("[[[1, 2], []], [], [[3.5]]]", type=t)) == [[[1.0, 2.0], []], [], [[3.5]]]
+    with pytest.raises(ValueError):
+        awkward1.fromjson("[[[1, true]]]", type=t)
+    t = awkward1.typeof(awkward1.Array(numpy.array([[1, 2], [3, 4]], dtype=numpy.int32)))
+    array = awkward1.fromjson("[[1, 2], [3, 4], [5, 6]]", type=t)
+    assert awkward1.tolist(array) == [[1, 2], [3, 4], [5, 6]]
+    assert str(awkward1.typeof(array)) == "3 * 2 * int32"
+    with pytest.raises(ValueError):
+        awkward1.fromjson("[[1, 2], [3]]", type=t)
+
+def test_unions():
+    t = awkward1.typeof(awkward1.Array([[1], "s"]))
+    with pytest.raises(ValueError):
+        awkward1.fromjson("[[1]]", type=t)
+
+def test_file(tmp_path):
+    filename = os.path.join(str(tmp_path), "tmp.json")
+    with open(filename, "w") as file:
+        file.write('[{"x": 1}, {"x": 2}]')
+    t = awkward1.typeof(awkward1.Array([{"x": 1}]))
+    assert awkward1.tolist(awkward1.fromjson(filename, type=t, buffersize=4)) == [{"x": 1}, {"x": 2}]
@@ -0,0 +1,95 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <cstdint>
+#include <memory>
+
+#include "awkward/Allocator.h"
+#include "awkward/Index.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/GrowableBuffer.h"
+
+namespace ak = awkward;
+
+bool aligned(const void* ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % ak::kAllocatorAlignment == 0;
+}
+
+int main(int, char**)
+{
+  std::shared_ptr<ak::CountingAllocator> counting =
+    std::make_shared<ak::CountingAllocator>(ak::global_allocator());
+
+  // scoped override: everything in the scope is counted
+  {
+    ak::AllocatorScope scope(counting);
+    ak::Index64 index(100);
+    if (!aligned(index.ptr().get())) {return -1;}
+    if (counting.get()->allocations() != 1) {return -1;}
+    if (counting.get()->bytes_in_use() != 800) {return -1;}
+
+    ak::Index64 copy = index.deep_copy();
+    if (counting.get()->allocations() != 2) {return -1;}
+  }
+  // buffers are returned to the allocator that made them
+  if (counting.get()->bytes_in_use() != 0) {return -1;}
+  if (counting.get()->allocations() != counting.get()->deallocations()) {
+    return -1;
+  }
+
+  // outside the scope, the global allocator is used again
+  int64_t before = counting.get()->allocations();
+  ak::Index64 unscoped(10);
+  if (counting.get()->allocations() != before) {return -1;}
+
+  // global override (and restoring the default)
+  ak::AllocatorPtr previous = ak::global_allocator();
+  ak::set_global_allocator(counting);
+  {
+    ak::GrowableBuffer<double> buffer =
+      ak::GrowableBuffer<double>::empty(ak::ArrayBuilderOptions(16, 2.0));
+    for (int64_t i = 0;  i < 100;  i++) {
+      buffer.append((double)i);
+    }
+    if (!aligned(buffer.ptr().get())) {return -1;}
+  }
+  ak::set_global_allocator(previous);
+  if (counting.get()->allocations() == before) {return -1;}
+  if (counting.get()->bytes_in_use() != 0) {return -1;}
+  if (counting.get()->peak_bytes_in_use() < 800) {return -1;}
+
+  // huge pages above the threshold, heap memory below it
+  std::shared_ptr<ak::CountingAllocator> huge =
+    std::make_shared<ak::CountingAllocator>(
+      std::make_shared<ak::HugePageAllocator>(1024*1024));
+  {
+    ak::AllocatorScope scope(huge);
+    ak::Index64 small(10);
+    ak::Index64 large(1000000);
+    int64_t* ptr = large.ptr().get();
+    for (int64_t i = 0;  i < large.length();  i++) {
+      ptr[i] = i;
+    }
+    if (ptr[999999] != 999999) {return -1;}
+    if (!aligned(small.ptr().get())  ||  !aligned(ptr)) {return -1;}
+  }
+  if (huge.get()->allocations() != 2) {return -1;}
+  if (huge.get()->bytes_in_use() != 0) {return -1;}
+
+  // the ArrayBuilder's buffers come from the current allocator, too
+  std::shared_ptr<ak::CountingAllocator> building =
+    std::make_shared<ak::CountingAllocator>(ak::global_allocator());
+  {
+    ak::AllocatorScope scope(building);
+    ak::ArrayBuilder builder(ak::ArrayBuilderOptions(1024, 2.0));
+    for (int64_t i = 0;  i < 10000;  i++) {
+      builder.integer(i);
+    }
+    std::shared_ptr<ak::Content> array = builder.snapshot();
+    if (array.get()->length() != 10000) {return -1;}
+  }
+  if (building.get()->allocations() < 5) {return -1;}
+  if (building.get()->bytes_in_use() != 0) {return -1;}
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <memory>
+
+#include "awkward/Allocator.h"
+#include "awkward/Reducer.h"
+#include "awkward/Slice.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+
+namespace ak = awkward;
+
+double value(const ak::ContentPtr& scalar) {
+  ak::NumpyArray* raw = dynamic_cast<ak::NumpyArray*>(scalar.get());
+  return *reinterpret_cast<double*>(raw->byteptr());
+}
+
+int main(int, char**)
+{
+  // 1000 lists of 3 lists of 4 numbers: x[i][j][k] = 100*i + 10*j + k
+  ak::ArrayBuilder builder(ak::ArrayBuilderOptions(1024, 2.0));
+  for (int64_t i = 0;  i < 1000;  i++) {
+    builder.beginlist();
+    for (int64_t j = 0;  j < 3;  j++) {
+      builder.beginlist();
+      for (int64_t k = 0;  k < 4;  k++) {
+        builder.real((double)(100*i + 10*j + k));
+      }
+      builder.endlist();
+    }
+    builder.endlist();
+  }
+  ak::ContentPtr array = builder.snapshot();
+
+  ak::Slice where;
+  where.append(ak::SliceRange(ak::Slice::none(), ak::Slice::none(), 1));
+  where.append(ak::SliceRange(1, ak::Slice::none(), 1));
+  where.append(ak::SliceAt(2));
+  where.become_sealed();
+
+  std::shared_ptr<ak::CountingAllocator> counting =
+    std::make_shared<ak::CountingAllocator>(ak::global_allocator());
+  ak::AllocatorScope scope(counting);
+
+  // the first call allocates the arena's chunk; later calls reuse it, so
+  // they allocate only the buffers of the result, the same number each time
+  int64_t before = counting.get()->allocations();
+  ak::ContentPtr first = array.get()->getitem(where);
+  int64_t firstcount = counting.get()->allocations() - before;
+  before = counting.get()->allocations();
+  ak::ContentPtr second = array.get()->getitem(where);
+  int64_t count = counting.get()->allocations() - before;
+  if (firstcount != count + 1) {return -1;}
+  before = counting.get()->allocations();
+  for (int64_t n = 0;  n < 10;  n++) {
+    second = array.get()->getitem(where);
+  }
+  if (counting.get()->allocations() - before != 10*count) {return -1;}
+
+  ak::ContentPtr check = second.get()->getitem_at_nowrap(999);
+  if (check.get()->length() != 2) {return -1;}
+  if (value(check.get()->getitem_at_nowrap(0)) != 99912.0) {return -1;}
+  if (value(check.get()->getitem_at_nowrap(1)) != 99922.0) {return -1;}
+  check = first.get()->getitem_at_nowrap(5);
+  if (value(check.get()->getitem_at_nowrap(1)) != 522.0) {return -1;}
+
+  // without a ScratchScope, the same temporaries are separate allocations
+  before = counting.get()->allocations();
+  {
+    ak::Index64 nextcarry = ak::Index64::scratch(100);
+    ak::Index64 nextadvanced = ak::Index64::scratch(100);
+  }
+  if (counting.get()->allocations() - before != 2) {return -1;}
+  before = counting.get()->allocations();
+  {
+    ak::ScratchScope scratch;
+    ak::Index64 nextcarry = ak::Index64::scratch(100);
+    ak::Index64 nextadvanced = ak::Index64::scratch(100);
+    if (!ak::is_scratch(nextcarry.ptr().get())) {return -1;}
+    if (nextadvanced.ptr().get() == nextcarry.ptr().get()) {return -1;}
+  }
+  if (counting.get()->allocations() != before) {return -1;}
+
+  // arrays in a chunk that the scope outgrew are still recognized as scratch
+  {
+    ak::ScratchScope scratch;
+    ak::Index64 small = ak::Index64::scratch(100);
+    ak::Index64 big = ak::Index64::scratch(100000);
+    if (!ak::is_scratch(small.ptr().get())) {return -1;}
+    if (!ak::is_scratch(big.ptr().get())) {return -1;}
+  }
+
+  // reduction through the non-local path: sum over j (axis=1)
+  ak::ReducerSum sum;
+  ak::ContentPtr reduced = array.get()->reduce(sum, 1, false, false);
+  check = reduced.get()->getitem_at_nowrap(7);
+  if (check.get()->length() != 4) {return -1;}
+  if (value(check.get()->getitem_at_nowrap(3)) != 3*(700.0 + 3.0) + 30.0) {
+    return -1;
+  }
+
+  // a RecordArray's lazy carry is copied out of the arena, so the arena's
+  // chunk is reused (overwritten) without changing the carried records
+  ak::ContentPtr records = std::make_shared<ak::RecordArray>(
+    ak::Identities::none(),
+    ak::util::Parameters(),
+    ak::ContentPtrVec({ array }),
+    ak::util::RecordLookupPtr(nullptr));
+  ak::ContentPtr carried;
+  {
+    ak::ScratchScope scratch;
+    ak::Index64 carry = ak::Index64::scratch(3);
+    carry.setitem_at_nowrap(0, 5);
+    carry.setitem_at_nowrap(1, 6);
+    carry.setitem_at_nowrap(2, 7);
+    carried = records.get()->carry(carry);
+  }
+  for (int64_t n = 0;  n < 10;  n++) {
+    array.get()->getitem(where);
+  }
+  ak::RecordArray* raw = dynamic_cast<ak::RecordArray*>(carried.get());
+  if (raw == nullptr) {return -1;}
+  check = raw->field(0).get()->getitem_at_nowrap(1);
+  if (value(check.get()->getitem_at_nowrap(2).get()->getitem_at_nowrap(3))
+      != 623.0) {return -1;}
+
+  // a range of it shares the carry, and carries through it correctly
+  ak::Index64 reverse(2);
+  reverse.setitem_at_nowrap(0, 1);
+  reverse.setitem_at_nowrap(1, 0);
+  ak::ContentPtr ranged = carried.get()->getitem_range_nowrap(1, 3);
+  ak::ContentPtr twice = ranged.get()->carry(reverse);
+  raw = dynamic_cast<ak::RecordArray*>(ranged.get());
+  check = raw->field(0).get()->getitem_at_nowrap(0);
+  if (value(check.get()->getitem_at_nowrap(2).get()->getitem_at_nowrap(3))
+      != 623.0) {return -1;}
+  raw = dynamic_cast<ak::RecordArray*>(twice.get());
+  check = raw->field(0).get()->getitem_at_nowrap(0);
+  if (value(check.get()->getitem_at_nowrap(2).get()->getitem_at_nowrap(3))
+      != 723.0) {return -1;}
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <memory>
+
+#include "awkward/Allocator.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/GrowableBuffer.h"
+
+namespace ak = awkward;
+
+int main(int, char**)
+{
+  const int64_t length = 1000000;
+
+  // copying growth: the old and new buffers coexist at every resize
+  std::shared_ptr<ak::CountingAllocator> copying =
+    std::make_shared<ak::CountingAllocator>(ak::global_allocator());
+  {
+    ak::AllocatorScope scope(copying);
+    ak::GrowableBuffer<int64_t> buffer =
+      ak::GrowableBuffer<int64_t>::empty(ak::ArrayBuilderOptions(1024, 2.0));
+    for (int64_t i = 0;  i < length;  i++) {
+      buffer.append(i);
+    }
+  }
+
+  // reallocating growth: one buffer, resized
+  std::shared_ptr<ak::CountingAllocator> reallocating =
+    std::make_shared<ak::CountingAllocator>(ak::global_allocator());
+  {
+    ak::AllocatorScope scope(reallocating);
+    ak::GrowableBuffer<int64_t> buffer =
+      ak::GrowableBuffer<int64_t>::empty(
+        ak::ArrayBuilderOptions(1024, 2.0, true));
+    for (int64_t i = 0;  i < length;  i++) {
+      buffer.append(i);
+    }
+    for (int64_t i = 0;  i < length;  i++) {
+      if (buffer.getitem_at_nowrap(i) != i) {return -1;}
+    }
+    if (buffer.reserved() < length) {return -1;}
+  }
+  if (reallocating.get()->allocations() != 1) {return -1;}
+  if (reallocating.get()->reallocations() == 0) {return -1;}
+  if (reallocating.get()->bytes_in_use() != 0) {return -1;}
+  if (reallocating.get()->peak_bytes_in_use() >=
+      copying.get()->peak_bytes_in_use()) {return -1;}
+
+  // a snapshot shares the buffer, so the next resize copies instead
+  {
+    ak::ArrayBuilder builder(ak::ArrayBuilderOptions(8, 2.0, true));
+    for (int64_t i = 0;  i < 8;  i++) {
+      builder.real((double)i);
+    }
+    ak::ContentPtr first = builder.snapshot();
+    for (int64_t i = 8;  i < 100;  i++) {
+      builder.real((double)i);
+    }
+    ak::ContentPtr second = builder.snapshot();
+    if (first.get()->length() != 8  ||  second.get()->length() != 100) {
+      return -1;
+    }
+    double* raw = reinterpret_cast<double*>(
+      dynamic_cast<ak::NumpyArray*>(first.get())->byteptr());
+    if (raw[7] != 7.0) {return -1;}
+    raw = reinterpret_cast<double*>(
+      dynamic_cast<ak::NumpyArray*>(second.get())->byteptr());
+    if (raw[7] != 7.0  ||  raw[99] != 99.0) {return -1;}
+  }
+
+  // with reserved address space, a shared buffer grows in place: the
+  // snapshots keep sharing it and its prefix is never copied
+  std::shared_ptr<ak::CountingAllocator> reserving =
+    std::make_shared<ak::CountingAllocator>(
+      std::make_shared<ak::ReservingAllocator>(64*1024*1024));
+  {
+    ak::AllocatorScope scope(reserving);
+    ak::ArrayBuilder builder(ak::ArrayBuilderOptions(8, 2.0));
+    for (int64_t i = 0;  i < 8;  i++) {
+      builder.real((double)i);
+    }
+    ak::ContentPtr first = builder.snapshot();
+    for (int64_t i = 8;  i < length;  i++) {
+      builder.real((double)i);
+    }
+    ak::ContentPtr second = builder.snapshot();
+    if (first.get()->length() != 8  ||  second.get()->length() != length) {
+      return -1;
+    }
+    void* one = dynamic_cast<ak::NumpyArray*>(first.get())->byteptr();
+    void* two = dynamic_cast<ak::NumpyArray*>(second.get())->byteptr();
+    if (one != two) {return -1;}
+    double* raw = reinterpret_cast<double*>(two);
+    if (raw[7] != 7.0  ||  raw[length - 1] != (double)(length - 1)) {
+      return -1;
+    }
+  }
+  if (reserving.get()->allocations() != 1) {return -1;}
+  if (reserving.get()->bytes_in_use() != 0) {return -1;}
+
+  // an empty buffer keeps a reservation that can grow
+  {
+    ak::GrowableBuffer<double> buffer =
+      ak::GrowableBuffer<double>::empty(ak::ArrayBuilderOptions(8, 2.0, true));
+    buffer.shrink_to_fit();
+    if (buffer.reserved() == 0) {return -1;}
+    for (int64_t i = 0;  i < 100;  i++) {
+      buffer.append((double)i);
+    }
+    if (buffer.getitem_at_nowrap(99) != 99.0) {return -1;}
+  }
+
+  // a resize factor of 1 or less still grows
+  {
+    ak::GrowableBuffer<double> buffer =
+      ak::GrowableBuffer<double>::empty(ak::ArrayBuilderOptions(2, 1.0));
+    double values[5] = { 0.0, 1.0, 2.0, 3.0, 4.0 };
+    buffer.extend(values, 5);
+    for (int64_t i = 5;  i < 100;  i++) {
+      buffer.append((double)i);
+    }
+    if (buffer.length() != 100  ||
+        buffer.getitem_at_nowrap(4) != 4.0  ||
+        buffer.getitem_at_nowrap(99) != 99.0) {return -1;}
+  }
+
+  // huge pages are resized with mremap
+  std::shared_ptr<ak::CountingAllocator> huge =
+    std::make_shared<ak::CountingAllocator>(
+      std::make_shared<ak::HugePageAllocator>(1024*1024));
+  {
+    ak::AllocatorScope scope(huge);
+    ak::GrowableBuffer<double> buffer =
+      ak::GrowableBuffer<double>::empty(
+        ak::ArrayBuilderOptions(1024, 1.5, true));
+    for (int64_t i = 0;  i < length;  i++) {
+      buffer.append((double)i);
+    }
+    for (int64_t i = 0;  i < length;  i += 997) {
+      if (buffer.getitem_at_nowrap(i) != (double)i) {return -1;}
+    }
+  }
+  if (huge.get()->allocations() != 1) {return -1;}
+  if (huge.get()->bytes_in_use() != 0) {return -1;}
+
+  return 0;
+}
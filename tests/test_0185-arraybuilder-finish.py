@@ -0,0 +1,60 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_finish():
+    builder = awkward1.layout.ArrayBuilder(initial=4)
+    for i in range(10):
+        builder.beginlist()
+        for j in range(i % 3):
+            builder.real(i + 0.1*j)
+        builder.endlist()
+    array = builder.finish()
+    assert awkward1.tolist(array) == [[], [1.0], [2.0, 2.1], [], [4.0], [5.0, 5.1], [], [7.0], [8.0, 8.1], []]
+    assert len(builder) == 0
+    builder.beginlist()
+    builder.real(99.9)
+    builder.endlist()
+    assert awkward1.tolist(builder.snapshot()) == [[99.9]]
+    assert awkward1.tolist(array)[8] == [8.0, 8.1]
+
+def test_finish_noshrink():
+    builder = awkward1.layout.ArrayBuilder()
+    for i in range(5):
+        builder.integer(i)
+    assert awkward1.tolist(builder.finish(shrink=False)) == [0, 1, 2, 3, 4]
+    assert len(builder) == 0
+
+def test_snapshot_then_append():
+    builder = awkward1.layout.ArrayBuilder(initial=4, reallocate=True)
+    for i in range(4):
+        builder.integer(i)
+    first = builder.snapshot()
+    for i in range(4, 100):
+        builder.integer(i)
+    second = builder.snapshot()
+    for i in range(100, 1000):
+        builder.integer(i)
+    assert awkward1.tolist(first) == list(range(4))
+    assert awkward1.tolist(second) == list(range(100))
+    assert awkward1.tolist(builder.finish()) == list(range(1000))
+    assert awkward1.tolist(first) == list(range(4))
+
+def test_records():
+    builder = awkward1.layout.ArrayBuilder()
+    for i in range(3):
+        builder.beginrecord()
+        builder.field("x")
+        builder.integer(i)
+        builder.field("y")
+        builder.string(str(i))
+        builder.endrecord()
+    array = builder.finish()
+    assert awkward1.tolist(array) == [{"x": 0, "y": "0"}, {"x": 1, "y": "1"}, {"x": 2, "y": "2"}]
@@ -0,0 +1,194 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/TypedBuilder.h"
+#include "awkward/type/ListType.h"
+#include "awkward/type/PrimitiveType.h"
+
+namespace ak = awkward;
+
+// [{"x": i, "y": [0.0, 1.1, ...(i % 4 numbers)], "z": "i % 10" or None}]
+using Builder =
+  ak::TypedListBuilder<
+    ak::TypedRecordBuilder<
+      ak::TypedNumpyBuilder<int64_t>,
+      ak::TypedListBuilder<ak::TypedNumpyBuilder<double>>,
+      ak::TypedOptionBuilder<ak::TypedStringBuilder>>>;
+
+const int64_t kLength = 100000;
+
+void
+fill_typed(Builder& builder) {
+  auto& record = builder.begin_list();
+  for (int64_t i = 0;  i < kLength;  i++) {
+    record.field<0>().append(i);
+    auto& y = record.field<1>().begin_list();
+    for (int64_t j = 0;  j < i % 4;  j++) {
+      y.append(1.1*j);
+    }
+    record.field<1>().end_list();
+    if (i % 3 == 0) {
+      record.field<2>().null();
+    }
+    else {
+      record.field<2>().valid().append(std::to_string(i % 10));
+    }
+    record.end_record();
+  }
+  builder.end_list();
+}
+
+void
+fill_dynamic(ak::ArrayBuilder& builder) {
+  builder.beginlist();
+  for (int64_t i = 0;  i < kLength;  i++) {
+    builder.beginrecord();
+    builder.field_check("x");
+    builder.integer(i);
+    builder.field_check("y");
+    builder.beginlist();
+    for (int64_t j = 0;  j < i % 4;  j++) {
+      builder.real(1.1*j);
+    }
+    builder.endlist();
+    builder.field_check("z");
+    if (i % 3 == 0) {
+      builder.null();
+    }
+    else {
+      builder.string(std::to_string(i % 10));
+    }
+    builder.endrecord();
+  }
+  builder.endlist();
+}
+
+int main(int, char**)
+{
+  ak::ArrayBuilderOptions options(1024, 2.0);
+
+  ak::ArrayBuilder dynamic(options);
+  fill_dynamic(dynamic);
+  ak::ContentPtr expected = dynamic.snapshot();
+
+  // constructed from the type that ArrayBuilder discovered
+  ak::TypePtr type = expected.get()->type(ak::util::TypeStrs());
+  Builder typed(options, type);
+  fill_typed(typed);
+  ak::ContentPtr array = typed.finish();
+
+  if (!array.get()->type(ak::util::TypeStrs()).get()->equal(type, true)) {
+    return -1;
+  }
+  if (array.get()->length() != 1  ||  typed.length() != 0) {return -1;}
+
+  ak::ContentPtr records =
+    dynamic_cast<ak::ListOffsetArray64*>(array.get())->content();
+  if (records.get()->length() != kLength) {return -1;}
+  ak::RecordArray* raw = dynamic_cast<ak::RecordArray*>(records.get());
+  if (raw->key(2) != std::string("z")) {return -1;}
+  ak::NumpyArray* x = dynamic_cast<ak::NumpyArray*>(raw->field(0).get());
+  if (reinterpret_cast<int64_t*>(x->byteptr())[kLength - 1] != kLength - 1) {
+    return -1;
+  }
+  ak::ContentPtr y = raw->field(1).get()->getitem_at_nowrap(7);
+  if (y.get()->length() != 3) {return -1;}
+  ak::ContentPtr z = raw->field(2).get()->getitem_at_nowrap(7);
+  if (z.get()->length() != 1) {return -1;}
+  ak::IndexedOptionArray64* option =
+    dynamic_cast<ak::IndexedOptionArray64*>(raw->field(2).get());
+  if (option->index().getitem_at_nowrap(6) != -1) {return -1;}
+
+  // constructed from template parameters and keys alone
+  ak::TypedRecordBuilder<ak::TypedNumpyBuilder<double>,
+                         ak::TypedRegularBuilder<
+                           ak::TypedNumpyBuilder<int32_t>>>
+    pairs(options, std::vector<std::string>({ "a", "b" }));
+  for (int32_t i = 0;  i < 10;  i++) {
+    pairs.field<0>().append(0.5*i);
+    const int32_t values[2] = { i, -i };
+    pairs.field<1>().begin_list().extend(values, 2);
+    pairs.field<1>().end_list();
+    pairs.end_record();
+  }
+  ak::ContentPtr pairarray = pairs.finish();
+  if (pairarray.get()->length() != 10) {return -1;}
+  if (pairarray.get()->type(ak::util::TypeStrs()).get()->tostring() !=
+      std::string("{\"a\": float64, \"b\": 2 * int32}")) {
+    return -1;
+  }
+
+  // a type of a different structure is an error
+  try {
+    ak::TypedListBuilder<ak::TypedNumpyBuilder<double>> wrong(options, type);
+    return -1;
+  }
+  catch (std::invalid_argument& err) { }
+
+  // so is a list that is not a string, even with the string parameters
+  ak::util::Parameters stringparameters;
+  stringparameters["__array__"] = "\"string\"";
+  ak::util::Parameters charparameters;
+  charparameters["__array__"] = "\"char\"";
+  ak::TypePtr strings = std::make_shared<ak::ListType>(
+    stringparameters,
+    "",
+    std::make_shared<ak::PrimitiveType>(charparameters,
+                                        "",
+                                        ak::PrimitiveType::uint8));
+  ak::TypedStringBuilder right(options, strings);
+  ak::TypePtr notstrings = std::make_shared<ak::ListType>(
+    stringparameters,
+    "",
+    std::make_shared<ak::PrimitiveType>(charparameters,
+                                        "",
+                                        ak::PrimitiveType::float64));
+  try {
+    ak::TypedStringBuilder wrong(options, notstrings);
+    return -1;
+  }
+  catch (std::invalid_argument& err) { }
+
+  // a field with a missing or an extra item is an error, and the record
+  // is not counted
+  pairs.field<0>().append(1.0);
+  try {
+    pairs.end_record();
+    return -1;
+  }
+  catch (std::invalid_argument& err) { }
+  if (pairs.length() != 0) {return -1;}
+  const int32_t values[2] = { 1, 2 };
+  pairs.field<1>().begin_list().extend(values, 2);
+  pairs.field<1>().end_list();
+  pairs.field<0>().append(2.0);
+  try {
+    pairs.end_record();
+    return -1;
+  }
+  catch (std::invalid_argument& err) { }
+  if (pairs.length() != 0) {return -1;}
+
+  // so is a regular list of the wrong size
+  ak::TypedRegularBuilder<ak::TypedNumpyBuilder<int32_t>> regular(options);
+  regular.begin_list().extend(values, 2);
+  regular.end_list();
+  regular.begin_list().extend(values, 1);
+  try {
+    regular.end_list();
+    return -1;
+  }
+  catch (std::invalid_argument& err) { }
+  if (regular.length() != 1) {return -1;}
+
+  return 0;
+}
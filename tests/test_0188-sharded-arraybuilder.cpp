@@ -0,0 +1,89 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/ShardedArrayBuilder.h"
+
+namespace ak = awkward;
+
+const int64_t kPerShard = 10000;
+
+// Item i is a list of i % 5 numbers, i + 0.25*j; shard 1 writes them as
+// reals, the others as integers (floor), and shard 2 makes every 100th
+// item None, so the shards' types have to be unified.
+void
+fill(ak::ArrayBuilder& builder, int64_t shard) {
+  for (int64_t i = shard*kPerShard;  i < (shard + 1)*kPerShard;  i++) {
+    if (shard == 2  &&  i % 100 == 0) {
+      builder.null();
+      continue;
+    }
+    builder.beginlist();
+    for (int64_t j = 0;  j < i % 5;  j++) {
+      if (shard == 1) {
+        builder.real((double)i + 0.25*j);
+      }
+      else {
+        builder.integer(i);
+      }
+    }
+    builder.endlist();
+  }
+}
+
+double
+value(const ak::ContentPtr& array, int64_t i, int64_t j) {
+  ak::ContentPtr item = array.get()->getitem_at_nowrap(i);
+  ak::ContentPtr number = item.get()->getitem_at_nowrap(j);
+  ak::NumpyArray* raw = dynamic_cast<ak::NumpyArray*>(number.get());
+  return *reinterpret_cast<double*>(raw->byteptr());
+}
+
+int main(int, char**)
+{
+  const int64_t numshards = 4;
+  ak::ShardedArrayBuilder builder(ak::ArrayBuilderOptions(1024, 2.0),
+                                  numshards);
+  std::vector<std::thread> producers;
+  for (int64_t shard = 0;  shard < numshards;  shard++) {
+    producers.push_back(std::thread(fill,
+                                    std::ref(builder.shard(shard)),
+                                    shard));
+  }
+  for (auto& x : producers) {
+    x.join();
+  }
+  if (builder.length() != numshards*kPerShard) {return -1;}
+
+  ak::ContentPtr array = builder.finish();
+  if (array.get()->length() != numshards*kPerShard) {return -1;}
+  if (builder.length() != 0) {return -1;}
+  std::string type = array.get()->type(ak::util::TypeStrs()).get()->tostring();
+  if (type != std::string("option[var * float64]")) {return -1;}
+
+  // in shard order, with the offsets of later shards shifted
+  if (array.get()->getitem_at_nowrap(3).get()->length() != 3) {return -1;}
+  if (value(array, 3, 2) != 3.0) {return -1;}
+  if (value(array, kPerShard + 4, 3) != kPerShard + 4.75) {return -1;}
+  if (value(array, 2*kPerShard + 1, 0) != 2*kPerShard + 1.0) {return -1;}
+  ak::IndexedOptionArray64* raw =
+    dynamic_cast<ak::IndexedOptionArray64*>(array.get());
+  if (raw == nullptr) {return -1;}
+  if (raw->index().getitem_at_nowrap(2*kPerShard + 100) != -1) {return -1;}
+  if (value(array, 4*kPerShard - 1, 3) != 4*kPerShard - 1.0) {return -1;}
+
+  // unfilled shards are skipped; an entirely unfilled builder is empty
+  ak::ShardedArrayBuilder sparse(ak::ArrayBuilderOptions(1024, 2.0), 3);
+  sparse.shard(1).integer(5);
+  if (sparse.snapshot().get()->length() != 1) {return -1;}
+  ak::ShardedArrayBuilder unfilled(ak::ArrayBuilderOptions(1024, 2.0), 3);
+  if (unfilled.snapshot().get()->length() != 0) {return -1;}
+
+  return 0;
+}
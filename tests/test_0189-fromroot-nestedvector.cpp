@@ -0,0 +1,150 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "awkward/cpu-kernels/parallel.h"
+#include "awkward/Identities.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/io/root.h"
+
+namespace ak = awkward;
+
+void appendlength(std::vector<uint8_t>& raw, uint32_t length) {
+  raw.push_back((uint8_t)(length >> 24));
+  raw.push_back((uint8_t)(length >> 16));
+  raw.push_back((uint8_t)(length >> 8));
+  raw.push_back((uint8_t)length);
+}
+
+void appendfloat(std::vector<uint8_t>& raw, float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(float));
+  appendlength(raw, bits);
+}
+
+// Entry i has i % 4 lists of j % 3 lists of ... of floats counting up.
+void appendlist(std::vector<uint8_t>& raw,
+                int64_t depth,
+                int64_t length,
+                float& counter) {
+  appendlength(raw, (uint32_t)length);
+  for (int64_t j = 0;  j < length;  j++) {
+    if (depth == 1) {
+      appendfloat(raw, counter);
+      counter += 1.0f;
+    }
+    else {
+      appendlist(raw, depth - 1, j % 3, counter);
+    }
+  }
+}
+
+ak::ContentPtr
+read(const std::vector<uint8_t>& raw,
+     const std::vector<int64_t>& byteoffsets,
+     int64_t depth) {
+  std::shared_ptr<uint8_t> rawptr(new uint8_t[raw.size()],
+                                  ak::util::array_deleter<uint8_t>());
+  std::memcpy(rawptr.get(), raw.data(), raw.size());
+  ak::NumpyArray rawdata(ak::Identities::none(),
+                         ak::util::Parameters(),
+                         rawptr,
+                         std::vector<ssize_t>({ (ssize_t)raw.size() }),
+                         std::vector<ssize_t>({ 1 }),
+                         0,
+                         1,
+                         "B");
+  std::shared_ptr<int64_t> offsetsptr(new int64_t[byteoffsets.size()],
+                                      ak::util::array_deleter<int64_t>());
+  std::memcpy(offsetsptr.get(),
+              byteoffsets.data(),
+              byteoffsets.size()*sizeof(int64_t));
+  ak::Index64 index(offsetsptr, 0, (int64_t)byteoffsets.size());
+  return ak::FromROOT_nestedvector(index,
+                                   rawdata,
+                                   depth,
+                                   4,
+                                   ">f",
+                                   ak::ArrayBuilderOptions(1024, 2.0));
+}
+
+bool sameoffsets(const ak::Index64& one, const ak::Index64& two) {
+  if (one.length() != two.length()) {
+    return false;
+  }
+  for (int64_t i = 0;  i < one.length();  i++) {
+    if (one.getitem_at_nowrap(i) != two.getitem_at_nowrap(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int, char**)
+{
+  const int64_t numentries = 10000;
+
+  for (int64_t depth = 1;  depth <= 3;  depth++) {
+    std::vector<uint8_t> raw;
+    std::vector<int64_t> byteoffsets = { 0 };
+    float counter = 0.0f;
+    for (int64_t i = 0;  i < numentries;  i++) {
+      appendlist(raw, depth, i % 4, counter);
+      byteoffsets.push_back((int64_t)raw.size());
+    }
+
+    awkward_parallel_set_numthreads(1);
+    ak::ContentPtr serial = read(raw, byteoffsets, depth);
+    awkward_parallel_set_numthreads(4);
+    awkward_parallel_set_threshold(100);
+    ak::ContentPtr parallel = read(raw, byteoffsets, depth);
+    awkward_parallel_set_numthreads(1);
+    awkward_parallel_set_threshold(65536);
+
+    if (serial.get()->length() != numentries) {return -1;}
+    ak::ContentPtr one = serial;
+    ak::ContentPtr two = parallel;
+    for (int64_t k = 0;  k < depth;  k++) {
+      ak::ListOffsetArray64* onelist =
+        dynamic_cast<ak::ListOffsetArray64*>(one.get());
+      ak::ListOffsetArray64* twolist =
+        dynamic_cast<ak::ListOffsetArray64*>(two.get());
+      if (onelist == nullptr  ||  twolist == nullptr) {return -1;}
+      if (!sameoffsets(onelist->offsets(), twolist->offsets())) {return -1;}
+      one = onelist->content();
+      two = twolist->content();
+    }
+
+    // the payload is in native byte order, with the '>' dropped
+    ak::NumpyArray* onenumpy = dynamic_cast<ak::NumpyArray*>(one.get());
+    ak::NumpyArray* twonumpy = dynamic_cast<ak::NumpyArray*>(two.get());
+    if (onenumpy == nullptr  ||  twonumpy == nullptr) {return -1;}
+    if (onenumpy->format() != "f") {return -1;}
+    if (onenumpy->length() != (int64_t)counter) {return -1;}
+    if (twonumpy->length() != (int64_t)counter) {return -1;}
+    float* onedata = reinterpret_cast<float*>(onenumpy->byteptr());
+    float* twodata = reinterpret_cast<float*>(twonumpy->byteptr());
+    for (int64_t i = 0;  i < onenumpy->length();  i++) {
+      if (onedata[i] != (float)i  ||  twodata[i] != (float)i) {return -1;}
+    }
+  }
+
+  // truncated data is an error, not an out-of-bounds read
+  std::vector<uint8_t> raw;
+  std::vector<int64_t> byteoffsets = { 0 };
+  float counter = 0.0f;
+  appendlist(raw, 2, 3, counter);
+  byteoffsets.push_back((int64_t)raw.size());
+  raw.resize(raw.size() - 2);
+  try {
+    read(raw, byteoffsets, 2);
+    return -1;
+  }
+  catch (std::invalid_argument& err) { }
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import multiprocessing
+import sys
+import threading
+import time
+
+import pytest
+import numpy
+
+import awkward1
+
+def jagged(numlists, listlength):
+    content = awkward1.layout.NumpyArray(numpy.arange(numlists*listlength, dtype=numpy.float64))
+    offsets = awkward1.layout.Index64(numpy.arange(0, numlists*listlength + 1, listlength, dtype=numpy.int64))
+    return awkward1.layout.ListOffsetArray64(offsets, content)
+
+def operations(array):
+    return (numpy.asarray(array.sum(axis=-1)).tolist(),
+            numpy.asarray(array.count(axis=-1)).tolist(),
+            numpy.asarray(array[:, 1:].flatten(axis=1)).tolist(),
+            awkward1.tolist(array[numpy.arange(0, len(array), 7)]),
+            awkward1.tolist(array.rpad(12, 1)[-3:]),
+            array[:100].tojson())
+
+def test_concurrent_readers():
+    array = jagged(20000, 10)
+    expected = operations(array)
+
+    results = [None]*8
+    errors = []
+    def run(i):
+        try:
+            for j in range(5):
+                results[i] = operations(array)
+        except Exception as err:
+            errors.append(err)
+
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(len(results))]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    assert errors == []
+    for result in results:
+        assert result == expected
+
+def wall(threads):
+    start = time.time()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return time.time() - start
+
+@pytest.mark.skipif(multiprocessing.cpu_count() < 2, reason="needs two cores")
+def test_calls_overlap():
+    array = jagged(200000, 10)
+
+    def work():
+        array.tojson()
+
+    # Two calls one after the other versus two calls in two threads: if the
+    # GIL were held inside tojson, the threads would take just as long.
+    ratios = []
+    for attempt in range(3):
+        serial = wall([threading.Thread(target=lambda: [work(), work()])])
+        parallel = wall([threading.Thread(target=work) for i in range(2)])
+        ratios.append(parallel / serial)
+    assert min(ratios) < 0.8
+
+def test_builders_in_threads():
+    def fill(i, out):
+        builder = awkward1.layout.ArrayBuilder()
+        for j in range(10000):
+            builder.beginlist()
+            builder.integer(i)
+            builder.real(j)
+            builder.endlist()
+        out[i] = builder.snapshot()
+
+    out = [None]*4
+    threads = [threading.Thread(target=fill, args=(i, out)) for i in range(len(out))]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for i, x in enumerate(out):
+        assert len(x) == 10000
+        assert awkward1.tolist(x[-1]) == [i, 9999.0]
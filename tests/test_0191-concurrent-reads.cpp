@@ -0,0 +1,158 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+// Run in a build configured with -DAWKWARD_TSAN=ON to check for data races,
+// not just wrong answers.
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/Reducer.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+
+namespace ak = awkward;
+
+const int64_t kLength = 2000;
+const int64_t kThreads = 8;
+const int64_t kRepeats = 5;
+
+// Record i is {"x": [i, i + 0.5, ...] (i % 5 items), "y": i}.
+ak::ContentPtr
+makelayout() {
+  ak::ArrayBuilder builder(ak::ArrayBuilderOptions(1024, 2.0));
+  for (int64_t i = 0;  i < kLength;  i++) {
+    builder.beginrecord();
+    builder.field_check("x");
+    builder.beginlist();
+    for (int64_t j = 0;  j < i % 5;  j++) {
+      builder.real((double)i + 0.5*j);
+    }
+    builder.endlist();
+    builder.field_check("y");
+    builder.integer(i);
+    builder.endrecord();
+  }
+  ak::ContentPtr out = builder.snapshot();
+  // not yet shared, so it may be modified in place
+  out.get()->setidentities();
+  return out;
+}
+
+// Every read-only operation that the thread-safety model covers, as JSON.
+std::vector<std::string>
+readall(const ak::ContentPtr& layout) {
+  std::vector<std::string> out;
+  ak::ContentPtr x = layout.get()->getitem_field("x");
+
+  out.push_back(layout.get()->getitem_at_nowrap(kLength / 2).get()->tojson(
+    false, 10));
+  out.push_back(layout.get()->getitem_range_nowrap(10, 20).get()->tojson(
+    false, 10));
+
+  ak::Index64 carry(kLength / 3);
+  for (int64_t i = 0;  i < carry.length();  i++) {
+    carry.setitem_at_nowrap(i, kLength - 1 - 3*i);
+  }
+  out.push_back(layout.get()->carry(carry).get()->tojson(false, 10));
+
+  ak::ReducerSum sum;
+  out.push_back(x.get()->reduce(sum, -1, false, false).get()->tojson(false,
+                                                                     10));
+  ak::ReducerMax max;
+  out.push_back(x.get()->reduce(max, -1, true, false).get()->tojson(false,
+                                                                    10));
+  out.push_back(x.get()->num(1, 0).get()->tojson(false, 10));
+  out.push_back(
+    x.get()->offsets_and_flattened(1, 0).second.get()->tojson(false, 10));
+  out.push_back(layout.get()->tojson(false, 10));
+
+  out.push_back(layout.get()->getitem_range_nowrap(5, 8).get()->getitem_field(
+    "x").get()->identities().get()->classname());
+  return out;
+}
+
+int main(int, char**)
+{
+  ak::ContentPtr layout = makelayout();
+  ak::Identities::Ref xref =
+    layout.get()->getitem_field("x").get()->identities().get()->ref();
+  std::vector<std::string> expected = readall(layout);
+  ak::Index64 carry(kLength / 3);
+  for (int64_t i = 0;  i < carry.length();  i++) {
+    carry.setitem_at_nowrap(i, kLength - 1 - 3*i);
+  }
+
+  std::atomic<int64_t> failures(0);
+  std::atomic<int64_t> running(kThreads);
+  std::vector<std::thread> threads;
+  for (int64_t t = 0;  t < kThreads;  t++) {
+    threads.push_back(std::thread(
+      [&layout, &expected, &failures, &running]() -> void {
+      for (int64_t r = 0;  r < kRepeats;  r++) {
+        if (readall(layout) != expected) {
+          failures++;
+        }
+      }
+      running--;
+    }));
+  }
+
+  // Copy-on-write alongside the readers, for as long as they run: none of
+  // this may touch layout.
+  threads.push_back(std::thread([&layout, &failures, &running]() -> void {
+    while (running.load() > 0) {
+      ak::ContentPtr copy = layout.get()->shallow_copy();
+      copy.get()->setidentities();
+      ak::ContentPtr renamed = layout.get()->withparameter("__record__",
+                                                           "\"point\"");
+      ak::ContentPtr stripped =
+        layout.get()->withidentities(ak::Identities::none());
+      if (stripped.get()->getitem_field("x").get()->identities().get() !=
+          nullptr) {
+        failures++;
+      }
+      if (renamed.get()->parameter("__record__") != "\"point\"") {
+        failures++;
+      }
+    }
+  }));
+
+  for (auto& x : threads) {
+    x.join();
+  }
+
+  if (failures.load() != 0) {return -1;}
+  if (layout.get()->parameter("__record__") != "null") {return -1;}
+  if (layout.get()->getitem_field("x").get()->identities().get()->ref() !=
+      xref) {
+    return -1;
+  }
+  if (readall(layout) != expected) {return -1;}
+
+  // A carried RecordArray is new, so it may get new identities in place,
+  // but its fields are only carried lazily and shared with its copies.
+  ak::ContentPtr carried = layout.get()->carry(carry);
+  ak::ContentPtr before = carried.get()->shallow_copy();
+  carried.get()->setidentities();
+  ak::Identities::Ref carriedref =
+    carried.get()->identities().get()->ref();
+  for (auto key : { "x", "y" }) {
+    ak::IdentitiesPtr ids =
+      carried.get()->getitem_field(key).get()->identities();
+    if (ids.get()->length() != carry.length()  ||
+        ids.get()->ref() != carriedref) {
+      return -1;
+    }
+  }
+  if (carried.get()->tojson(false, 10) != expected[2]) {return -1;}
+  if (before.get()->getitem_field("x").get()->identities().get()->ref() !=
+      xref) {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <string>
+
+#include "awkward/Content.h"
+#include "awkward/Identities.h"
+#include "awkward/Index.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/NumpyArray.h"
+
+#include "identities-layout.h"
+
+namespace ak = awkward;
+
+const int64_t kLength = 200;
+const std::string kClassname = "VirtualIdentities";
+
+int main(int, char**)
+{
+  ak::ContentPtr layout = makelayout(kLength);
+  ak::ContentPtr materialized = layout.get()->shallow_copy();
+  materialized.get()->setidentities();
+  ak::ContentPtr virtualized = layout.get()->shallow_copy();
+  virtualized.get()->setvirtualidentities();
+
+  if (!samefields(materialized, virtualized, kClassname)) {return -1;}
+
+  // lists within lists, down to the NumpyArray
+  ak::ContentPtr xone = materialized.get()->getitem_field("x");
+  ak::ContentPtr xtwo = virtualized.get()->getitem_field("x");
+  for (int64_t i = 0;  i < kLength;  i++) {
+    ak::ContentPtr one = xone.get()->getitem_at_nowrap(i);
+    ak::ContentPtr two = xtwo.get()->getitem_at_nowrap(i);
+    if (!sameidentities(one, two, kClassname)) {return -1;}
+    for (int64_t j = 0;  j < one.get()->length();  j++) {
+      if (!sameidentities(one.get()->getitem_at_nowrap(j),
+                          two.get()->getitem_at_nowrap(j), kClassname)) {
+        return -1;
+      }
+    }
+  }
+
+  // ranges and carries are recorded, not applied
+  if (!samefields(materialized.get()->getitem_range_nowrap(13, 150),
+                  virtualized.get()->getitem_range_nowrap(13, 150),
+                  kClassname)) {
+    return -1;
+  }
+  ak::Index64 carry(kLength / 3);
+  for (int64_t i = 0;  i < carry.length();  i++) {
+    carry.setitem_at_nowrap(i, kLength - 1 - 3*i);
+  }
+  ak::ContentPtr carriedone = materialized.get()->carry(carry);
+  ak::ContentPtr carriedtwo = virtualized.get()->carry(carry);
+  if (!samefields(carriedone, carriedtwo, kClassname)) {return -1;}
+  if (!samefields(carriedone.get()->getitem_range_nowrap(5, 20),
+                  carriedtwo.get()->getitem_range_nowrap(5, 20),
+                  kClassname)) {
+    return -1;
+  }
+
+  // a carry of a carry is one carry of the original
+  ak::Index64 again(20);
+  for (int64_t i = 0;  i < again.length();  i++) {
+    again.setitem_at_nowrap(i, (7*i) % 40);
+  }
+  ak::ContentPtr twiceone =
+    carriedone.get()->getitem_range_nowrap(10, 50).get()->carry(again);
+  ak::ContentPtr twicetwo =
+    carriedtwo.get()->getitem_range_nowrap(10, 50).get()->carry(again);
+  if (!samefields(twiceone, twicetwo, kClassname)) {return -1;}
+  ak::VirtualIdentities* rawtwice = dynamic_cast<ak::VirtualIdentities*>(
+    twicetwo.get()->identities().get());
+  if (rawtwice == nullptr  ||
+      rawtwice->kind() != ak::VirtualIdentities::Kind::carry  ||
+      dynamic_cast<ak::VirtualIdentities*>(rawtwice->parent().get())->kind()
+        != ak::VirtualIdentities::Kind::root) {
+    return -1;
+  }
+
+  // no table of length x width is kept
+  if (virtualized.get()->nbytes() >= materialized.get()->nbytes()) {
+    return -1;
+  }
+
+  // contents that are not unique have no identities once materialized
+  ak::Index64 starts(2);
+  ak::Index64 stops(2);
+  starts.setitem_at_nowrap(0, 0);
+  starts.setitem_at_nowrap(1, 0);
+  stops.setitem_at_nowrap(0, 2);
+  stops.setitem_at_nowrap(1, 2);
+  ak::Index64 data(2);
+  ak::ContentPtr overlapping = std::make_shared<ak::ListArray64>(
+    ak::Identities::none(),
+    ak::util::Parameters(),
+    starts,
+    stops,
+    std::make_shared<ak::NumpyArray>(data));
+  overlapping.get()->setvirtualidentities();
+  ak::ListArray64* rawoverlapping =
+    dynamic_cast<ak::ListArray64*>(overlapping.get());
+  ak::IdentitiesPtr inner = rawoverlapping->content().get()->identities();
+  if (inner.get() == nullptr) {return -1;}
+  if (inner.get()->to64().get() != nullptr) {return -1;}
+  if (inner.get()->identity_at(1) != "0, 1") {return -1;}
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Identities.h"
+#include "awkward/Index.h"
+
+#include "identities-layout.h"
+
+namespace ak = awkward;
+
+const int64_t kLength = 5000;
+const std::string kClassname = "CompressedIdentities";
+
+// Every encoding must give back exactly what it was given, by value and by
+// decode, from any starting row.
+bool
+roundtrip(const std::vector<int64_t>& data,
+          ak::IdentitiesColumn::Encoding expected) {
+  ak::IdentitiesColumn column = ak::IdentitiesColumn::encode(
+    (int64_t)data.size(),
+    [&data](int64_t i) -> int64_t { return data[(size_t)i]; });
+  if (column.encoding() != expected) {
+    return false;
+  }
+  for (size_t i = 0;  i < data.size();  i++) {
+    if (column.value((int64_t)i) != data[i]) {
+      return false;
+    }
+  }
+  for (int64_t start : { (int64_t)0, (int64_t)1, (int64_t)63, (int64_t)64 }) {
+    if (start > (int64_t)data.size()) {
+      continue;
+    }
+    std::vector<int64_t> decoded(data.size() - (size_t)start);
+    column.decode(start, (int64_t)decoded.size(), decoded.data(), 1);
+    for (size_t i = 0;  i < decoded.size();  i++) {
+      if (decoded[i] != data[(size_t)start + i]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main(int, char**)
+{
+  std::vector<int64_t> runs;
+  std::vector<int64_t> ascending;
+  std::vector<int64_t> steps;
+  std::vector<int64_t> shuffled;
+  std::vector<int64_t> wide;
+  for (int64_t i = 0;  i < 1000;  i++) {
+    runs.push_back(i / 100);
+    ascending.push_back(1000000 + 3*i);
+    steps.push_back(1000000 + 100*i + i % 2);
+    shuffled.push_back((i * 7919) % 1000);
+    wide.push_back((i % 2 == 0 ? INT64_MAX / 2 : -(INT64_MAX / 2)) + i);
+  }
+  if (!roundtrip(runs, ak::IdentitiesColumn::Encoding::runlength)) {
+    return -1;
+  }
+  if (!roundtrip(ascending, ak::IdentitiesColumn::Encoding::frameofreference)) {
+    return -1;
+  }
+  if (!roundtrip(shuffled, ak::IdentitiesColumn::Encoding::frameofreference)) {
+    return -1;
+  }
+  if (!roundtrip(steps, ak::IdentitiesColumn::Encoding::delta)) {
+    return -1;
+  }
+  // differences too large for int64 still come back exactly
+  if (!roundtrip(wide, ak::IdentitiesColumn::Encoding::frameofreference)) {
+    return -1;
+  }
+  if (!roundtrip(std::vector<int64_t>(),
+                 ak::IdentitiesColumn::Encoding::runlength)) {
+    return -1;
+  }
+
+  ak::ContentPtr layout = makelayout(kLength);
+  ak::ContentPtr materialized = layout.get()->shallow_copy();
+  materialized.get()->setidentities();
+  ak::ContentPtr compressed = layout.get()->shallow_copy();
+  compressed.get()->setcompressedidentities();
+
+  if (!samefields(materialized, compressed, kClassname)) {return -1;}
+
+  ak::ContentPtr xone = materialized.get()->getitem_field("x");
+  ak::ContentPtr xtwo = compressed.get()->getitem_field("x");
+  for (int64_t i = 0;  i < kLength;  i += 7) {
+    ak::ContentPtr one = xone.get()->getitem_at_nowrap(i);
+    ak::ContentPtr two = xtwo.get()->getitem_at_nowrap(i);
+    if (!sameidentities(one, two, kClassname)) {return -1;}
+    for (int64_t j = 0;  j < one.get()->length();  j++) {
+      if (!sameidentities(one.get()->getitem_at_nowrap(j),
+                          two.get()->getitem_at_nowrap(j),
+                          kClassname)) {
+        return -1;
+      }
+    }
+  }
+
+  // ranges and carries stay compressed
+  if (!samefields(materialized.get()->getitem_range_nowrap(130, 4500),
+                  compressed.get()->getitem_range_nowrap(130, 4500),
+                  kClassname)) {
+    return -1;
+  }
+  ak::Index64 carry(kLength / 3);
+  for (int64_t i = 0;  i < carry.length();  i++) {
+    carry.setitem_at_nowrap(i, kLength - 1 - 3*i);
+  }
+  ak::ContentPtr carriedone = materialized.get()->carry(carry);
+  ak::ContentPtr carriedtwo = compressed.get()->carry(carry);
+  if (!samefields(carriedone, carriedtwo, kClassname)) {return -1;}
+  if (!samefields(carriedone.get()->getitem_range_nowrap(5, 200),
+                  carriedtwo.get()->getitem_range_nowrap(5, 200),
+                  kClassname)) {
+    return -1;
+  }
+
+  ak::IdentitiesPtr xids = xtwo.get()->identities();
+  ak::Index64 outofrange(1);
+  outofrange.setitem_at_nowrap(0, kLength);
+  try {
+    xids.get()->getitem_carry_64(outofrange);
+    return -1;
+  }
+  catch (std::invalid_argument& err) { }
+
+  // a fraction of the dense tables
+  ak::ContentPtr bare = layout.get()->shallow_copy();
+  int64_t densebytes = materialized.get()->nbytes() - bare.get()->nbytes();
+  int64_t compressedbytes = compressed.get()->nbytes() - bare.get()->nbytes();
+  if (compressedbytes*4 > densebytes) {return -1;}
+
+  return 0;
+}
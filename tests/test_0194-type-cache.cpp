@@ -0,0 +1,164 @@
+// BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "awkward/Content.h"
+#include "awkward/Index.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/type/RecordType.h"
+
+namespace ak = awkward;
+
+const int64_t kLength = 100;
+const int64_t kThreads = 8;
+
+// Record i is {"x": [i, i + 0.5, ...] (i % 3 items), "y": i or null}, and
+// with wide, 200 more fields "f0" ... "f199".
+ak::ContentPtr
+makelayout(bool wide) {
+  ak::ArrayBuilder builder(ak::ArrayBuilderOptions(1024, 2.0));
+  for (int64_t i = 0;  i < kLength;  i++) {
+    builder.beginrecord();
+    builder.field_check("x");
+    builder.beginlist();
+    for (int64_t j = 0;  j < i % 3;  j++) {
+      builder.real((double)i + 0.5*j);
+    }
+    builder.endlist();
+    builder.field_check("y");
+    if (i % 2 == 0) {
+      builder.null();
+    }
+    else {
+      builder.integer(i);
+    }
+    if (wide) {
+      for (int64_t j = 0;  j < 200;  j++) {
+        builder.field_check(std::string("f") + std::to_string(j));
+        builder.integer(j);
+      }
+    }
+    builder.endrecord();
+  }
+  return builder.snapshot();
+}
+
+int main(int, char**)
+{
+  ak::util::TypeStrs notypestrs;
+  ak::ContentPtr one = makelayout(false);
+  ak::ContentPtr two = makelayout(false);
+
+  // memoized, and interned across layouts and down to the fields
+  ak::TypePtr onetype = one.get()->type(notypestrs);
+  if (one.get()->type(notypestrs).get() != onetype.get()) {return -1;}
+  if (two.get()->type(notypestrs).get() != onetype.get()) {return -1;}
+  ak::RecordType* record = dynamic_cast<ak::RecordType*>(onetype.get());
+  if (record == nullptr) {return -1;}
+  if (one.get()->getitem_field("x").get()->type(notypestrs).get() !=
+      record->field("x").get()) {
+    return -1;
+  }
+
+  // different typestrs are different types
+  ak::ContentPtr named = one.get()->withparameter("__record__", "\"point\"");
+  ak::util::TypeStrs typestrs;
+  typestrs["point"] = "Point";
+  ak::TypePtr plain = named.get()->type(notypestrs);
+  ak::TypePtr printed = named.get()->type(typestrs);
+  if (printed.get() == plain.get()) {return -1;}
+  if (printed.get()->tostring() != "Point") {return -1;}
+  if (named.get()->type(notypestrs).get() != plain.get()) {return -1;}
+
+  // copy-on-write leaves the original's type alone
+  if (plain.get() == onetype.get()) {return -1;}
+  if (one.get()->type(notypestrs).get() != onetype.get()) {return -1;}
+
+  // in-place changes (to a node that is not yet shared) are seen
+  ak::ContentPtr three = makelayout(false);
+  if (three.get()->type(notypestrs).get() != onetype.get()) {return -1;}
+  three.get()->setparameter("__record__", "\"point\"");
+  if (three.get()->type(notypestrs).get() != plain.get()) {return -1;}
+
+  // even in a node that its parent's type was built from
+  ak::ContentPtr four = makelayout(false);
+  if (four.get()->type(notypestrs).get() != onetype.get()) {return -1;}
+  ak::ContentPtr fourx =
+    dynamic_cast<ak::RecordArray*>(four.get())->field("x");
+  fourx.get()->setparameter("__array__", "\"things\"");
+  ak::TypePtr fourtype = four.get()->type(notypestrs);
+  if (fourtype.get() == onetype.get()) {return -1;}
+  if (dynamic_cast<ak::RecordType*>(fourtype.get())->field("x").get()->
+        parameter("__array__") != "\"things\"") {
+    return -1;
+  }
+  if (four.get()->type(notypestrs).get() != fourtype.get()) {return -1;}
+
+  // nodes that pass on a copy of their content's type with new parameters
+  ak::Index64 index(3);
+  for (int64_t i = 0;  i < 3;  i++) {
+    index.setitem_at_nowrap(i, 2 - i);
+  }
+  ak::util::Parameters cats;
+  cats["__array__"] = "\"cats\"";
+  ak::ContentPtr indexed = std::make_shared<ak::IndexedArray64>(
+    ak::Identities::none(), cats, index, one.get()->getitem_field("x"));
+  if (indexed.get()->type(notypestrs).get()->parameter("__array__") !=
+      "\"cats\"") {
+    return -1;
+  }
+  if (record->field("x").get()->parameter("__array__") != "null") {
+    return -1;
+  }
+  ak::ContentPtr scalar = one.get()->getitem_at_nowrap(3);
+  if (scalar.get()->type(notypestrs).get() != onetype.get()) {return -1;}
+  ak::ContentPtr namedscalar = named.get()->getitem_at_nowrap(3);
+  if (namedscalar.get()->type(notypestrs).get() != plain.get()) {return -1;}
+
+  // interned types cannot be modified, but their copies can
+  try {
+    onetype.get()->setparameter("__record__", "\"point\"");
+    return -1;
+  }
+  catch (std::runtime_error& err) { }
+  ak::TypePtr copy = onetype.get()->shallow_copy();
+  copy.get()->setparameter("__record__", "\"point\"");
+  if (!copy.get()->equal(plain, true)) {return -1;}
+  if (one.get()->type(notypestrs).get() != onetype.get()) {return -1;}
+
+  // many fields
+  ak::ContentPtr wideone = makelayout(true);
+  ak::ContentPtr widetwo = makelayout(true);
+  ak::TypePtr widetype = wideone.get()->type(notypestrs);
+  if (widetype.get()->numfields() != 202) {return -1;}
+  if (widetwo.get()->type(notypestrs).get() != widetype.get()) {return -1;}
+  if (widetype.get() == onetype.get()) {return -1;}
+
+  // the same answer from every thread
+  std::atomic<int64_t> failures(0);
+  std::vector<std::thread> threads;
+  ak::ContentPtr shared = makelayout(true);
+  for (int64_t t = 0;  t < kThreads;  t++) {
+    threads.push_back(std::thread(
+      [&shared, &widetype, &notypestrs, &failures]() -> void {
+      for (int64_t r = 0;  r < 100;  r++) {
+        if (shared.get()->type(notypestrs).get() != widetype.get()) {
+          failures++;
+        }
+      }
+    }));
+  }
+  for (auto& x : threads) {
+    x.join();
+  }
+  if (failures.load() != 0) {return -1;}
+
+  return 0;
+}
@@ -0,0 +1,55 @@
+# BSD 3-Clause License; see https://github.com/jpivarski/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_type_is_a_copy():
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3]))
+    offsets = awkward1.layout.Index64(numpy.array([0, 2, 3], dtype=numpy.int64))
+    array = awkward1.layout.ListOffsetArray64(offsets, content)
+
+    one = array.type({})
+    one.setparameter("__array__", "things")
+    one.parameters = {"__array__": "stuff"}
+    assert array.type({}).parameters == {}
+    assert one != array.type({})
+    assert array.type({}) == array.type({})
+
+    # the types inside are shared and read-only
+    with pytest.raises(RuntimeError):
+        one.type.setparameter("__array__", "things")
+    inner = awkward1.types.PrimitiveType("float64")
+    inner.setparameter("__array__", "things")
+    assert inner.parameters == {"__array__": "things"}
+
+def test_inplace_change_to_child():
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3]))
+    offsets = awkward1.layout.Index64(numpy.array([0, 2, 3], dtype=numpy.int64))
+    array = awkward1.layout.ListOffsetArray64(offsets, content)
+    assert str(array.type({})) == "var * float64"
+
+    content.setparameter("__array__", "things")
+    assert array.type({}).type.parameters == {"__array__": "things"}
+
+def test_withparameter_is_a_copy():
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3]))
+    offsets = awkward1.layout.Index64(numpy.array([0, 2, 3], dtype=numpy.int64))
+    array = awkward1.layout.ListOffsetArray64(offsets, content)
+
+    one = array.withparameter("__array__", "things")
+    two = array.withparameters({"__array__": "stuff"})
+    assert array.parameters == {}
+    assert one.parameters == {"__array__": "things"}
+    assert two.parameters == {"__array__": "stuff"}
+    assert awkward1.tolist(one) == awkward1.tolist(array)
+
+    array.setidentities()
+    three = array.withidentities(None)
+    assert array.identities is not None
+    assert three.identities is None